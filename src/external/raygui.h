@@ -82,6 +82,9 @@
 *       Note that the first set of BASE properties (by default guiStyle[0..15]) belong to the generic style
 *       used for all controls, when any of those base values is set, it is automatically populated to all
 *       controls, so, specific control values overwriting generic style should be set after base values.
+*       Controls overriding BASE values are tracked (GuiGetStyleOverrides()), populating a BASE value is
+*       deferred until style data is accessed, meanwhile not overriding controls just read the generic value.
+*       Overrides can be restored with GuiSetStyleOverrides() (i.e. undo), not overriding controls get the generic value.
 *
 *       After the first BASE set we have the EXTENDED properties (by default guiStyle[16..23]), those
 *       properties are actually common to all controls and can not be overwritten individually (like BASE ones)
@@ -140,6 +143,10 @@
 *       #define RAYGUI_DEBUG_TEXT_BOUNDS
 *           Draw text bounds rectangles for debug
 *
+*       #define RAYGUI_FONT_ATLAS_DECODE
+*           Always decode block compressed font atlas (DXT5/ETC2_EAC) on CPU, instead of uploading blocks
+*           to GPU, required if font atlas texture data must be retrieved (i.e. style editing tools)
+*
 *   VERSIONS HISTORY:
 *       4.0 (12-Sep-2023) ADDED: GuiToggleSlider()
 *                         ADDED: GuiColorPickerHSV() and GuiColorPanelHSV()
@@ -351,6 +358,26 @@
     #define RAYGUI_FREE(p)          free(p)
 #endif
 
+// Allow custom tracing of expensive processes (i.e. style font decoding)
+#ifndef RAYGUI_TRACE_BEGIN
+    #define RAYGUI_TRACE_BEGIN(name)
+#endif
+#ifndef RAYGUI_TRACE_END
+    #define RAYGUI_TRACE_END()
+#endif
+
+// Allow custom text style font loading (i.e. cached font atlas)
+#ifndef RAYGUI_LOAD_FONT
+    #define RAYGUI_LOAD_FONT(fileName, fontSize, codepoints, codepointCount)    LoadFontEx(fileName, fontSize, codepoints, codepointCount)
+#endif
+
+// Allow custom block compressed font atlas decoding (i.e. rgs library rgs_font_atlas_decode())
+// NOTE: Decoded data is GRAY+ALPHA, freed with RAYGUI_FREE(), internal decoder only used if not provided
+#ifndef RAYGUI_DECODE_FONT_ATLAS
+    #define RAYGUI_DECODE_FONT_ATLAS(data, width, height, format)   GuiDecodeFontAtlasBlocks(data, width, height, format)
+    #define RAYGUI_DECODE_FONT_ATLAS_INTERNAL
+#endif
+
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
 #define RAYGUI_SUPPORT_LOG_INFO
@@ -560,7 +587,8 @@ typedef enum {
     BACKGROUND_COLOR,           // Background color
     TEXT_LINE_SPACING,          // Text spacing between lines
     TEXT_ALIGNMENT_VERTICAL,    // Text vertical alignment inside text bounds (after border and padding)
-    TEXT_WRAP_MODE              // Text wrap-mode inside text bounds
+    TEXT_WRAP_MODE,             // Text wrap-mode inside text bounds
+    TEXT_FONT_FACE              // Text font face (0-Main font, N-Additional face sharing main font atlas), global for all controls
     //TEXT_DECORATION             // Text decoration: 0-None, 1-Underline, 2-Line-through, 3-Overline
     //TEXT_DECORATION_THICK       // Text decoration line thikness
 } GuiDefaultProperty;
@@ -672,17 +700,34 @@ RAYGUIAPI void GuiSetAlpha(float alpha);                        // Set gui contr
 RAYGUIAPI void GuiSetState(int state);                          // Set gui state (global state)
 RAYGUIAPI int GuiGetState(void);                                // Get gui state (global state)
 
+// Partial redraw functions
+RAYGUIAPI Rectangle GuiBeginRedraw(void);                       // Begin gui frame redraw, returns damaged rectangle to be redrawn (use as scissor)
+RAYGUIAPI void GuiEndRedraw(void);                              // End gui frame redraw
+RAYGUIAPI void GuiRedrawAll(void);                              // Request a full redraw, required on state changes not triggered by input
+RAYGUIAPI void GuiRedrawRec(Rectangle rec);                     // Request a rectangle redraw, required on local state changes not triggered by input
+RAYGUIAPI bool GuiCheckMouseHover(Rectangle bounds);            // Check mouse inside bounds, bounds registered for partial redraw (required by custom controls)
+
 // Font set/get functions
 RAYGUIAPI void GuiSetFont(Font font);                           // Set gui custom font (global state)
 RAYGUIAPI Font GuiGetFont(void);                                // Get gui custom font (global state)
+RAYGUIAPI void GuiSetFontFace(int face, Font font);             // Set gui font face, sharing main font atlas texture (global state)
+RAYGUIAPI Font GuiGetFontFace(int face);                        // Get gui font face (global state)
 
 // Style set/get functions
 RAYGUIAPI void GuiSetStyle(int control, int property, int value); // Set one style property
 RAYGUIAPI int GuiGetStyle(int control, int property);           // Get one style property
+RAYGUIAPI void GuiSetStyleBulk(unsigned int controls, unsigned int properties, int value); // Set style base properties for several controls (bit masks)
+RAYGUIAPI void GuiSetStyleData(unsigned int *style);            // Set style properties data pointer, NULL restores internal style array
+RAYGUIAPI unsigned int *GuiGetStyleData(void);                  // Get style properties data pointer
+RAYGUIAPI unsigned int GuiGetStyleOverrides(int property);      // Get controls overriding DEFAULT base property (bit per control)
+RAYGUIAPI void GuiSetStyleOverrides(int property, unsigned int controls); // Set controls overriding DEFAULT base property (bit per control), others get DEFAULT value
 
 // Styles loading functions
 RAYGUIAPI void GuiLoadStyle(const char *fileName);              // Load style file over global style variable (.rgs)
 RAYGUIAPI void GuiLoadStyleDefault(void);                       // Load style default over global style
+#if !defined(RAYGUI_STANDALONE)
+RAYGUIAPI Texture2D GuiLoadFontAtlasTexture(Image atlas);       // Load font atlas texture, block compressed atlas decoded on CPU if not supported by GPU
+#endif
 
 // Tooltips management functions
 RAYGUIAPI void GuiEnableTooltip(void);                          // Enable gui tooltips (global state)
@@ -694,6 +739,7 @@ RAYGUIAPI const char *GuiIconText(int iconId, const char *text); // Get text wit
 #if !defined(RAYGUI_NO_ICONS)
 RAYGUIAPI void GuiSetIconScale(int scale);                      // Set default icon drawing size
 RAYGUIAPI unsigned int *GuiGetIcons(void);                      // Get raygui icons data pointer
+RAYGUIAPI void GuiSetIcons(unsigned int *icons);                // Set raygui icons data pointer, NULL restores internal icons array
 RAYGUIAPI char **GuiLoadIcons(const char *fileName, bool loadIconsName); // Load raygui icons file (.rgi) into internal icons data
 RAYGUIAPI void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color); // Draw icon using pixel size at specified position
 #endif
@@ -1031,7 +1077,7 @@ typedef enum {
 #include <stdlib.h>             // Required for: malloc(), calloc(), free() [GuiLoadStyle(), GuiLoadIcons()]
 #include <string.h>             // Required for: strlen() [GuiTextBox(), GuiValueBox()], memset(), memcpy()
 #include <stdarg.h>             // Required for: va_list, va_start(), vfprintf(), va_end() [TextFormat()]
-#include <math.h>               // Required for: roundf() [GuiColorPicker()]
+#include <math.h>               // Required for: roundf() [GuiColorPicker()], floorf(), ceilf() [GuiBeginRedraw()]
 
 #ifdef __cplusplus
     #define RAYGUI_CLITERAL(name) name
@@ -1333,6 +1379,12 @@ static unsigned int *guiIconsPtr = guiIcons;
 
 #endif      // !RAYGUI_NO_ICONS && !RAYGUI_CUSTOM_ICONS
 
+#if !defined(RAYGUI_NO_ICONS)
+// Icons set previous to loading style icons (ICNS chunk), restored by GuiLoadStyleDefault()
+static unsigned int guiIconsBase[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
+static bool guiIconsBaseSaved = false;
+#endif
+
 #ifndef RAYGUI_ICON_SIZE
     #define RAYGUI_ICON_SIZE             0
 #endif
@@ -1343,6 +1395,18 @@ static unsigned int *guiIconsPtr = guiIcons;
 #define RAYGUI_MAX_PROPS_BASE           16      // Maximum number of base properties
 #define RAYGUI_MAX_PROPS_EXTENDED        8      // Maximum number of extended properties
 
+#if !defined(RAYGUI_MAX_FONT_FACES)
+    #define RAYGUI_MAX_FONT_FACES        4      // Maximum number of font faces (main font included)
+#endif
+
+#if !defined(RAYGUI_MAX_REDRAW_RECS)
+    #define RAYGUI_MAX_REDRAW_RECS     256      // Maximum number of controls hover rectangles tracked per frame (partial redraw)
+#endif
+
+#if !defined(RAYGUI_MAX_BAKED_TEXTURES)
+    #define RAYGUI_MAX_BAKED_TEXTURES    4      // Maximum number of color controls backgrounds baked textures
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -1354,7 +1418,8 @@ typedef enum { BORDER = 0, BASE, TEXT, OTHER } GuiPropertyElement;
 //----------------------------------------------------------------------------------
 static GuiState guiState = STATE_NORMAL;        // Gui global state, if !STATE_NORMAL, forces defined state
 
-static Font guiFont = { 0 };                    // Gui current font (WARNING: highly coupled to raylib)
+static Font guiFont = { 0 };                    // Gui current font, selected face (WARNING: highly coupled to raylib)
+static Font guiFontFaces[RAYGUI_MAX_FONT_FACES] = { 0 };  // Gui font faces, face 0 is main font, all faces share its atlas texture
 static bool guiLocked = false;                  // Gui lock state (no inputs processed)
 static float guiAlpha = 1.0f;                   // Gui controls transparency
 
@@ -1366,11 +1431,69 @@ static const char *guiTooltipPtr = NULL;        // Tooltip string pointer (strin
 static bool guiSliderDragging = false;          // Gui slider drag state (no inputs processed except dragged slider)
 static Rectangle guiSliderActive = { 0 };       // Gui slider active bounds rectangle, used as an unique identifier
 
+// Gui partial redraw tracking, controls register their hover rectangles every frame,
+// on mouse move, mouse wheel or mouse drag only controls under previous and current mouse position
+// (and controls pressed on drag start) require redraw
+// NOTE: Input events (mouse buttons pressed/released, keys down except modifiers) require a full redraw,
+// controls results are processed by user code and could change any gui state
+static bool guiRedrawActive = false;            // Gui redraw tracking active (between GuiBeginRedraw() and GuiEndRedraw())
+static Rectangle guiRedrawRec = { 0 };          // Gui redraw damaged rectangle for current frame
+static Rectangle guiRedrawDamageRec = { 0 };    // Gui redraw damaged rectangle requested by user (GuiRedrawRec())
+static Rectangle guiRedrawPressRec = { 0 };     // Gui redraw controls rectangle under mouse on button press (dragged controls)
+static int guiRedrawFullFrames = 2;             // Gui redraw full frames required (first frames always fully redrawn)
+static bool guiRedrawTooltip = false;           // Gui redraw tooltip drawn on current frame
+static Vector2 guiRedrawMousePrev = { -1, -1 }; // Gui redraw mouse position on previous frame
+static Rectangle guiRedrawRecs[2][RAYGUI_MAX_REDRAW_RECS] = { 0 };  // Gui redraw controls hover rectangles (previous and current frame)
+static int guiRedrawRecsCount[2] = { 0 };       // Gui redraw controls hover rectangles count
+static int guiRedrawRecsFrame = 0;              // Gui redraw current frame rectangles index
+
+#if !defined(RAYGUI_STANDALONE)
+// Gui color controls backgrounds baked into textures (alpha bar checked background, hue bar gradient),
+// entries are identified by type, size and style colors used, only baked again when any of them changes
+// NOTE: If all entries are in use, oldest baked entry is replaced
+typedef enum { GUI_BAKED_NONE = 0, GUI_BAKED_ALPHABAR, GUI_BAKED_HUEBAR } GuiBakedType;
+
+static struct {
+    GuiBakedType type;          // Baked background type
+    int width;                  // Baked background width
+    int height;                 // Baked background height
+    int color1;                 // Baked background style color 1 (hex value)
+    int color2;                 // Baked background style color 2 (hex value)
+    Texture2D texture;          // Baked background texture
+} guiBakedTextures[RAYGUI_MAX_BAKED_TEXTURES] = { 0 };
+static int guiBakedTexturesNext = 0;            // Gui baked textures next entry to be replaced
+#endif
+
 static int textBoxCursorIndex = 0;              // Cursor index, shared by all GuiTextBox*()
 //static int blinkCursorFrameCounter = 0;       // Frame counter for cursor blinking
 static int autoCursorCooldownCounter = 0;       // Cooldown frame counter for automatic cursor movement on key-down
 static int autoCursorDelayCounter = 0;          // Delay frame counter for automatic cursor movement
 
+// Text box prefix advance cache, shared by all GuiTextBox() (only one can be in edit mode)
+// NOTE: textBoxAdvances[i] is the width of all text codepoints starting before byte index i,
+// it is updated on codepoints insertion/deletion, so no text measuring required every frame
+static const char *textBoxCacheText = NULL;     // Text box cache text pointer
+static float *textBoxAdvances = NULL;           // Text box cache prefix advances (textLength + 1 values)
+static int textBoxCacheLength = 0;              // Text box cache text length (in bytes)
+static int textBoxCacheCapacity = 0;            // Text box cache advances capacity (text buffer size)
+static Font textBoxCacheFont = { 0 };           // Text box cache font, required to validate cache
+static int textBoxCacheTextSize = 0;            // Text box cache text size, required to validate cache
+static int textBoxCacheTextSpacing = 0;         // Text box cache text spacing, required to validate cache
+
+#if !defined(RAYGUI_STANDALONE) && defined(RAYGUI_DECODE_FONT_ATLAS_INTERNAL)
+// EAC alpha block modifiers, by table index, used by block compressed font atlas (ETC2_EAC)
+static const signed char guiEacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+#endif
+
 //----------------------------------------------------------------------------------
 // Style data array for all gui style properties (allocated on data segment by default)
 //
@@ -1385,8 +1508,16 @@ static int autoCursorDelayCounter = 0;          // Delay frame counter for autom
 //----------------------------------------------------------------------------------
 static unsigned int guiStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
 
+// NOTE: We keep a pointer to the style array, useful to point to other style sets if required
+static unsigned int *guiStylePtr = guiStyle;
+
 static bool guiStyleLoaded = false;         // Style loaded flag for lazy style initialization
 
+// NOTE: Controls overriding DEFAULT BASE properties are tracked per property (bit per control),
+// DEFAULT BASE properties set are propagated to not overriding controls on style data access
+static unsigned int guiStyleOverrides[RAYGUI_MAX_PROPS_BASE] = { 0 };  // Controls overriding DEFAULT base property (bit per control)
+static unsigned int guiStylePending = 0;    // DEFAULT base properties pending propagation (bit per property)
+
 //----------------------------------------------------------------------------------
 // Standalone Mode Functions Declaration
 //
@@ -1463,8 +1594,28 @@ static void DrawRectangleGradientV(int posX, int posY, int width, int height, Co
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize);    // Load style from memory (binary only)
+static void GuiResolveStyle(void);                      // Resolve style DEFAULT base properties pending propagation
+static void GuiUpdateFontFace(void);                    // Update current font with selected face (DEFAULT TEXT_FONT_FACE)
+static unsigned long long GuiReadVarint(const unsigned char **data, const unsigned char *dataEnd); // Read variable-length integer (LEB128) and move data pointer (NULL if truncated)
+#if !defined(RAYGUI_STANDALONE)
+static void GuiLoadStyleFontFaces(const unsigned char *chunkData, int chunkSize);   // Load style font faces from memory (FNTF chunk)
+#if defined(RAYGUI_DECODE_FONT_ATLAS_INTERNAL)
+static unsigned char *GuiDecodeFontAtlasBlocks(const unsigned char *blocks, int width, int height, int format); // Decode block compressed font atlas alpha into GRAY+ALPHA data
+#endif
+#if !defined(RAYGUI_NO_ICONS)
+static void GuiLoadStyleIcons(const unsigned char *chunkData, int chunkSize);       // Load style icons from memory (ICNS chunk)
+#endif
+#endif
+#if !defined(RAYGUI_NO_ICONS)
+static void GuiSaveIconsBase(void);                                                 // Save current icons set as base, to be restored by GuiLoadStyleDefault()
+#endif
 
 static int GetTextWidth(const char *text);                      // Gui get text width using gui font and style
+static float GetGlyphAdvance(int codepoint);                    // Gui get codepoint advance using gui font and style (spacing included)
+static void UpdateTextBoxCache(const char *text, int bufferSize);  // Update text box prefix advance cache, rebuilt if not valid
+static void TextBoxCacheInsert(int index, int codepointSize, int codepoint);   // Update text box cache on codepoint insertion
+static void TextBoxCacheRemove(int index, int codepointSize);   // Update text box cache on codepoint deletion
+static int GetTextBoxCacheIndex(float width);                   // Get text box cache last codepoint index with prefix advance lower than width
 static Rectangle GetTextBounds(int control, Rectangle bounds);  // Get text bounds considering control bounds
 static const char *GetTextIcon(const char *text, int *iconId);  // Get text icon if provided and move text cursor
 
@@ -1478,6 +1629,13 @@ static Vector3 ConvertRGBtoHSV(Vector3 rgb);                    // Convert color
 static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue);   // Scroll bar control, used by GuiScrollPanel()
 static void GuiTooltip(Rectangle controlRec);                   // Draw tooltip using control rec position
 
+static bool GuiCheckHover(Vector2 point, Rectangle bounds);     // Check point inside control bounds, bounds registered for partial redraw
+static bool GuiCheckRedrawRec(Rectangle rec);                   // Check rectangle intersects current frame redraw rectangle
+static Rectangle GuiMergeRedrawRec(Rectangle rec1, Rectangle rec2); // Merge redraw rectangles, returns rectangle containing both
+#if !defined(RAYGUI_STANDALONE)
+static Texture2D GuiGetBakedTexture(GuiBakedType type, int width, int height, int color1, int color2);  // Get color control background baked texture, baked if not available
+#endif
+
 static Color GuiFade(Color color, float alpha);         // Fade color by an alpha factor
 
 //----------------------------------------------------------------------------------
@@ -1500,6 +1658,106 @@ void GuiUnlock(void) { guiLocked = false; }
 // Check if gui is locked (global state)
 bool GuiIsLocked(void) { return guiLocked; }
 
+// Begin gui frame redraw, returns damaged rectangle to be redrawn
+// NOTE: Controls are processed as usual, only drawing outside damaged rectangle is skipped,
+// it should be used as scissor rectangle for the frame, previous frame content must be kept (render texture)
+Rectangle GuiBeginRedraw(void)
+{
+    Vector2 mousePoint = GetMousePosition();
+    bool mouseMoved = ((mousePoint.x != guiRedrawMousePrev.x) || (mousePoint.y != guiRedrawMousePrev.y));
+    bool mouseWheel = (GetMouseWheelMove() != 0.0f);
+    bool mouseDown = false;
+    bool mousePressed = false;
+
+    // Check input events that could change gui state (beyond controls under mouse)
+    // NOTE: Held mouse buttons (dragging) and modifier keys are not considered events
+    bool inputEvent = false;
+    for (int button = 0; button < 3; button++)
+    {
+        if (IsMouseButtonDown(button)) mouseDown = true;
+        if (IsMouseButtonPressed(button)) mousePressed = true;
+        if (mousePressed || IsMouseButtonReleased(button)) inputEvent = true;
+    }
+    for (int key = 32; !inputEvent && (key <= 348); key++) inputEvent = (((key < 340) || (key > 347)) && IsKeyDown(key));
+
+    // NOTE: Input frame and next one are fully redrawn, some controls results are processed by user on next frame
+    if (inputEvent || (guiRedrawTooltip && mouseMoved)) GuiRedrawAll();
+
+    // Previous frame controls rectangles are used (layout only changes on input events)
+    int prevFrame = (guiRedrawRecsFrame + 1)%2;
+
+    // Register controls under mouse on button press, dragged controls could be updated with mouse outside their bounds
+    if (mousePressed)
+    {
+        guiRedrawPressRec = RAYGUI_CLITERAL(Rectangle){ 0 };
+
+        for (int i = 0; i < guiRedrawRecsCount[prevFrame]; i++)
+        {
+            if (CheckCollisionPointRec(mousePoint, guiRedrawRecs[prevFrame][i])) guiRedrawPressRec = GuiMergeRedrawRec(guiRedrawPressRec, guiRedrawRecs[prevFrame][i]);
+        }
+    }
+    else if (!mouseDown) guiRedrawPressRec = RAYGUI_CLITERAL(Rectangle){ 0 };
+
+    if (guiRedrawFullFrames > 0) guiRedrawRec = RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
+    else
+    {
+        guiRedrawRec = guiRedrawDamageRec;
+
+        if (mouseMoved || mouseWheel || mouseDown)
+        {
+            // Only controls under previous or current mouse position could change state (hover, scroll, drag)
+            for (int i = 0; i < guiRedrawRecsCount[prevFrame]; i++)
+            {
+                Rectangle rec = guiRedrawRecs[prevFrame][i];
+
+                if (CheckCollisionPointRec(mousePoint, rec) || CheckCollisionPointRec(guiRedrawMousePrev, rec)) guiRedrawRec = GuiMergeRedrawRec(guiRedrawRec, rec);
+            }
+
+            if (mouseDown) guiRedrawRec = GuiMergeRedrawRec(guiRedrawRec, guiRedrawPressRec);
+        }
+
+        // Align damaged rectangle to pixels
+        if ((guiRedrawRec.width > 0) && (guiRedrawRec.height > 0))
+        {
+            float right = ceilf(guiRedrawRec.x + guiRedrawRec.width);
+            float bottom = ceilf(guiRedrawRec.y + guiRedrawRec.height);
+
+            guiRedrawRec.x = floorf(guiRedrawRec.x);
+            guiRedrawRec.y = floorf(guiRedrawRec.y);
+            guiRedrawRec.width = right - guiRedrawRec.x;
+            guiRedrawRec.height = bottom - guiRedrawRec.y;
+        }
+    }
+
+    guiRedrawMousePrev = mousePoint;
+    guiRedrawDamageRec = RAYGUI_CLITERAL(Rectangle){ 0 };
+    guiRedrawRecsCount[guiRedrawRecsFrame] = 0;
+    guiRedrawTooltip = false;
+    guiRedrawActive = true;
+
+    return guiRedrawRec;
+}
+
+// End gui frame redraw
+void GuiEndRedraw(void)
+{
+    if (guiRedrawFullFrames > 0) guiRedrawFullFrames--;
+
+    guiRedrawRecsFrame = (guiRedrawRecsFrame + 1)%2;
+    guiRedrawActive = false;
+}
+
+// Request a full redraw for current and next frame
+void GuiRedrawAll(void) { if (guiRedrawFullFrames < 2) guiRedrawFullFrames = 2; }
+
+// Request a rectangle redraw
+// NOTE: Rectangle is redrawn on current frame if requested before GuiBeginRedraw(), on next frame otherwise
+void GuiRedrawRec(Rectangle rec) { guiRedrawDamageRec = GuiMergeRedrawRec(guiRedrawDamageRec, rec); }
+
+// Check mouse inside bounds, bounds registered for partial redraw
+// NOTE: Custom controls must use it for hover checks, bounds are redrawn on mouse hover changes
+bool GuiCheckMouseHover(Rectangle bounds) { return GuiCheckHover(GetMousePosition(), bounds); }
+
 // Set gui controls alpha global state
 void GuiSetAlpha(float alpha)
 {
@@ -1516,7 +1774,7 @@ void GuiSetState(int state) { guiState = (GuiState)state; }
 int GuiGetState(void) { return guiState; }
 
 // Set custom gui font
-// NOTE: Font loading/unloading is external to raygui
+// NOTE: Font loading/unloading is external to raygui, selected face is kept if it shares font atlas texture
 void GuiSetFont(Font font)
 {
     if (font.texture.id > 0)
@@ -1526,34 +1784,151 @@ void GuiSetFont(Font font)
         // default style loading first
         if (!guiStyleLoaded) GuiLoadStyleDefault();
 
-        guiFont = font;
+        guiFontFaces[0] = font;
+        GuiUpdateFontFace();
     }
 }
 
 // Get custom gui font
 Font GuiGetFont(void)
 {
-    return guiFont;
+    return guiFontFaces[0];
+}
+
+// Set gui font face
+// NOTE: Faces are expected to use the main font atlas texture (only recs/glyphs differ),
+// that way all UI text and shapes keep drawing from a single texture (one draw call),
+// face is selected with GuiSetStyle(DEFAULT, TEXT_FONT_FACE, face), an empty font clears it
+// WARNING: Face selection is global (DEFAULT property), set it around the controls that require it
+void GuiSetFontFace(int face, Font font)
+{
+    if (face == 0) GuiSetFont(font);
+    else if ((face > 0) && (face < RAYGUI_MAX_FONT_FACES))
+    {
+        if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+        guiFontFaces[face] = font;
+        GuiUpdateFontFace();
+    }
+}
+
+// Get gui font face
+Font GuiGetFontFace(int face)
+{
+    Font font = { 0 };
+
+    if ((face >= 0) && (face < RAYGUI_MAX_FONT_FACES)) font = guiFontFaces[face];
+
+    return font;
 }
 
 // Set control style property value
 void GuiSetStyle(int control, int property, int value)
 {
     if (!guiStyleLoaded) GuiLoadStyleDefault();
-    guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+    guiStylePtr[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
 
-    // Default properties are propagated to all controls
-    if ((control == 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    if (property < RAYGUI_MAX_PROPS_BASE)
     {
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) guiStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+        // Default properties are propagated to all controls, previous controls overrides discarded
+        // NOTE: Propagation is deferred, not overriding controls read DEFAULT value meanwhile
+        if (control == 0)
+        {
+            guiStyleOverrides[property] = 0;
+            guiStylePending |= (1u << property);
+        }
+        else guiStyleOverrides[property] |= (1u << control);
     }
+    else if ((control == 0) && (property == TEXT_FONT_FACE)) GuiUpdateFontFace();
 }
 
 // Get control style property value
 int GuiGetStyle(int control, int property)
 {
     if (!guiStyleLoaded) GuiLoadStyleDefault();
-    return guiStyle[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+
+    // DEFAULT base property not propagated yet, value inherited by not overriding controls
+    if ((property < RAYGUI_MAX_PROPS_BASE) && (guiStylePending & (1u << property)) && !(guiStyleOverrides[property] & (1u << control))) return guiStylePtr[property];
+
+    return guiStylePtr[control*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property];
+}
+
+// Set style base properties for several controls (bit masks)
+// NOTE: DEFAULT is not included in controls (no propagation), properties set become controls overrides
+void GuiSetStyleBulk(unsigned int controls, unsigned int properties, int value)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    controls &= ~1u;
+
+    for (int property = 0; property < RAYGUI_MAX_PROPS_BASE; property++)
+    {
+        if (!(properties & (1u << property))) continue;
+
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            if (controls & (1u << i)) guiStylePtr[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = value;
+        }
+
+        guiStyleOverrides[property] |= controls;
+    }
+}
+
+// Set style properties data pointer
+// NOTE: Provided array must contain RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) values,
+// it allows switching between several style sets without copying data, font is not changed
+// NOTE: Controls overrides are rebuilt from provided data (values different than DEFAULT),
+// it is also required after modifying style data directly
+void GuiSetStyleData(unsigned int *style)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    GuiResolveStyle();
+    guiStylePtr = (style != NULL)? style : guiStyle;
+
+    for (int property = 0; property < RAYGUI_MAX_PROPS_BASE; property++)
+    {
+        guiStyleOverrides[property] = 0;
+
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            if (guiStylePtr[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] != guiStylePtr[property]) guiStyleOverrides[property] |= (1u << i);
+        }
+    }
+
+    // Update current font face for the new style set
+    GuiUpdateFontFace();
+}
+
+// Get style properties data pointer
+// NOTE: Pending DEFAULT properties are propagated first, data is fully resolved
+unsigned int *GuiGetStyleData(void)
+{
+    GuiResolveStyle();
+
+    return guiStylePtr;
+}
+
+// Get controls overriding DEFAULT base property (bit per control)
+// NOTE: Extended properties are not inherited, no overrides tracked for them
+unsigned int GuiGetStyleOverrides(int property)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    return ((property >= 0) && (property < RAYGUI_MAX_PROPS_BASE))? guiStyleOverrides[property] : 0;
+}
+
+// Set controls overriding DEFAULT base property (bit per control)
+// NOTE: Overriding controls keep their current value, not overriding controls get DEFAULT value (deferred)
+void GuiSetStyleOverrides(int property, unsigned int controls)
+{
+    if (!guiStyleLoaded) GuiLoadStyleDefault();
+
+    if ((property >= 0) && (property < RAYGUI_MAX_PROPS_BASE))
+    {
+        guiStyleOverrides[property] = controls & ~1u;
+        guiStylePending |= (1u << property);
+    }
 }
 
 //----------------------------------------------------------------------------------
@@ -1853,7 +2228,7 @@ int GuiScrollPanel(Rectangle bounds, const char *text, Rectangle content, Vector
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -1964,7 +2339,7 @@ int GuiButton(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -2002,7 +2377,7 @@ int GuiLabelButton(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -2036,7 +2411,7 @@ int GuiToggle(Rectangle bounds, const char *text, bool *active)
         Vector2 mousePoint = GetMousePosition();
 
         // Check toggle button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
@@ -2144,7 +2519,7 @@ int GuiToggleSlider(Rectangle bounds, const char *text, int *active)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
@@ -2223,7 +2598,7 @@ int GuiCheckBox(Rectangle bounds, const char *text, bool *checked)
         };
 
         // Check checkbox state
-        if (CheckCollisionPointRec(mousePoint, totalBounds))
+        if (GuiCheckHover(mousePoint, totalBounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -2283,8 +2658,8 @@ int GuiComboBox(Rectangle bounds, const char *text, int *active)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds) ||
-            CheckCollisionPointRec(mousePoint, selector))
+        if (GuiCheckHover(mousePoint, bounds) ||
+            GuiCheckHover(mousePoint, selector))
         {
             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
             {
@@ -2350,13 +2725,13 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
             state = STATE_PRESSED;
 
             // Check if mouse has been pressed or released outside limits
-            if (!CheckCollisionPointRec(mousePoint, boundsOpen))
+            if (!GuiCheckHover(mousePoint, boundsOpen))
             {
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) result = 1;
             }
 
             // Check if already selected item has been pressed again
-            if (CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
+            if (GuiCheckHover(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
 
             // Check focused and selected item
             for (int i = 0; i < itemCount; i++)
@@ -2364,7 +2739,7 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
                 // Update item rectangle y position for next item
                 itemBounds.y += (bounds.height + GuiGetStyle(DROPDOWNBOX, DROPDOWN_ITEMS_SPACING));
 
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
+                if (GuiCheckHover(mousePoint, itemBounds))
                 {
                     itemFocused = i;
                     if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON))
@@ -2380,7 +2755,7 @@ int GuiDropdownBox(Rectangle bounds, const char *text, int *active, bool editMod
         }
         else
         {
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHover(mousePoint, bounds))
             {
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
                 {
@@ -2456,7 +2831,16 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
     int wrapMode = GuiGetStyle(DEFAULT, TEXT_WRAP_MODE);
 
     Rectangle textBounds = GetTextBounds(TEXTBOX, bounds);
-    int textWidth = GetTextWidth(text) - GetTextWidth(text + textBoxCursorIndex);
+
+    // Text prefix advances are cached while editing, cursor and scrolling positions are just looked up
+    // NOTE: Cursor index could be out of text if text was changed externally, it is clamped
+    if (editMode)
+    {
+        UpdateTextBoxCache(text, bufferSize);
+        if (textBoxCursorIndex > textBoxCacheLength) textBoxCursorIndex = textBoxCacheLength;
+    }
+
+    int textWidth = editMode? (int)textBoxAdvances[textBoxCursorIndex] : 0;
     int textIndexOffset = 0;    // Text index offset to start drawing in the box
 
     // Cursor rectangle
@@ -2507,17 +2891,22 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
 
             // If text does not fit in the textbox and current cursor position is out of bounds,
             // we add an index offset to text for drawing only what requires depending on cursor
-            while (textWidth >= textBounds.width)
+            // NOTE: Offset is the first codepoint that keeps cursor inside text bounds
+            if (textWidth >= textBounds.width)
             {
-                int nextCodepointSize = 0;
-                GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
+                textIndexOffset = GetTextBoxCacheIndex(textBoxAdvances[textBoxCursorIndex] - textBounds.width);
 
-                textIndexOffset += nextCodepointSize;
+                if ((textBoxAdvances[textBoxCursorIndex] - textBoxAdvances[textIndexOffset]) >= textBounds.width)
+                {
+                    int nextCodepointSize = 0;
+                    GetCodepointNext(text + textIndexOffset, &nextCodepointSize);
+                    textIndexOffset += nextCodepointSize;
+                }
 
-                textWidth = GetTextWidth(text + textIndexOffset) - GetTextWidth(text + textBoxCursorIndex);
+                textWidth = (int)(textBoxAdvances[textBoxCursorIndex] - textBoxAdvances[textIndexOffset]);
             }
 
-            int textLength = (int)strlen(text);     // Get current text length
+            int textLength = textBoxCacheLength;    // Get current text length (cached)
             int codepoint = GetCharPressed();       // Get Unicode codepoint
             if (multiline && IsKeyPressed(KEY_ENTER)) codepoint = (int)'\n';
 
@@ -2537,6 +2926,8 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
                 // Add new codepoint in current cursor position
                 for (int i = 0; i < codepointSize; i++) text[textBoxCursorIndex + i] = charEncoded[i];
 
+                TextBoxCacheInsert(textBoxCursorIndex, codepointSize, codepoint);
+
                 textBoxCursorIndex += codepointSize;
                 textLength += codepointSize;
 
@@ -2563,7 +2954,9 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
                     // Move backward text from cursor position
                     for (int i = textBoxCursorIndex; i < textLength; i++) text[i] = text[i + nextCodepointSize];
 
-                    textLength -= codepointSize;
+                    TextBoxCacheRemove(textBoxCursorIndex, nextCodepointSize);
+
+                    textLength -= nextCodepointSize;
 
                     // Make sure text last character is EOL
                     text[textLength] = '\0';
@@ -2583,11 +2976,13 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
                     // Move backward text from cursor position
                     for (int i = (textBoxCursorIndex - prevCodepointSize); i < textLength; i++) text[i] = text[i + prevCodepointSize];
 
+                    if (textBoxCursorIndex > 0) TextBoxCacheRemove(textBoxCursorIndex - prevCodepointSize, prevCodepointSize);
+
                     // Prevent cursor index from decrementing past 0
                     if (textBoxCursorIndex > 0)
                     {
-                        textBoxCursorIndex -= codepointSize;
-                        textLength -= codepointSize;
+                        textBoxCursorIndex -= prevCodepointSize;
+                        textLength -= prevCodepointSize;
                     }
 
                     // Make sure text last character is EOL
@@ -2622,41 +3017,23 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
             }
 
             // Move cursor position with mouse
-            if (CheckCollisionPointRec(mousePosition, textBounds))     // Mouse hover text
+            if (GuiCheckHover(mousePosition, textBounds))     // Mouse hover text
             {
-                float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
-                int codepoint = 0;
-                int codepointSize = 0;
-                int codepointIndex = 0;
-                float glyphWidth = 0.0f;
-                float widthToMouseX = 0;
-                int mouseCursorIndex = 0;
-
-                for (int i = textIndexOffset; i < textLength; i++)
-                {
-                    codepoint = GetCodepointNext(&text[i], &codepointSize);
-                    codepointIndex = GetGlyphIndex(guiFont, codepoint);
+                // Look for the codepoint under mouse, cursor is placed before or after it depending on glyph half
+                float widthToMouseX = mousePosition.x - textBounds.x + textBoxAdvances[textIndexOffset];
+                int mouseCursorIndex = GetTextBoxCacheIndex(widthToMouseX);
 
-                    if (guiFont.glyphs[codepointIndex].advanceX == 0) glyphWidth = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
-                    else glyphWidth = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+                if (mouseCursorIndex < textIndexOffset) mouseCursorIndex = textIndexOffset;
+                else if (mouseCursorIndex < textBoxCacheLength)
+                {
+                    int nextCodepointSize = 0;
+                    GetCodepointNext(text + mouseCursorIndex, &nextCodepointSize);
 
-                    if (mousePosition.x <= (textBounds.x + (widthToMouseX + glyphWidth/2)))
-                    {
-                        mouseCursor.x = textBounds.x + widthToMouseX;
-                        mouseCursorIndex = i;
-                        break;
-                    }
-                    
-                    widthToMouseX += (glyphWidth + (float)GuiGetStyle(DEFAULT, TEXT_SPACING));
+                    float glyphWidth = textBoxAdvances[mouseCursorIndex + nextCodepointSize] - textBoxAdvances[mouseCursorIndex] - (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+                    if (widthToMouseX > (textBoxAdvances[mouseCursorIndex] + glyphWidth/2)) mouseCursorIndex += nextCodepointSize;
                 }
 
-                // Check if mouse cursor is at the last position
-                int textEndWidth = GetTextWidth(text + textIndexOffset);
-                if (GetMousePosition().x >= (textBounds.x + textEndWidth - glyphWidth/2))
-                {
-                    mouseCursor.x = textBounds.x + textEndWidth;
-                    mouseCursorIndex = strlen(text);
-                }
+                mouseCursor.x = textBounds.x + textBoxAdvances[mouseCursorIndex] - textBoxAdvances[textIndexOffset];
 
                 // Place cursor at required index on mouse click
                 if ((mouseCursor.x >= 0) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
@@ -2668,12 +3045,13 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
             else mouseCursor.x = -1;
 
             // Recalculate cursor position.y depending on textBoxCursorIndex
-            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + GetTextWidth(text + textIndexOffset) - GetTextWidth(text + textBoxCursorIndex) + GuiGetStyle(DEFAULT, TEXT_SPACING);
+            if (textBoxCursorIndex > textBoxCacheLength) textBoxCursorIndex = textBoxCacheLength;
+            cursor.x = bounds.x + GuiGetStyle(TEXTBOX, TEXT_PADDING) + textBoxAdvances[textBoxCursorIndex] - textBoxAdvances[textIndexOffset] + GuiGetStyle(DEFAULT, TEXT_SPACING);
             //if (multiline) cursor.y = GetTextLines()
 
             // Finish text editing on ENTER or mouse click outside bounds
             if ((!multiline && IsKeyPressed(KEY_ENTER)) ||
-                (!CheckCollisionPointRec(mousePosition, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)))
+                (!GuiCheckHover(mousePosition, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)))
             {
                 textBoxCursorIndex = 0;     // GLOBAL: Reset the shared cursor index
                 result = 1;
@@ -2681,7 +3059,7 @@ int GuiTextBox(Rectangle bounds, char *text, int bufferSize, bool editMode)
         }
         else
         {
-            if (CheckCollisionPointRec(mousePosition, bounds))
+            if (GuiCheckHover(mousePosition, bounds))
             {
                 state = STATE_FOCUSED;
 
@@ -2778,7 +3156,7 @@ int GuiSpinner(Rectangle bounds, const char *text, int *value, int minValue, int
         Vector2 mousePoint = GetMousePosition();
 
         // Check spinner state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -2892,14 +3270,14 @@ int GuiValueBox(Rectangle bounds, const char *text, int *value, int minValue, in
             //if (*value > maxValue) *value = maxValue;
             //else if (*value < minValue) *value = minValue;
 
-            if (IsKeyPressed(KEY_ENTER) || (!CheckCollisionPointRec(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))) result = 1;
+            if (IsKeyPressed(KEY_ENTER) || (!GuiCheckHover(mousePoint, bounds) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))) result = 1;
         }
         else
         {
             if (*value > maxValue) *value = maxValue;
             else if (*value < minValue) *value = minValue;
 
-            if (CheckCollisionPointRec(mousePoint, bounds))
+            if (GuiCheckHover(mousePoint, bounds))
             {
                 state = STATE_FOCUSED;
                 if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) result = 1;
@@ -2982,7 +3360,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
                 guiSliderActive = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
             }
         }
-        else if (CheckCollisionPointRec(mousePoint, bounds))
+        else if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -2990,7 +3368,7 @@ int GuiSliderPro(Rectangle bounds, const char *textLeft, const char *textRight,
                 guiSliderDragging = true;
                 guiSliderActive = bounds; // Store bounds as an identifier when dragging starts
 
-                if (!CheckCollisionPointRec(mousePoint, slider))
+                if (!GuiCheckHover(mousePoint, slider))
                 {
                     // Get equivalent value and slider position from mousePosition.x
                     *value = ((maxValue - minValue)*(mousePoint.x - (float)(bounds.x + sliderWidth/2)))/(float)(bounds.width - sliderWidth) + minValue;
@@ -3173,7 +3551,7 @@ int GuiDummyRec(Rectangle bounds, const char *text)
         Vector2 mousePoint = GetMousePosition();
 
         // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -3240,14 +3618,14 @@ int GuiListViewEx(Rectangle bounds, const char **text, int count, int *scrollInd
         Vector2 mousePoint = GetMousePosition();
 
         // Check mouse inside list view
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             state = STATE_FOCUSED;
 
             // Check focused and selected item
             for (int i = 0; i < visibleItems; i++)
             {
-                if (CheckCollisionPointRec(mousePoint, itemBounds))
+                if (GuiCheckHover(mousePoint, itemBounds))
                 {
                     itemFocused = startIndex + i;
                     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
@@ -3379,7 +3757,7 @@ int GuiColorPanel(Rectangle bounds, const char *text, Color *color)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -3468,7 +3846,7 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
                 guiSliderActive = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
             }
         }
-        else if (CheckCollisionPointRec(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
+        else if (GuiCheckHover(mousePoint, bounds) || GuiCheckHover(mousePoint, selector))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -3492,6 +3870,14 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
     // Draw alpha bar: checked background
     if (state != STATE_DISABLED)
     {
+#if !defined(RAYGUI_STANDALONE)
+        // Checked background and alpha gradient are baked together, drawn as a single quad
+        if (GuiCheckRedrawRec(bounds))
+        {
+            Texture2D background = GuiGetBakedTexture(GUI_BAKED_ALPHABAR, (int)bounds.width, (int)bounds.height, GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED), GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED));
+            DrawTexturePro(background, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)background.width, (float)background.height }, bounds, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, Fade(WHITE, guiAlpha));
+        }
+#else
         int checksX = (int)bounds.width/RAYGUI_COLORBARALPHA_CHECKED_SIZE;
         int checksY = (int)bounds.height/RAYGUI_COLORBARALPHA_CHECKED_SIZE;
 
@@ -3505,6 +3891,7 @@ int GuiColorBarAlpha(Rectangle bounds, const char *text, float *alpha)
         }
 
         DrawRectangleGradientEx(bounds, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, RAYGUI_CLITERAL(Color){ 255, 255, 255, 0 }, Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 0, 255 }, guiAlpha));
+#endif
     }
     else DrawRectangleGradientEx(bounds, Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
 
@@ -3554,7 +3941,7 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
                 guiSliderActive = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
             }
         }
-        else if (CheckCollisionPointRec(mousePoint, bounds) || CheckCollisionPointRec(mousePoint, selector))
+        else if (GuiCheckHover(mousePoint, bounds) || GuiCheckHover(mousePoint, selector))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -3588,6 +3975,14 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
     if (state != STATE_DISABLED)
     {
         // Draw hue bar:color bars
+#if !defined(RAYGUI_STANDALONE)
+        // Hue gradient only changes vertically, baked as a 1 pixel width texture stretched to bounds
+        if (GuiCheckRedrawRec(bounds))
+        {
+            Texture2D background = GuiGetBakedTexture(GUI_BAKED_HUEBAR, 1, (int)bounds.height, 0, 0);
+            DrawTexturePro(background, RAYGUI_CLITERAL(Rectangle){ 0, 0, (float)background.width, (float)background.height }, bounds, RAYGUI_CLITERAL(Vector2){ 0, 0 }, 0.0f, Fade(WHITE, guiAlpha));
+        }
+#else
         // TODO: Use directly DrawRectangleGradientEx(bounds, color1, color2, color2, color1);
         DrawRectangleGradientV((int)bounds.x, (int)(bounds.y), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha));
         DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + bounds.height/6), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 255, 0, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 0, 255 }, guiAlpha));
@@ -3595,6 +3990,7 @@ int GuiColorBarHue(Rectangle bounds, const char *text, float *hue)
         DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 3*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 255, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha));
         DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 4*(bounds.height/6)), (int)bounds.width, (int)ceilf(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 0, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha));
         DrawRectangleGradientV((int)bounds.x, (int)(bounds.y + 5*(bounds.height/6)), (int)bounds.width, (int)(bounds.height/6), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 255, 255 }, guiAlpha), Fade(RAYGUI_CLITERAL(Color){ 255, 0, 0, 255 }, guiAlpha));
+#endif
     }
     else DrawRectangleGradientV((int)bounds.x, (int)bounds.y, (int)bounds.width, (int)bounds.height, Fade(Fade(GetColor(GuiGetStyle(COLORPICKER, BASE_COLOR_DISABLED)), 0.1f), guiAlpha), Fade(GetColor(GuiGetStyle(COLORPICKER, BORDER_COLOR_DISABLED)), guiAlpha));
 
@@ -3693,7 +4089,7 @@ int GuiColorPanelHSV(Rectangle bounds, const char *text, Vector3 *colorHsv)
     {
         Vector2 mousePoint = GetMousePosition();
 
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
             {
@@ -3904,7 +4300,7 @@ int GuiGrid(Rectangle bounds, const char *text, float spacing, int subdivs, Vect
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked && !guiSliderDragging)
     {
-        if (CheckCollisionPointRec(mousePoint, bounds))
+        if (GuiCheckHover(mousePoint, bounds))
         {
             // NOTE: Cell values must be the upper left of the cell the mouse is in
             currentMouseCell.x = floorf((mousePoint.x - bounds.x)/spacing);
@@ -4023,8 +4419,8 @@ void GuiLoadStyle(const char *fileName)
                             // In case a font is already loaded and it is not default internal font, unload it
                             if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
 
-                            if (codepointCount > 0) font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
-                            else font = LoadFontEx(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
+                            if (codepointCount > 0) font = RAYGUI_LOAD_FONT(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, codepoints, codepointCount);
+                            else font = RAYGUI_LOAD_FONT(TextFormat("%s/%s", GetDirectoryPath(fileName), fontFileName), fontSize, NULL, 0);   // Default to 95 standard codepoints
                         }
 
                         // If font texture not properly loaded, revert to default font and size/spacing
@@ -4083,6 +4479,11 @@ void GuiLoadStyleDefault(void)
     // when calling GuiSetStyle() and GuiGetStyle()
     guiStyleLoaded = true;
 
+#if !defined(RAYGUI_NO_ICONS)
+    // Restore icons replaced by previous style (if any)
+    if (guiIconsBaseSaved) memcpy(guiIconsPtr, guiIconsBase, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+#endif
+
     // Initialize default LIGHT style property values
     // WARNING: Default value are applied to all controls on set but
     // they can be overwritten later on for every custom control
@@ -4110,6 +4511,7 @@ void GuiLoadStyleDefault(void)
     GuiSetStyle(DEFAULT, BACKGROUND_COLOR, 0xf5f5f5ff); // DEFAULT specific property
     GuiSetStyle(DEFAULT, TEXT_LINE_SPACING, 15);        // DEFAULT, 15 pixels between lines
     GuiSetStyle(DEFAULT, TEXT_ALIGNMENT_VERTICAL, TEXT_ALIGN_MIDDLE);   // DEFAULT, text aligned vertically to middle of text-bounds
+    GuiSetStyle(DEFAULT, TEXT_FONT_FACE, 0);            // DEFAULT, main font face
 
     // Initialize control-specific property values
     // NOTE: Those properties are in default list but require specific values by control type
@@ -4160,6 +4562,17 @@ void GuiLoadStyleDefault(void)
     GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_HEIGHT, 8);
     GuiSetStyle(COLORPICKER, HUEBAR_SELECTOR_OVERFLOW, 2);
 
+    // Unload previous font faces data
+    // NOTE: Faces share main font atlas texture, only recs/glyphs are owned
+    for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++)
+    {
+        RL_FREE(guiFontFaces[i].recs);
+        RL_FREE(guiFontFaces[i].glyphs);
+        guiFontFaces[i] = RAYGUI_CLITERAL(Font){ 0 };
+    }
+
+    guiFont = guiFontFaces[0];
+
     if (guiFont.texture.id != GetFontDefault().texture.id)
     {
         // Unload previous font texture
@@ -4171,6 +4584,7 @@ void GuiLoadStyleDefault(void)
 
         // Setup default raylib font
         guiFont = GetFontDefault();
+        guiFontFaces[0] = guiFont;
 
         // NOTE: Default raylib font character 95 is a white square
         Rectangle whiteChar = guiFont.recs[95];
@@ -4180,6 +4594,39 @@ void GuiLoadStyleDefault(void)
     }
 }
 
+#if !defined(RAYGUI_STANDALONE)
+// Load font atlas texture from image
+// NOTE: Block compressed atlas (DXT5/ETC2_EAC) is uploaded directly if supported by GPU,
+// otherwise its alpha blocks are decoded on CPU and uploaded as GRAY+ALPHA
+Texture2D GuiLoadFontAtlasTexture(Image atlas)
+{
+    Texture2D texture = { 0 };
+
+    if ((atlas.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) || (atlas.format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))
+    {
+#if !defined(RAYGUI_FONT_ATLAS_DECODE)
+        // NOTE: Texture loading fails (id = 0) if compressed format is not supported by GPU
+        texture = LoadTextureFromImage(atlas);
+#endif
+        if (texture.id == 0)
+        {
+            Image imDecoded = { 0 };
+            imDecoded.data = RAYGUI_DECODE_FONT_ATLAS((const unsigned char *)atlas.data, atlas.width, atlas.height, atlas.format);
+            imDecoded.width = atlas.width;
+            imDecoded.height = atlas.height;
+            imDecoded.mipmaps = 1;
+            imDecoded.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+            if (imDecoded.data != NULL) texture = LoadTextureFromImage(imDecoded);
+            RAYGUI_FREE(imDecoded.data);
+        }
+    }
+    else texture = LoadTextureFromImage(atlas);
+
+    return texture;
+}
+#endif
+
 // Get text with icon id prepended
 // NOTE: Useful to add icons by name id (enum) instead of
 // a number that can change between ricon versions
@@ -4217,6 +4664,11 @@ const char *GuiIconText(int iconId, const char *text)
 // Get full icons data pointer
 unsigned int *GuiGetIcons(void) { return guiIconsPtr; }
 
+// Set full icons data pointer
+// NOTE: Provided array must contain RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS values,
+// it allows switching between several icons sets without copying data
+void GuiSetIcons(unsigned int *icons) { guiIconsPtr = (icons != NULL)? icons : guiIcons; }
+
 // Load raygui icons file (.rgi)
 // NOTE: In case nameIds are required, they can be requested with loadIconsName,
 // they are returned as a guiIconsName[iconCount][RAYGUI_ICON_MAX_NAME_LENGTH],
@@ -4296,6 +4748,8 @@ void GuiDrawIcon(int iconId, int posX, int posY, int pixelSize, Color color)
 {
     #define BIT_CHECK(a,b) ((a) & (1u<<(b)))
 
+    if (!GuiCheckRedrawRec(RAYGUI_CLITERAL(Rectangle){ (float)posX, (float)posY, (float)RAYGUI_ICON_SIZE*pixelSize, (float)RAYGUI_ICON_SIZE*pixelSize })) return;
+
     for (int i = 0, y = 0; i < RAYGUI_ICON_SIZE*RAYGUI_ICON_SIZE/32; i++)
     {
         for (int k = 0; k < 32; k++)
@@ -4329,55 +4783,120 @@ void GuiSetIconScale(int scale)
 static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
 {
     unsigned char *fileDataPtr = (unsigned char *)fileData;
+    const unsigned char *fileDataEnd = fileData + dataSize;
 
     char signature[5] = { 0 };
     short version = 0;
     short reserved = 0;
     int propertyCount = 0;
 
+    if (dataSize < 12) return;
+
     memcpy(signature, fileDataPtr, 4);
     memcpy(&version, fileDataPtr + 4, sizeof(short));
     memcpy(&reserved, fileDataPtr + 4 + 2, sizeof(short));
     memcpy(&propertyCount, fileDataPtr + 4 + 2 + 2, sizeof(int));
     fileDataPtr += 12;
 
+    // NOTE: Versions newer than 410 (compact properties encoding) are not supported
     if ((signature[0] == 'r') &&
         (signature[1] == 'G') &&
         (signature[2] == 'S') &&
-        (signature[3] == ' '))
+        (signature[3] == ' ') &&
+        (version <= 410))
     {
         short controlId = 0;
         short propertyId = 0;
         unsigned int propertyValue = 0;
 
+        // Check properties encoding, defined by header reserved flags (version 410 required)
+        // NOTE: Compact encoding (flag 0x01) stores a colors dictionary followed by
+        // properties as [1 byte: controlId << 4 | propertyId & 0x0f][varint: payload << 2 | extended << 1 | dictionary]
+        // where payload is a colors dictionary index or a zigzag-encoded value
+        bool compactProps = ((version >= 410) && ((reserved & 0x01) != 0));
+        unsigned int colorCount = 0;
+        unsigned int *colors = NULL;
+        bool truncated = false;
+
+        if (compactProps)
+        {
+            unsigned long long count = GuiReadVarint((const unsigned char **)&fileDataPtr, fileDataEnd);
+
+            // Colors dictionary must fit in remaining data
+            if ((fileDataPtr == NULL) || (count > (unsigned long long)((fileDataEnd - fileDataPtr)/4))) return;
+
+            colorCount = (unsigned int)count;
+            colors = (unsigned int *)RAYGUI_CALLOC(colorCount + 1, sizeof(unsigned int));
+
+            for (unsigned int i = 0; i < colorCount; i++)
+            {
+                memcpy(&colors[i], fileDataPtr, sizeof(unsigned int));
+                fileDataPtr += 4;
+            }
+        }
+
         for (int i = 0; i < propertyCount; i++)
         {
-            memcpy(&controlId, fileDataPtr, sizeof(short));
-            memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
-            memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
-            fileDataPtr += 8;
+            if (compactProps)
+            {
+                if (fileDataPtr >= fileDataEnd) { truncated = true; break; }
+
+                unsigned char ids = fileDataPtr[0];
+                fileDataPtr += 1;
+                unsigned long long code = GuiReadVarint((const unsigned char **)&fileDataPtr, fileDataEnd);
+                if (fileDataPtr == NULL) { truncated = true; break; }
+
+                controlId = (short)(ids >> 4);
+                propertyId = (short)((ids & 0x0f) + ((code & 0x02)? RAYGUI_MAX_PROPS_BASE : 0));
+
+                if (code & 0x01) propertyValue = ((code >> 2) < colorCount)? colors[code >> 2] : 0;
+                else
+                {
+                    unsigned int zigzag = (unsigned int)(code >> 2);
+                    propertyValue = (zigzag >> 1) ^ (0u - (zigzag & 1));
+                }
+            }
+            else
+            {
+                if ((fileDataPtr + 8) > fileDataEnd) { truncated = true; break; }
+
+                memcpy(&controlId, fileDataPtr, sizeof(short));
+                memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
+                memcpy(&propertyValue, fileDataPtr + 2 + 2, sizeof(unsigned int));
+                fileDataPtr += 8;
+            }
+
+            // Skip properties out of style range (corrupted data)
+            if ((controlId < 0) || (controlId >= RAYGUI_MAX_CONTROLS) ||
+                (propertyId < 0) || (propertyId >= (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED))) continue;
 
             if (controlId == 0) // DEFAULT control
             {
-                // If a DEFAULT property is loaded, it is propagated to all controls
+                // If a DEFAULT property is loaded, it is propagated to all controls (by GuiSetStyle())
                 // NOTE: All DEFAULT properties should be defined first in the file
                 GuiSetStyle(0, (int)propertyId, propertyValue);
-
-                if (propertyId < RAYGUI_MAX_PROPS_BASE) for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++) GuiSetStyle(i, (int)propertyId, propertyValue);
             }
             else GuiSetStyle((int)controlId, (int)propertyId, propertyValue);
         }
 
+        RAYGUI_FREE(colors);
+
+        // Truncated properties data, font and chunks can not be located
+        if (truncated) return;
+
         // Font loading is highly dependant on raylib API to load font data and image
 
 #if !defined(RAYGUI_STANDALONE)
         // Load custom font if available
         int fontDataSize = 0;
+        if ((fileDataPtr + 4) > fileDataEnd) return;
         memcpy(&fontDataSize, fileDataPtr, sizeof(int));
         fileDataPtr += 4;
 
         if (fontDataSize > 0)
         {
+            RAYGUI_TRACE_BEGIN("font decode");
+
             Font font = { 0 };
             int fontType = 0;   // 0-Normal, 1-SDF
 
@@ -4429,7 +4948,7 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
             }
 
             if (font.texture.id != GetFontDefault().texture.id) UnloadTexture(font.texture);
-            font.texture = LoadTextureFromImage(imFont);
+            font.texture = GuiLoadFontAtlasTexture(imFont);
 
             RAYGUI_FREE(imFont.data);
 
@@ -4541,10 +5060,377 @@ static void GuiLoadStyleFromMemory(const unsigned char *fileData, int dataSize)
                 (fontWhiteRec.y > 0) &&
                 (fontWhiteRec.width > 0) &&
                 (fontWhiteRec.height > 0)) SetShapesTexture(font.texture, fontWhiteRec);
+
+            RAYGUI_TRACE_END();
+        }
+
+        // Load style extension chunks (if available), placed after font data
+        // NOTE: Every chunk is defined as [4 bytes id][int size][size bytes of data],
+        // unknown chunks are skipped and older loaders just ignore the trailing data
+        while ((fileDataPtr + 8) <= (fileData + dataSize))
+        {
+            char chunkId[5] = { 0 };
+            int chunkSize = 0;
+
+            memcpy(chunkId, fileDataPtr, 4);
+            memcpy(&chunkSize, fileDataPtr + 4, sizeof(int));
+            fileDataPtr += 8;
+
+            if ((chunkSize < 0) || ((fileDataPtr + chunkSize) > (fileData + dataSize))) break;
+
+            if (memcmp(chunkId, "FNTF", 4) == 0) GuiLoadStyleFontFaces(fileDataPtr, chunkSize);
+#if !defined(RAYGUI_NO_ICONS)
+            else if (memcmp(chunkId, "ICNS", 4) == 0) GuiLoadStyleIcons(fileDataPtr, chunkSize);
+#endif
+
+            fileDataPtr += chunkSize;
+        }
+#endif
+    }
+}
+
+// Resolve style DEFAULT base properties pending propagation
+// NOTE: Only controls not overriding the property are updated
+static void GuiResolveStyle(void)
+{
+    for (int property = 0; (property < RAYGUI_MAX_PROPS_BASE) && (guiStylePending != 0); property++)
+    {
+        if (guiStylePending & (1u << property))
+        {
+            for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+            {
+                if (!(guiStyleOverrides[property] & (1u << i))) guiStylePtr[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + property] = guiStylePtr[property];
+            }
+
+            guiStylePending &= ~(1u << property);
+        }
+    }
+}
+
+// Read variable-length integer (LEB128) and move data pointer
+// NOTE: Used by compact style properties encoding, 7 bits per byte, up to 10 bytes
+// WARNING: Data pointer is set to NULL if dataEnd is reached before last byte
+static unsigned long long GuiReadVarint(const unsigned char **data, const unsigned char *dataEnd)
+{
+    unsigned long long value = 0;
+
+    for (int i = 0, shift = 0; i < 10; i++, shift += 7)
+    {
+        if (*data >= dataEnd) { *data = NULL; return 0; }
+
+        unsigned char byte = (*data)[0];
+        *data += 1;
+
+        value |= ((unsigned long long)(byte & 0x7f) << shift);
+        if ((byte & 0x80) == 0) break;
+    }
+
+    return value;
+}
+
+// Update current font with selected face (DEFAULT TEXT_FONT_FACE)
+// NOTE: Face selection just swaps current font glyphs data, atlas texture is shared;
+// faces not available or not sharing main font atlas texture (main font replaced) fallback to main font
+static void GuiUpdateFontFace(void)
+{
+    int face = guiStylePtr[TEXT_FONT_FACE];
+
+    if ((face > 0) && (face < RAYGUI_MAX_FONT_FACES) && (guiFontFaces[face].texture.id > 0) &&
+        (guiFontFaces[face].texture.id == guiFontFaces[0].texture.id)) guiFont = guiFontFaces[face];
+    else guiFont = guiFontFaces[0];
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Load style font faces from memory (FNTF chunk)
+// NOTE: Faces glyphs are placed on main font atlas, so they share its texture
+static void GuiLoadStyleFontFaces(const unsigned char *chunkData, int chunkSize)
+{
+    // Font faces chunk structure (FNTF)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | int        | Faces count (N)
+    // foreach (face)
+    // {
+    //   ...   | 4       | int        | Face id (1..RAYGUI_MAX_FONT_FACES-1)
+    //   ...   | 4       | int        | Face base size
+    //   ...   | 4       | int        | Face glyph count (G)
+    //   ...   | 4       | int        | Recs data compressed size (0 if not compressed)
+    //   ...   | G*16    | Rectangle  | Recs data (or compressed size)
+    //   ...   | 4       | int        | Glyphs data compressed size (0 if not compressed)
+    //   ...   | G*16    | int        | Glyphs data: value, offsetX, offsetY, advanceX (or compressed size)
+    // }
+
+    // NOTE: Faces data is allocated with raylib allocator (same as DecompressData() and UnloadFont()),
+    // all sizes are checked against chunk remaining bytes, face is dropped on any size mismatch
+
+    const unsigned char *chunkDataPtr = chunkData;
+    const unsigned char *chunkDataEnd = chunkData + chunkSize;
+    int faceCount = 0;
+
+    // Faces are only valid over a loaded font atlas
+    if ((guiFontFaces[0].texture.id == 0) || (guiFontFaces[0].texture.id == GetFontDefault().texture.id)) return;
+    if (chunkSize < 4) return;
+
+    memcpy(&faceCount, chunkDataPtr, sizeof(int));
+    chunkDataPtr += 4;
+
+    for (int f = 0; f < faceCount; f++)
+    {
+        if ((chunkDataEnd - chunkDataPtr) < 16) break;
+
+        Font face = { 0 };
+        int faceId = 0;
+        int recsDataCompSize = 0;
+        int glyphsDataCompSize = 0;
+        bool faceValid = true;
+
+        memcpy(&faceId, chunkDataPtr, sizeof(int));
+        memcpy(&face.baseSize, chunkDataPtr + 4, sizeof(int));
+        memcpy(&face.glyphCount, chunkDataPtr + 8, sizeof(int));
+        memcpy(&recsDataCompSize, chunkDataPtr + 12, sizeof(int));
+        chunkDataPtr += 16;
+
+        // Glyph count bounded to avoid data size overflow, data sizes are checked later
+        if ((face.glyphCount <= 0) || (face.glyphCount > (int)(0x7fffffff/sizeof(GlyphInfo)))) break;
+
+        // Load face recs data
+        int recsDataSize = face.glyphCount*sizeof(Rectangle);
+
+        if (recsDataCompSize > 0)
+        {
+            if (recsDataCompSize > (chunkDataEnd - chunkDataPtr)) break;
+
+            int recsDataUncompSize = 0;
+            face.recs = (Rectangle *)DecompressData(chunkDataPtr, recsDataCompSize, &recsDataUncompSize);
+            chunkDataPtr += recsDataCompSize;
+
+            // Security check, data uncompressed size must match the expected original data size
+            if ((face.recs == NULL) || (recsDataUncompSize != recsDataSize))
+            {
+                RAYGUI_LOG("WARNING: Uncompressed font face recs data could be corrupted");
+                faceValid = false;
+            }
+        }
+        else
+        {
+            if (recsDataSize > (chunkDataEnd - chunkDataPtr)) break;
+
+            face.recs = (Rectangle *)RL_CALLOC(face.glyphCount, sizeof(Rectangle));
+            memcpy(face.recs, chunkDataPtr, recsDataSize);
+            chunkDataPtr += recsDataSize;
+        }
+
+        // Load face glyphs info data
+        int glyphsDataSize = face.glyphCount*16;    // 16 bytes data per glyph
+        unsigned char *glyphsData = NULL;
+
+        if ((chunkDataEnd - chunkDataPtr) < 4) { RL_FREE(face.recs); break; }
+
+        memcpy(&glyphsDataCompSize, chunkDataPtr, sizeof(int));
+        chunkDataPtr += 4;
+
+        if (glyphsDataCompSize > 0)
+        {
+            if (glyphsDataCompSize > (chunkDataEnd - chunkDataPtr)) { RL_FREE(face.recs); break; }
+
+            int glyphsDataUncompSize = 0;
+            glyphsData = DecompressData(chunkDataPtr, glyphsDataCompSize, &glyphsDataUncompSize);
+            chunkDataPtr += glyphsDataCompSize;
+
+            // Security check, data uncompressed size must match the expected original data size
+            if ((glyphsData == NULL) || (glyphsDataUncompSize != glyphsDataSize))
+            {
+                RAYGUI_LOG("WARNING: Uncompressed font face glyphs data could be corrupted");
+                faceValid = false;
+            }
+        }
+        else
+        {
+            if (glyphsDataSize > (chunkDataEnd - chunkDataPtr)) { RL_FREE(face.recs); break; }
+
+            glyphsData = (unsigned char *)chunkDataPtr;
+            chunkDataPtr += glyphsDataSize;
+        }
+
+        if (faceValid)
+        {
+            face.glyphs = (GlyphInfo *)RL_CALLOC(face.glyphCount, sizeof(GlyphInfo));
+
+            for (int i = 0; i < face.glyphCount; i++)
+            {
+                memcpy(&face.glyphs[i].value, glyphsData + i*16, sizeof(int));
+                memcpy(&face.glyphs[i].offsetX, glyphsData + i*16 + 4, sizeof(int));
+                memcpy(&face.glyphs[i].offsetY, glyphsData + i*16 + 8, sizeof(int));
+                memcpy(&face.glyphs[i].advanceX, glyphsData + i*16 + 12, sizeof(int));
+            }
+        }
+
+        if (glyphsDataCompSize > 0) RL_FREE(glyphsData);
+
+        face.texture = guiFontFaces[0].texture;
+
+        if (faceValid && (faceId > 0) && (faceId < RAYGUI_MAX_FONT_FACES))
+        {
+            // Release previously loaded face data, replaced by the new one
+            // NOTE: Faces shared with other owners are expected to be cleared before loading a style
+            RL_FREE(guiFontFaces[faceId].recs);
+            RL_FREE(guiFontFaces[faceId].glyphs);
+            guiFontFaces[faceId] = RAYGUI_CLITERAL(Font){ 0 };
+
+            GuiSetFontFace(faceId, face);
+        }
+        else
+        {
+            if (faceValid) RAYGUI_LOG("WARNING: Font face id not supported");
+            RL_FREE(face.recs);
+            RL_FREE(face.glyphs);
+        }
+    }
+}
+
+#if defined(RAYGUI_DECODE_FONT_ATLAS_INTERNAL)
+// Decode block compressed font atlas alpha into GRAY+ALPHA data
+// NOTE: Only alpha blocks are decoded (BC4 on DXT5, EAC on ETC2_EAC), font atlas color is always white
+static unsigned char *GuiDecodeFontAtlasBlocks(const unsigned char *blocks, int width, int height, int format)
+{
+    if ((blocks == NULL) || ((format != PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (format != PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))) return NULL;
+
+    unsigned char *data = (unsigned char *)RAYGUI_CALLOC(width*height*2, 1);
+    int blocksX = (width + 3)/4;
+    int blocksY = (height + 3)/4;
+
+    for (int by = 0; by < blocksY; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            // NOTE: Every block is 16 bytes: alpha block (8 bytes) followed by color block (8 bytes)
+            const unsigned char *block = blocks + (by*blocksX + bx)*16;
+            unsigned char alpha[16] = { 0 };    // Block alpha values, row-major order
+            unsigned long long bits = 0;
+
+            if (format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)
+            {
+                // BC4: two endpoints and 3-bit indices (little-endian, row-major)
+                unsigned char palette[8] = { block[0], block[1], 0 };
+
+                if (block[0] > block[1]) for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*block[0] + i*block[1] + 3)/7);
+                else
+                {
+                    for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*block[0] + i*block[1] + 2)/5);
+                    palette[6] = 0;
+                    palette[7] = 255;
+                }
+
+                for (int i = 0; i < 6; i++) bits |= ((unsigned long long)block[2 + i] << (8*i));
+                for (int i = 0; i < 16; i++) alpha[i] = palette[(bits >> (3*i)) & 0x07];
+            }
+            else
+            {
+                // EAC: base, multiplier and modifiers table, 3-bit indices (big-endian, column-major)
+                int base = block[0];
+                int multiplier = block[1] >> 4;
+                int table = block[1] & 0x0f;
+
+                for (int i = 0; i < 6; i++) bits = (bits << 8) | block[2 + i];
+                for (int i = 0; i < 16; i++)
+                {
+                    int value = base + guiEacModifiers[table][(bits >> (45 - 3*i)) & 0x07]*multiplier;
+                    alpha[(i%4)*4 + i/4] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+                }
+            }
+
+            for (int y = 0; (y < 4) && ((by*4 + y) < height); y++)
+            {
+                for (int x = 0; (x < 4) && ((bx*4 + x) < width); x++)
+                {
+                    int k = ((by*4 + y)*width + bx*4 + x)*2;
+                    data[k] = 255;
+                    data[k + 1] = alpha[y*4 + x];
+                }
+            }
+        }
+    }
+
+    return data;
+}
+#endif
+
+#if !defined(RAYGUI_NO_ICONS)
+// Load style icons from memory (ICNS chunk)
+// NOTE: Only icons that differ from default icons are stored, loaded over current icons set
+static void GuiLoadStyleIcons(const unsigned char *chunkData, int chunkSize)
+{
+    // Icons chunk structure (ICNS)
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 2       | short      | Icons size (S)
+    // 2       | 2       | short      | Icons count (N)
+    // 4       | 32      | bits       | Icons id map, one bit per icon id (RAYGUI_ICON_MAX_ICONS bits)
+    // 36      | 4       | int        | Icons data compressed size (0 if not compressed)
+    // 40      | N*S*S/8 | bits       | Icons data, one bit per pixel, in icon id order (or compressed size)
+
+    if (chunkSize < 40) return;
+
+    short iconSize = 0;
+    short iconCount = 0;
+    int iconsDataCompSize = 0;
+    const unsigned char *iconsMap = chunkData + 4;
+
+    memcpy(&iconSize, chunkData, sizeof(short));
+    memcpy(&iconCount, chunkData + 2, sizeof(short));
+    memcpy(&iconsDataCompSize, chunkData + 36, sizeof(int));
+
+    if (iconSize != RAYGUI_ICON_SIZE) { RAYGUI_LOG("WARNING: Style icons size not supported"); return; }
+
+    int iconsDataSize = iconCount*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int);
+    unsigned char *iconsData = (unsigned char *)chunkData + 40;
+
+    if (iconsDataCompSize > 0)
+    {
+        if ((40 + iconsDataCompSize) > chunkSize) return;
+
+        int iconsDataUncompSize = 0;
+        iconsData = DecompressData(chunkData + 40, iconsDataCompSize, &iconsDataUncompSize);
+
+        if (iconsDataUncompSize != iconsDataSize)
+        {
+            RAYGUI_LOG("WARNING: Uncompressed style icons data could be corrupted");
+            RAYGUI_FREE(iconsData);
+            return;
+        }
+    }
+    else if ((40 + iconsDataSize) > chunkSize) return;
+
+    GuiSaveIconsBase();
+
+    for (int i = 0, k = 0; (i < RAYGUI_ICON_MAX_ICONS) && (k < iconCount); i++)
+    {
+        if (iconsMap[i/8] & (1 << (i%8)))
+        {
+            memcpy(guiIconsPtr + i*RAYGUI_ICON_DATA_ELEMENTS, iconsData + k*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int), RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            k++;
         }
+    }
+
+    if (iconsDataCompSize > 0) RAYGUI_FREE(iconsData);
+}
 #endif
+#endif
+
+#if !defined(RAYGUI_NO_ICONS)
+// Save current icons set as base, to be restored by GuiLoadStyleDefault()
+// NOTE: Base is only saved once, before any style replaces icons
+static void GuiSaveIconsBase(void)
+{
+    if (!guiIconsBaseSaved)
+    {
+        memcpy(guiIconsBase, guiIconsPtr, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+        guiIconsBaseSaved = true;
     }
 }
+#endif
 
 // Gui get text width considering icon
 static int GetTextWidth(const char *text)
@@ -4608,6 +5494,111 @@ static int GetTextWidth(const char *text)
     return (int)textSize.x;
 }
 
+// Get codepoint advance using gui font and style, text spacing included
+// NOTE: Same metrics as GetTextWidth(), glyph index search is only done once per codepoint
+static float GetGlyphAdvance(int codepoint)
+{
+    float advance = 0.0f;
+
+    if (guiFont.texture.id > 0)
+    {
+        float scaleFactor = (float)GuiGetStyle(DEFAULT, TEXT_SIZE)/(float)guiFont.baseSize;
+        int codepointIndex = GetGlyphIndex(guiFont, codepoint);
+
+        if (guiFont.glyphs[codepointIndex].advanceX == 0) advance = ((float)guiFont.recs[codepointIndex].width*scaleFactor);
+        else advance = ((float)guiFont.glyphs[codepointIndex].advanceX*scaleFactor);
+
+        advance += (float)GuiGetStyle(DEFAULT, TEXT_SPACING);
+    }
+
+    return advance;
+}
+
+// Update text box prefix advance cache, rebuilt if not valid
+// NOTE: Cache is validated with text pointer, font/style metrics and text length (checking EOL position),
+// text modified externally keeping same length while editing is not detected
+static void UpdateTextBoxCache(const char *text, int bufferSize)
+{
+    bool valid = (text == textBoxCacheText) && (textBoxAdvances != NULL) && (bufferSize < textBoxCacheCapacity) &&
+        (guiFont.texture.id == textBoxCacheFont.texture.id) && (guiFont.glyphs == textBoxCacheFont.glyphs) &&
+        (GuiGetStyle(DEFAULT, TEXT_SIZE) == textBoxCacheTextSize) && (GuiGetStyle(DEFAULT, TEXT_SPACING) == textBoxCacheTextSpacing) &&
+        (text[textBoxCacheLength] == '\0') && ((textBoxCacheLength == 0) || (text[textBoxCacheLength - 1] != '\0'));
+
+    if (!valid)
+    {
+        if ((textBoxAdvances == NULL) || (bufferSize >= textBoxCacheCapacity))
+        {
+            RAYGUI_FREE(textBoxAdvances);
+            textBoxCacheCapacity = bufferSize + 1;
+            textBoxAdvances = (float *)RAYGUI_CALLOC(textBoxCacheCapacity, sizeof(float));
+        }
+
+        textBoxCacheText = text;
+        textBoxCacheFont = guiFont;
+        textBoxCacheTextSize = GuiGetStyle(DEFAULT, TEXT_SIZE);
+        textBoxCacheTextSpacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+        textBoxCacheLength = (int)strlen(text);
+        if (textBoxCacheLength >= textBoxCacheCapacity) textBoxCacheLength = textBoxCacheCapacity - 1;
+
+        // Measure every codepoint only once, bytes inside a codepoint get the advance after it
+        textBoxAdvances[0] = 0.0f;
+
+        for (int i = 0, codepointSize = 0; i < textBoxCacheLength; i += codepointSize)
+        {
+            int codepoint = GetCodepointNext(text + i, &codepointSize);
+            float advance = textBoxAdvances[i] + GetGlyphAdvance(codepoint);
+
+            for (int k = 1; (k <= codepointSize) && ((i + k) <= textBoxCacheLength); k++) textBoxAdvances[i + k] = advance;
+        }
+    }
+}
+
+// Update text box cache on codepoint insertion at byte index
+// NOTE: Advances after insertion are moved and displaced by codepoint advance, no text measuring required
+static void TextBoxCacheInsert(int index, int codepointSize, int codepoint)
+{
+    if ((textBoxAdvances == NULL) || ((textBoxCacheLength + codepointSize) >= textBoxCacheCapacity)) return;
+
+    float advance = GetGlyphAdvance(codepoint);
+
+    for (int i = textBoxCacheLength; i > index; i--) textBoxAdvances[i + codepointSize] = textBoxAdvances[i] + advance;
+    for (int k = 1; k <= codepointSize; k++) textBoxAdvances[index + k] = textBoxAdvances[index] + advance;
+
+    textBoxCacheLength += codepointSize;
+}
+
+// Update text box cache on codepoint deletion at byte index
+static void TextBoxCacheRemove(int index, int codepointSize)
+{
+    if ((textBoxAdvances == NULL) || ((index + codepointSize) > textBoxCacheLength)) return;
+
+    float advance = textBoxAdvances[index + codepointSize] - textBoxAdvances[index];
+
+    for (int i = index + codepointSize; i <= textBoxCacheLength; i++) textBoxAdvances[i - codepointSize] = textBoxAdvances[i] - advance;
+
+    textBoxCacheLength -= codepointSize;
+}
+
+// Get text box cache last codepoint index with prefix advance lower or equal than width (binary search)
+static int GetTextBoxCacheIndex(float width)
+{
+    int low = 0;
+    int high = textBoxCacheLength;
+
+    while (low < high)
+    {
+        int mid = (low + high + 1)/2;
+
+        if (textBoxAdvances[mid] <= width) low = mid;
+        else high = mid - 1;
+    }
+
+    // Make sure index is the start of a codepoint (not an UTF-8 continuation byte)
+    while ((low > 0) && ((textBoxCacheText[low] & 0xc0) == 0x80)) low--;
+
+    return low;
+}
+
 // Get text bounds considering control bounds
 static Rectangle GetTextBounds(int control, Rectangle bounds)
 {
@@ -4916,6 +5907,8 @@ static void GuiDrawText(const char *text, Rectangle textBounds, int alignment, C
 // Gui draw rectangle using default raygui plain style with borders
 static void GuiDrawRectangle(Rectangle rec, int borderWidth, Color borderColor, Color color)
 {
+    if (!GuiCheckRedrawRec(rec)) return;    // Skip drawing outside damaged rectangle (partial redraw)
+
     if (color.a > 0)
     {
         // Draw rectangle filled with color
@@ -4954,9 +5947,165 @@ static void GuiTooltip(Rectangle controlRec)
         GuiLabel(RAYGUI_CLITERAL(Rectangle){ controlRec.x, controlRec.y + controlRec.height + 4, textSize.x + 16, GuiGetStyle(DEFAULT, TEXT_SIZE) + 8.f }, guiTooltipPtr);
         GuiSetStyle(LABEL, TEXT_ALIGNMENT, textAlignment);
         GuiSetStyle(LABEL, TEXT_PADDING, textPadding);
+
+        // Tooltip is drawn outside control bounds, it could require a full redraw to appear/disappear
+        guiRedrawTooltip = true;
+        if (guiRedrawActive && (guiRedrawFullFrames == 0)) GuiRedrawAll();
     }
 }
 
+// Check point inside control bounds, bounds registered for partial redraw
+// NOTE: Controls check mouse hover with this function, registered bounds define areas that
+// could change on next frame just moving the mouse
+static bool GuiCheckHover(Vector2 point, Rectangle bounds)
+{
+    if (guiRedrawActive)
+    {
+        int count = guiRedrawRecsCount[guiRedrawRecsFrame];
+        Rectangle *recs = guiRedrawRecs[guiRedrawRecsFrame];
+
+        // Avoid registering same bounds consecutively (multiple checks by same control)
+        if ((count == 0) || (recs[count - 1].x != bounds.x) || (recs[count - 1].y != bounds.y) ||
+            (recs[count - 1].width != bounds.width) || (recs[count - 1].height != bounds.height))
+        {
+            if (count < RAYGUI_MAX_REDRAW_RECS)
+            {
+                recs[count] = bounds;
+                guiRedrawRecsCount[guiRedrawRecsFrame]++;
+            }
+            else GuiRedrawAll();    // Not enough space to track all controls, next frame fully redrawn
+        }
+    }
+
+    return CheckCollisionPointRec(point, bounds);
+}
+
+// Check rectangle intersects current frame redraw rectangle
+static bool GuiCheckRedrawRec(Rectangle rec)
+{
+    if (!guiRedrawActive) return true;
+
+    return ((rec.x < (guiRedrawRec.x + guiRedrawRec.width)) && ((rec.x + rec.width) > guiRedrawRec.x) &&
+            (rec.y < (guiRedrawRec.y + guiRedrawRec.height)) && ((rec.y + rec.height) > guiRedrawRec.y));
+}
+
+// Merge redraw rectangles, returns rectangle containing both
+// NOTE: Empty rectangles are ignored
+static Rectangle GuiMergeRedrawRec(Rectangle rec1, Rectangle rec2)
+{
+    if ((rec2.width <= 0) || (rec2.height <= 0)) return rec1;
+    if ((rec1.width <= 0) || (rec1.height <= 0)) return rec2;
+
+    float right = fmaxf(rec1.x + rec1.width, rec2.x + rec2.width);
+    float bottom = fmaxf(rec1.y + rec1.height, rec2.y + rec2.height);
+
+    Rectangle rec = { fminf(rec1.x, rec2.x), fminf(rec1.y, rec2.y), 0, 0 };
+    rec.width = right - rec.x;
+    rec.height = bottom - rec.y;
+
+    return rec;
+}
+
+#if !defined(RAYGUI_STANDALONE)
+// Get color control background baked texture, baked if not available
+// NOTE: Baked pixels reproduce the per-frame geometry previously drawn (same colors and blending),
+// resulting texture is drawn tinted by guiAlpha
+static Texture2D GuiGetBakedTexture(GuiBakedType type, int width, int height, int color1, int color2)
+{
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+
+    for (int i = 0; i < RAYGUI_MAX_BAKED_TEXTURES; i++)
+    {
+        if ((guiBakedTextures[i].type == type) && (guiBakedTextures[i].width == width) && (guiBakedTextures[i].height == height) &&
+            (guiBakedTextures[i].color1 == color1) && (guiBakedTextures[i].color2 == color2)) return guiBakedTextures[i].texture;
+    }
+
+    Image image = { 0 };
+    image.data = RAYGUI_CALLOC(width*height, sizeof(Color));
+    image.width = width;
+    image.height = height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    Color *pixels = (Color *)image.data;
+
+    if (type == GUI_BAKED_ALPHABAR)
+    {
+        // Checks (faded 0.4) only cover full check cells, alpha gradient (transparent white to black) blended on top
+        Color checks[2] = { GetColor(color2), GetColor(color1) };
+        int checksWidth = (width/RAYGUI_COLORBARALPHA_CHECKED_SIZE)*RAYGUI_COLORBARALPHA_CHECKED_SIZE;
+        int checksHeight = (height/RAYGUI_COLORBARALPHA_CHECKED_SIZE)*RAYGUI_COLORBARALPHA_CHECKED_SIZE;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                float t = ((float)x + 0.5f)/width;      // Gradient alpha, gradient color is 255*(1 - t)
+                float checkAlpha = 0.0f;
+                Color check = BLANK;
+
+                if ((x < checksWidth) && (y < checksHeight))
+                {
+                    check = checks[(x/RAYGUI_COLORBARALPHA_CHECKED_SIZE + y/RAYGUI_COLORBARALPHA_CHECKED_SIZE)%2];
+                    checkAlpha = 0.4f*check.a/255.0f;
+                }
+
+                float alpha = t + checkAlpha*(1.0f - t);
+                float gradient = 255.0f*(1.0f - t)*t;
+                float weight = checkAlpha*(1.0f - t);
+
+                if (alpha > 0.0f)
+                {
+                    pixels[y*width + x].r = (unsigned char)((gradient + check.r*weight)/alpha + 0.5f);
+                    pixels[y*width + x].g = (unsigned char)((gradient + check.g*weight)/alpha + 0.5f);
+                    pixels[y*width + x].b = (unsigned char)((gradient + check.b*weight)/alpha + 0.5f);
+                    pixels[y*width + x].a = (unsigned char)(alpha*255.0f + 0.5f);
+                }
+            }
+        }
+    }
+    else if (type == GUI_BAKED_HUEBAR)
+    {
+        // Six linear segments: red, yellow, green, cyan, blue, magenta, red
+        static const unsigned char hues[7][3] = { { 255, 0, 0 }, { 255, 255, 0 }, { 0, 255, 0 }, { 0, 255, 255 }, { 0, 0, 255 }, { 255, 0, 255 }, { 255, 0, 0 } };
+
+        for (int y = 0; y < height; y++)
+        {
+            float position = ((float)y + 0.5f)*6.0f/height;
+            int segment = (int)position;
+            if (segment > 5) segment = 5;
+            float t = position - segment;
+
+            for (int x = 0; x < width; x++)
+            {
+                pixels[y*width + x].r = (unsigned char)(hues[segment][0] + (hues[segment + 1][0] - hues[segment][0])*t + 0.5f);
+                pixels[y*width + x].g = (unsigned char)(hues[segment][1] + (hues[segment + 1][1] - hues[segment][1])*t + 0.5f);
+                pixels[y*width + x].b = (unsigned char)(hues[segment][2] + (hues[segment + 1][2] - hues[segment][2])*t + 0.5f);
+                pixels[y*width + x].a = 255;
+            }
+        }
+    }
+
+    // Replace oldest entry, unloading its texture
+    int index = guiBakedTexturesNext;
+    guiBakedTexturesNext = (guiBakedTexturesNext + 1)%RAYGUI_MAX_BAKED_TEXTURES;
+
+    if (guiBakedTextures[index].texture.id > 0) UnloadTexture(guiBakedTextures[index].texture);
+
+    guiBakedTextures[index].type = type;
+    guiBakedTextures[index].width = width;
+    guiBakedTextures[index].height = height;
+    guiBakedTextures[index].color1 = color1;
+    guiBakedTextures[index].color2 = color2;
+    guiBakedTextures[index].texture = LoadTextureFromImage(image);
+
+    RAYGUI_FREE(image.data);
+
+    return guiBakedTextures[index].texture;
+}
+#endif
+
 // Split controls text into multiple strings
 // Also check for multiple columns (required by GuiToggleGroup())
 static const char **GuiTextSplit(const char *text, char delimiter, int *count, int *textRow)
@@ -5210,8 +6359,8 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
         if (guiSliderDragging) // Keep dragging outside of bounds
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON) &&
-                !CheckCollisionPointRec(mousePoint, arrowUpLeft) &&
-                !CheckCollisionPointRec(mousePoint, arrowDownRight))
+                !GuiCheckHover(mousePoint, arrowUpLeft) &&
+                !GuiCheckHover(mousePoint, arrowDownRight))
             {
                 if (CHECK_BOUNDS_ID(bounds, guiSliderActive))
                 {
@@ -5227,7 +6376,7 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
                 guiSliderActive = RAYGUI_CLITERAL(Rectangle){ 0, 0, 0, 0 };
             }
         }
-        else if (CheckCollisionPointRec(mousePoint, bounds))
+        else if (GuiCheckHover(mousePoint, bounds))
         {
             state = STATE_FOCUSED;
 
@@ -5242,9 +6391,9 @@ static int GuiScrollBar(Rectangle bounds, int value, int minValue, int maxValue)
                 guiSliderActive = bounds; // Store bounds as an identifier when dragging starts
 
                 // Check arrows click
-                if (CheckCollisionPointRec(mousePoint, arrowUpLeft)) value -= valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                else if (CheckCollisionPointRec(mousePoint, arrowDownRight)) value += valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
-                else if (!CheckCollisionPointRec(mousePoint, slider))
+                if (GuiCheckHover(mousePoint, arrowUpLeft)) value -= valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                else if (GuiCheckHover(mousePoint, arrowDownRight)) value += valueRange/GuiGetStyle(SCROLLBAR, SCROLL_SPEED);
+                else if (!GuiCheckHover(mousePoint, slider))
                 {
                     // If click on scrollbar position but not on slider, place slider directly on that position
                     if (isVertical) value = (int)(((float)(mousePoint.y - scrollbar.y - slider.height/2)*valueRange)/(scrollbar.height - slider.height) + minValue);
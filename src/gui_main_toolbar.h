@@ -66,6 +66,8 @@ typedef struct {
     // Visual options
     int visualStyleActive;
     int prevVisualStyleActive;
+    const char *visualStyleName;    // Selected style template name (provided by tool)
+    int visualStylesCount;          // Style templates count (provided by tool)
     int btnReloadStylePressed;
     int languageActive;
 
@@ -156,6 +158,8 @@ GuiMainToolbarState InitGuiMainToolbar(void)
     // Visuals options
     state.visualStyleActive = 0;
     state.prevVisualStyleActive = 0;
+    state.visualStyleName = "Light";
+    state.visualStylesCount = 1;
     state.languageActive = 0;
 
     // Info options
@@ -214,10 +218,15 @@ void GuiMainToolbar(GuiMainToolbarState *state)
 
     // Visuals options
     GuiLabel((Rectangle){ state->anchorVisuals.x + 10, state->anchorVisuals.y + 8, 60, 24 }, "Style:");
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 40);
     GuiSetTooltip("Select base style template");
-    GuiComboBox((Rectangle){ state->anchorVisuals.x + 8 + 48, state->anchorVisuals.y + 8, 120, 24 }, "Light;Jungle;Candy;Lavanda;Cyber;Terminal;Ashes;Bluish;Dark;Cherry;Sunny;Enefete", &state->visualStyleActive);
-    GuiSetStyle(COMBOBOX, COMBO_BUTTON_WIDTH, 32);
+    // NOTE: Templates list could be long (loaded from templates pack), combo box behaviour is
+    // implemented with two buttons, so only the selected template name is required
+    if (GuiButton((Rectangle){ state->anchorVisuals.x + 8 + 48, state->anchorVisuals.y + 8, 120 - 40 - GuiGetStyle(COMBOBOX, COMBO_BUTTON_SPACING), 24 }, state->visualStyleName) ||
+        GuiButton((Rectangle){ state->anchorVisuals.x + 8 + 48 + 120 - 40, state->anchorVisuals.y + 8, 40, 24 }, TextFormat("%i/%i", state->visualStyleActive + 1, state->visualStylesCount)))
+    {
+        state->visualStyleActive++;
+        if (state->visualStyleActive >= state->visualStylesCount) state->visualStyleActive = 0;
+    }
     GuiSetTooltip("Reload current style template (LCTRL+R)");
     state->btnReloadStylePressed = GuiButton((Rectangle){ state->anchorVisuals.x + 8 + 48 + 120 + 8, state->anchorVisuals.y + 8, 24, 24 }, "#76#");
 
@@ -222,6 +222,8 @@ void GuiWindowAbout(GuiWindowAboutState *state)
 
             if (state->dragMode)
             {
+                GuiRedrawAll();     // Window moved, full redraw required
+
                 state->windowBounds.x = (mousePosition.x - state->panOffset.x);
                 state->windowBounds.y = (mousePosition.y - state->panOffset.y);
 
@@ -39,6 +39,8 @@ typedef struct {
     bool btnLoadCharsetPressed;
     bool fontGenSizeEditMode;
     int fontGenSizeValue;
+    bool fontFaceSizesEditMode;
+    char fontFaceSizesText[32];         // Additional font faces sizes, separated by ';'
 
     bool btnSaveFontAtlasPressed;
 
@@ -50,6 +52,11 @@ typedef struct {
     int selectedCharset;
     int prevSelectedCharset;
 
+    bool atlasBudgetActive;             // Atlas budget mode: charset glyphs packed by priority into a fixed size atlas
+    int atlasBudgetSizeActive;          // Atlas budget size: 256, 512, 1024, 2048
+    bool atlasBudgetFitActive;          // Atlas budget glyph size fitting: biggest size (up to main size) covering all charset
+    bool btnCopyDroppedPressed;
+
     // Custom state variables (depend on development software)
     // NOTE: This variables should be added manually if required
     Texture2D texFont;
@@ -69,7 +76,10 @@ extern "C" {            // Prevents name mangling of functions
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define FONT_ATLAS_GLYPH_PADDING    4   // Font atlas glyphs padding (same as raylib LoadFontEx())
+#define FONT_ATLAS_GRID_CELL_SIZE  32   // Font atlas glyphs spatial index cell size (in atlas pixels)
+#define FONT_ATLAS_BUDGET_MIN_SIZE  8   // Font atlas budget mode minimum glyph size (glyph size fitting lower bound)
+#define FONT_ATLAS_CACHE_VERSION  101   // Font atlas cache file version, older cache files are just ignored
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -122,15 +132,56 @@ static int prevFontGenSizeValue = 10;
 // NOTE: They have to be global to be used bys tyle export functions
 static Font customFont = { 0 };             // Custom font
 static bool customFontLoaded = false;       // Custom font loaded flag (from font file or style file)
+static bool customFontCached = false;       // Custom font owned by style tabs font cache (shared, must not be unloaded)
 static char inFontFileName[512] = { 0 };    // Input font file name (required for font reloading on atlas regeneration)
 
 static int *codepointList = NULL;           // Custom codepoint list
 static int codepointListCount = 0;          // Custom codepoint list count
 
+// Font atlas glyphs spatial index: uniform grid over atlas, every cell lists the glyphs overlapping it
+// NOTE: Glyph entries encode glyph index and font face: (glyph*RAYGUI_MAX_FONT_FACES + face)
+static int *glyphGridCells = NULL;          // Grid cells start offset into entries list (cellsCount + 1 values)
+static int *glyphGridEntries = NULL;        // Grid cells glyph entries
+static int glyphGridCols = 0;               // Grid columns
+static int glyphGridRows = 0;               // Grid rows
+static unsigned int glyphGridTextureId = 0; // Grid atlas texture id, required to validate grid
+static Rectangle *glyphGridRecs = NULL;     // Grid main font recs pointer, required to validate grid
+static int glyphGridCount = 0;              // Grid main font glyph count, required to validate grid
+
+static int hoveredGlyphEntry = -1;          // Glyph entry under mouse cursor
+static int selectedGlyphEntry = -1;         // Glyph entry picked (mouse right button)
+static int *blockGlyphEntries = NULL;       // Glyph entries in same Unicode block than picked glyph
+static int blockGlyphEntriesCount = 0;      // Glyph entries in same Unicode block count
+
+// Font atlas budget mode report, updated on every budget atlas generation
+static int *budgetDroppedCodepoints = NULL; // Budget codepoints dropped (not fitting into atlas), priority order
+static int budgetDroppedCount = 0;          // Budget codepoints dropped count
+static int budgetCodepointCount = 0;        // Budget codepoints requested count
+static int budgetGlyphSize = 0;             // Budget glyph size used (fitted size if requested)
+static bool prevAtlasBudgetActive = false;
+static int prevAtlasBudgetSizeActive = 1;
+static bool prevAtlasBudgetFitActive = false;
+
+// Font atlas cache: generated atlas and glyphs tables saved to disk (.rfac files), keyed by
+// font data, font sizes, charset and packing options, glyphs rasterization skipped on cache hit
+// NOTE: Cache directory is expected to be set by the tool, cache disabled if not set
+static char fontAtlasCacheDir[512] = { 0 };
+
 //----------------------------------------------------------------------------------
-// Internal Module Functions Definition
+// Internal Module Functions Declaration
 //----------------------------------------------------------------------------------
-//...
+static int LoadFontFaces(const char *fileName, const int *sizes, int faceCount, int *codepoints, int codepointCount, Font *faces); // Load font faces into a single atlas
+static void UnloadFontFaces(void);          // Unload additional font faces set in raygui (main font not unloaded)
+static int LoadFontBudget(const char *fileName, int size, int *codepoints, int codepointCount, int atlasSize, bool fitSize, Font *font); // Load font into a fixed size atlas, glyphs packed by priority
+static int PackGlyphsBudget(const GlyphInfo *glyphs, int glyphCount, int atlasSize, Rectangle *recs); // Pack glyphs into a fixed size atlas (skyline), returns packed glyphs count
+static void UpdateGlyphsGrid(Texture2D texture); // Update font atlas glyphs spatial index, only rebuilt if atlas changed
+static int GetGlyphsGridEntry(Vector2 point);   // Get glyph entry at atlas point, -1 if no glyph
+static Font GetGlyphEntryFont(int entry);       // Get glyph entry font face
+static void UpdateBlockGlyphs(int entry);       // Update glyph entries in same Unicode block than provided entry
+static const char *GetUnicodeBlockName(int codepoint, int *blockStart, int *blockEnd); // Get Unicode block name and range for codepoint
+static unsigned long long GetFontAtlasCacheKey(const unsigned char *fileData, int fileDataSize, const int *sizes, int faceCount, const int *codepoints, int codepointCount, int atlasSize, bool fitSize); // Get font atlas cache key (FNV-1a, 64 bit)
+static int LoadFontAtlasCache(unsigned long long key, int fileDataSize, int faceCount, bool budget, Font *faces); // Load font atlas from cache, returns number of faces loaded (0 if not cached)
+static void SaveFontAtlasCache(unsigned long long key, int fileDataSize, const Font *faces, int faceCount, Image atlas, bool budget); // Save font atlas to cache
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -149,6 +200,8 @@ GuiWindowFontAtlasState InitGuiWindowFontAtlas(void)
     state.btnUnloadCharsetPressed = false;
     state.fontGenSizeEditMode = false;
     state.fontGenSizeValue = 10;
+    state.fontFaceSizesEditMode = false;
+    memset(state.fontFaceSizesText, 0, 32);
     state.btnSaveFontAtlasPressed = false;
 
     state.selectWhiteRecActive = false;
@@ -162,6 +215,10 @@ GuiWindowFontAtlasState InitGuiWindowFontAtlas(void)
     state.fontWhiteRec = texShapesRec;
     state.selectedCharset = 0;
     state.prevSelectedCharset = 0;
+    state.atlasBudgetActive = false;
+    state.atlasBudgetSizeActive = 1;
+    state.atlasBudgetFitActive = false;
+    state.btnCopyDroppedPressed = false;
     state.externalCodepointList = NULL;
     state.externalCodepointListCount = 0;
 
@@ -181,8 +238,16 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
         // Check if selected size actually changed to force atlas regen
         if ((prevFontGenSizeValue != state->fontGenSizeValue) && !state->fontGenSizeEditMode) state->fontAtlasRegen = true;
 
+        // Check if atlas budget options changed to force atlas regen
+        if ((prevAtlasBudgetActive != state->atlasBudgetActive) || (state->atlasBudgetActive &&
+            ((prevAtlasBudgetSizeActive != state->atlasBudgetSizeActive) || (prevAtlasBudgetFitActive != state->atlasBudgetFitActive)))) state->fontAtlasRegen = true;
+
         Vector2 mousePosition = GetMousePosition();
 
+        // Atlas budget panel, drawn over font atlas view, it blocks atlas view mouse input
+        Rectangle budgetPanelRec = { state->anchor.x + 724 - 188 - 8, state->anchor.y + 64 + 8, 188, 120 };
+        bool budgetPanelHovered = state->atlasBudgetActive && CheckCollisionPointRec(mousePosition, budgetPanelRec);
+
         if (state->btnUnloadFontPressed)
         {
             memset(inFontFileName, 0, 512);
@@ -196,6 +261,13 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
             state->selectedCharset = 0;
             state->fontAtlasRegen = true;
         }
+        else if (state->btnCopyDroppedPressed && (budgetDroppedCount > 0))
+        {
+            // Copy dropped codepoints to clipboard as UTF-8 text, useful to review them or to build a new charset
+            char *text = LoadUTF8(budgetDroppedCodepoints, budgetDroppedCount);
+            SetClipboardText(text);
+            UnloadUTF8(text);
+        }
 
         if (IsKeyPressed(KEY_SPACE)) state->selectWhiteRecActive = !state->selectWhiteRecActive;
 
@@ -207,7 +279,7 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
             fontWhiteRecScreen.height = state->fontWhiteRec.height*fontAtlasScale;
         }
 
-        if (state->selectWhiteRecActive && CheckCollisionPointRec(mousePosition, (Rectangle){ state->anchor.x, state->anchor.y + 64, 724, 532 - 64 }))
+        if (state->selectWhiteRecActive && !budgetPanelHovered && CheckCollisionPointRec(mousePosition, (Rectangle){ state->anchor.x, state->anchor.y + 64, 724, 532 - 64 }))
         {
             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
             {
@@ -261,8 +333,23 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
                 fontAtlasPosition.y - state->texFont.height*fontAtlasScale/2,
                 state->texFont.width*fontAtlasScale, state->texFont.height*fontAtlasScale };
 
+            // Glyph picking, glyph under mouse found on atlas spatial index (O(1) per frame)
+            UpdateGlyphsGrid(state->texFont);
+            hoveredGlyphEntry = -1;
+
+            if (!budgetPanelHovered && CheckCollisionPointRec(mousePosition, (Rectangle){ state->anchor.x, state->anchor.y + 64, 724, 532 - 64 }) && CheckCollisionPointRec(mousePosition, fontAtlasRec))
+            {
+                hoveredGlyphEntry = GetGlyphsGridEntry((Vector2){ (mousePosition.x - fontAtlasRec.x)/fontAtlasScale, (mousePosition.y - fontAtlasRec.y)/fontAtlasScale });
+
+                if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT))
+                {
+                    selectedGlyphEntry = hoveredGlyphEntry;
+                    UpdateBlockGlyphs(selectedGlyphEntry);
+                }
+            }
+
             // Font atlas panning with mouse logic
-            if (CheckCollisionPointRec(GetMousePosition(), fontAtlasRec))
+            if (!budgetPanelHovered && CheckCollisionPointRec(GetMousePosition(), fontAtlasRec))
             {
                 if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
                 {
@@ -317,21 +404,52 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
         // Reload font and generate new atlas at new size when required
         if ((inFontFileName[0] != '\0') && state->fontAtlasRegen)
         {
-            // Load font file
-            Font tempFont = LoadFontEx(inFontFileName, state->fontGenSizeValue, codepointList, codepointListCount);
+            // Get required font faces sizes, main font size first
+            int faceSizes[RAYGUI_MAX_FONT_FACES] = { state->fontGenSizeValue };
+            int faceCount = 1;
+            int sizesCount = 0;
+            const char **sizes = TextSplit(state->fontFaceSizesText, ';', &sizesCount);
+
+            for (int i = 0; (i < sizesCount) && (faceCount < RAYGUI_MAX_FONT_FACES); i++)
+            {
+                int size = TextToInteger(sizes[i]);
+                if (size > 0) { faceSizes[faceCount] = size; faceCount++; }
+            }
+
+            // Load font file faces, all of them packed into one atlas
+            Font tempFaces[RAYGUI_MAX_FONT_FACES] = { 0 };
+            int loadedFaces = 0;
 
-            if (tempFont.texture.id > 0)
+            if (state->atlasBudgetActive)
             {
-                // TODO: Add a white rectangle at the bottom-right corner, 3x3 pixels, to be used for shapes rectangle
+                // Budget mode: main face only, charset glyphs packed by priority into a fixed size atlas
+                faceCount = 1;
+                if (LoadFontBudget(inFontFileName, state->fontGenSizeValue, codepointList, codepointListCount,
+                    256 << state->atlasBudgetSizeActive, state->atlasBudgetFitActive, &tempFaces[0]) > 0) loadedFaces = 1;
+            }
+            else loadedFaces = LoadFontFaces(inFontFileName, faceSizes, faceCount, codepointList, codepointListCount, tempFaces);
+
+            if (loadedFaces == faceCount)
+            {
+                // NOTE: A white rectangle is added at the bottom-right corner, 3x3 pixels, by raylib GenImageFontAtlas()
 
-                if (customFontLoaded) UnloadFont(customFont);   // Unload previously loaded font
-                customFont = tempFont;
+                // NOTE: Font shared by style tabs is owned by tabs font cache, it is only detached
+                if (!customFontCached)
+                {
+                    UnloadFontFaces();                              // Unload previously loaded faces
+                    if (customFontLoaded) UnloadFont(customFont);   // Unload previously loaded font
+                }
+                else for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++) GuiSetFontFace(i, (Font){ 0 });
+
+                customFont = tempFaces[0];
                 GuiSetFont(customFont);
+                for (int i = 1; i < faceCount; i++) GuiSetFontFace(i, tempFaces[i]);
 
                 // Reset shapes texture and rectangle
                 SetShapesTexture((Texture2D){ 0 }, (Rectangle){ 0 });
 
                 customFontLoaded = true;
+                customFontCached = false;
             }
             else memset(inFontFileName, 0, 512);
 
@@ -371,9 +489,85 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
                         fontAtlasRec.y + state->fontWhiteRec.y*fontAtlasScale,
                         state->fontWhiteRec.width*fontAtlasScale, state->fontWhiteRec.height*fontAtlasScale }, 
                     GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_FOCUSED)));
+
+                // Draw picked glyph Unicode block glyphs, picked glyph and hovered glyph
+                for (int i = 0; i < blockGlyphEntriesCount; i++)
+                {
+                    Rectangle rec = GetGlyphEntryFont(blockGlyphEntries[i]).recs[blockGlyphEntries[i]/RAYGUI_MAX_FONT_FACES];
+                    DrawRectangleRec((Rectangle){ fontAtlasRec.x + rec.x*fontAtlasScale, fontAtlasRec.y + rec.y*fontAtlasScale, rec.width*fontAtlasScale, rec.height*fontAtlasScale }, Fade(GetColor(GuiGetStyle(DEFAULT, BASE_COLOR_PRESSED)), 0.4f));
+                }
+
+                if (selectedGlyphEntry >= 0)
+                {
+                    Rectangle rec = GetGlyphEntryFont(selectedGlyphEntry).recs[selectedGlyphEntry/RAYGUI_MAX_FONT_FACES];
+                    DrawRectangleLinesEx((Rectangle){ fontAtlasRec.x + rec.x*fontAtlasScale, fontAtlasRec.y + rec.y*fontAtlasScale, rec.width*fontAtlasScale, rec.height*fontAtlasScale }, 2.0f, GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_PRESSED)));
+                }
+
+                if (hoveredGlyphEntry >= 0)
+                {
+                    Rectangle rec = GetGlyphEntryFont(hoveredGlyphEntry).recs[hoveredGlyphEntry/RAYGUI_MAX_FONT_FACES];
+                    DrawRectangleLinesEx((Rectangle){ fontAtlasRec.x + rec.x*fontAtlasScale, fontAtlasRec.y + rec.y*fontAtlasScale, rec.width*fontAtlasScale, rec.height*fontAtlasScale }, 1.0f, GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_FOCUSED)));
+                }
             }
         EndScissorMode();
 
+        // Draw atlas budget panel
+        prevAtlasBudgetSizeActive = state->atlasBudgetSizeActive;
+        prevAtlasBudgetFitActive = state->atlasBudgetFitActive;
+        state->btnCopyDroppedPressed = false;
+
+        if (state->atlasBudgetActive)
+        {
+            GuiPanel(budgetPanelRec, "#97#Atlas Budget");
+            GuiLabel((Rectangle){ budgetPanelRec.x + 8, budgetPanelRec.y + 32, 40, 24 }, "Size:");
+            GuiSetTooltip("Atlas size (width and height)");
+            GuiComboBox((Rectangle){ budgetPanelRec.x + 48, budgetPanelRec.y + 32, 132, 24 }, "256x256;512x512;1024x1024;2048x2048", &state->atlasBudgetSizeActive);
+            GuiSetTooltip("Fit biggest glyph size (up to main font size) covering all charset");
+            GuiCheckBox((Rectangle){ budgetPanelRec.x + 8, budgetPanelRec.y + 64, 16, 16 }, "Fit glyph size", &state->atlasBudgetFitActive);
+            if (budgetDroppedCount == 0) GuiDisable();
+            GuiSetTooltip("Copy dropped codepoints to clipboard (UTF-8)");
+            state->btnCopyDroppedPressed = GuiButton((Rectangle){ budgetPanelRec.x + 8, budgetPanelRec.y + 88, 172, 24 }, TextFormat("#16#Copy Dropped (%i)", budgetDroppedCount));
+            GuiEnable();
+            GuiSetTooltip(NULL);
+        }
+
+        // Draw glyph info: hovered glyph, picked glyph otherwise
+        int infoGlyphEntry = (hoveredGlyphEntry >= 0)? hoveredGlyphEntry : selectedGlyphEntry;
+
+        if (!state->selectWhiteRecActive && (infoGlyphEntry >= 0))
+        {
+            Font font = GetGlyphEntryFont(infoGlyphEntry);
+            int index = infoGlyphEntry/RAYGUI_MAX_FONT_FACES;
+            int blockStart = 0, blockEnd = 0;
+            const char *blockName = GetUnicodeBlockName(font.glyphs[index].value, &blockStart, &blockEnd);
+            char glyphText[8] = { 0 };
+            int glyphTextSize = 0;
+            const char *glyphUtf8 = CodepointToUTF8(font.glyphs[index].value, &glyphTextSize);
+            memcpy(glyphText, glyphUtf8, glyphTextSize);
+
+            GuiStatusBar((Rectangle){ state->anchor.x, state->anchor.y + 508, 724, 24 },
+                TextFormat("U+%04X [%s] | Face: %i | Rec: [%i, %i, %i, %i] | Offset: [%i, %i] | Advance: %i | %s", font.glyphs[index].value,
+                    glyphText, infoGlyphEntry%RAYGUI_MAX_FONT_FACES,
+                    (int)font.recs[index].x, (int)font.recs[index].y, (int)font.recs[index].width, (int)font.recs[index].height,
+                    font.glyphs[index].offsetX, font.glyphs[index].offsetY, font.glyphs[index].advanceX, blockName));
+        }
+        else if (!state->selectWhiteRecActive && state->atlasBudgetActive && (budgetCodepointCount > 0))
+        {
+            // Draw atlas budget report: coverage and first dropped codepoints (priority order)
+            char droppedText[128] = { 0 };
+            int droppedTextLength = 0;
+
+            for (int i = 0; (i < budgetDroppedCount) && (droppedTextLength < 96); i++)
+            {
+                droppedTextLength += snprintf(droppedText + droppedTextLength, 128 - droppedTextLength, " U+%04X", budgetDroppedCodepoints[i]);
+            }
+
+            GuiStatusBar((Rectangle){ state->anchor.x, state->anchor.y + 508, 724, 24 },
+                TextFormat("Coverage: %.1f%% (%i/%i) | Glyph size: %i | Dropped: %i%s%s", 100.0f*(budgetCodepointCount - budgetDroppedCount)/budgetCodepointCount,
+                    budgetCodepointCount - budgetDroppedCount, budgetCodepointCount, budgetGlyphSize, budgetDroppedCount, droppedText,
+                    (droppedTextLength >= 96)? " ..." : ""));
+        }
+
         GuiLine((Rectangle){ state->anchor.x + 0, state->anchor.y + 24 + 40 - 2, 724, 2 }, NULL);
         
         GuiEnableTooltip();
@@ -388,7 +582,14 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
 
         if (!FileExists(inFontFileName)) GuiDisable();
         prevFontGenSizeValue = state->fontGenSizeValue;
-        if (GuiSpinner((Rectangle){ state->anchor.x + 164, state->anchor.y + 32, 96, 24 }, "Gen Size: ", &state->fontGenSizeValue, 0, 100, state->fontGenSizeEditMode)) state->fontGenSizeEditMode = !state->fontGenSizeEditMode;
+        GuiSetTooltip("Main font face size");
+        if (GuiSpinner((Rectangle){ state->anchor.x + 128, state->anchor.y + 32, 76, 24 }, "Size: ", &state->fontGenSizeValue, 0, 100, state->fontGenSizeEditMode)) state->fontGenSizeEditMode = !state->fontGenSizeEditMode;
+        GuiSetTooltip("Additional faces sizes, same atlas (i.e. 16;24)");
+        if (GuiTextBox((Rectangle){ state->anchor.x + 208, state->anchor.y + 32, 52, 24 }, state->fontFaceSizesText, 31, state->fontFaceSizesEditMode))
+        {
+            state->fontFaceSizesEditMode = !state->fontFaceSizesEditMode;
+            if (!state->fontFaceSizesEditMode) state->fontAtlasRegen = true;
+        }
         
         //GuiSetTooltip("Regenerate font atlas");
         //if (GuiButton((Rectangle){ state->anchor.x + 210, state->anchor.y + 32, 80, 24 }, "#142#Regen")) state->fontAtlasRegen = true;
@@ -406,7 +607,10 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
         state->prevSelectedCharset = state->selectedCharset;
         GuiSetTooltip("Select charset");
         GuiLabel((Rectangle){ state->anchor.x + 350, state->anchor.y + 32, 60, 24 }, "Charset: ");
-        GuiComboBox((Rectangle){ state->anchor.x + 348 + 56, state->anchor.y + 32, 128, 24 }, (state->externalCodepointList != NULL)? "Basic;ISO-8859-15;Custom" : "Basic;ISO-8859-15", &state->selectedCharset);
+        GuiComboBox((Rectangle){ state->anchor.x + 348 + 56, state->anchor.y + 32, 100, 24 }, (state->externalCodepointList != NULL)? "Basic;ISO-8859-15;Custom" : "Basic;ISO-8859-15", &state->selectedCharset);
+        prevAtlasBudgetActive = state->atlasBudgetActive;
+        GuiSetTooltip("Toggle atlas budget mode (fixed atlas size)");
+        GuiToggle((Rectangle){ state->anchor.x + 512, state->anchor.y + 32, 24, 24 }, "#97#", &state->atlasBudgetActive);
         GuiEnable();
 
         DrawLine(state->anchor.x + 544, state->anchor.y + 24, state->anchor.x + 544, state->anchor.y + 24 + 40, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
@@ -437,7 +641,9 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
         //GuiToggle((Rectangle){ state->anchor.x + 360 + 48 + 8, state->anchor.y + 32, 24, 24 }, "#180#", &state->compressGlyphDataActive);
 
         GuiStatusBar((Rectangle){ state->anchor.x + 0, state->anchor.y + 531, 217, 24 }, TextFormat("File: %s [%s]", GetFileName(inFontFileName), FileExists(inFontFileName)? "LOADED" : "NOT AVAILABLE"));
-        GuiStatusBar((Rectangle){ state->anchor.x + 216, state->anchor.y + 531, 145, 24 }, TextFormat("Codepoints: %i", GuiGetFont().glyphCount));
+        int faceCount = 1;
+        for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++) if (GuiGetFontFace(i).texture.id > 0) faceCount++;
+        GuiStatusBar((Rectangle){ state->anchor.x + 216, state->anchor.y + 531, 145, 24 }, TextFormat("Codepoints: %i x %i", GuiGetFont().glyphCount, faceCount));
         GuiStatusBar((Rectangle){ state->anchor.x + 360, state->anchor.y + 531, 161, 24 }, TextFormat("Atlas Size: %ix%i", state->texFont.width, state->texFont.height));
         GuiStatusBar((Rectangle){ state->anchor.x + 520, state->anchor.y + 531, 204, 24 }, 
             TextFormat("White rec: [%i, %i, %i, %i]", (int)state->fontWhiteRec.x, (int)state->fontWhiteRec.y, (int)state->fontWhiteRec.width, (int)state->fontWhiteRec.height));
@@ -461,4 +667,673 @@ void GuiWindowFontAtlas(GuiWindowFontAtlasState *state)
     }
 }
 
+//----------------------------------------------------------------------------------
+// Internal Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load font faces into a single atlas, returns number of faces loaded
+// NOTE: All faces share the same atlas texture and white rectangle (added by raylib GenImageFontAtlas()),
+// every face keeps its own recs/glyphs tables, first face is considered the main font
+// NOTE: Atlas is loaded from font atlas cache if available, glyphs images are not provided in that case
+static int LoadFontFaces(const char *fileName, const int *sizes, int faceCount, int *codepoints, int codepointCount, Font *faces)
+{
+    int loadedFaces = 0;
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+    unsigned long long cacheKey = 0;
+
+    if (fileData != NULL)
+    {
+        cacheKey = GetFontAtlasCacheKey(fileData, fileDataSize, sizes, faceCount, codepoints, codepointCount, 0, false);
+        loadedFaces = LoadFontAtlasCache(cacheKey, fileDataSize, faceCount, false, faces);
+
+        if (loadedFaces > 0)
+        {
+            UnloadFileData(fileData);
+            fileData = NULL;
+        }
+    }
+
+    if (fileData != NULL)
+    {
+        int glyphCount = (codepointCount > 0)? codepointCount : 95;     // NOTE: raylib loads 95 glyphs by default
+        int maxSize = 0;
+
+        GlyphInfo *glyphs = (GlyphInfo *)RL_CALLOC(faceCount*glyphCount, sizeof(GlyphInfo));
+
+        for (int f = 0; f < faceCount; f++)
+        {
+            GlyphInfo *faceGlyphs = LoadFontData(fileData, fileDataSize, sizes[f], codepoints, codepointCount, FONT_DEFAULT);
+            if (faceGlyphs == NULL) break;
+
+            // NOTE: Glyphs images ownership is moved to the combined glyphs array
+            memcpy(glyphs + f*glyphCount, faceGlyphs, glyphCount*sizeof(GlyphInfo));
+            RL_FREE(faceGlyphs);
+
+            if (sizes[f] > maxSize) maxSize = sizes[f];
+            loadedFaces++;
+        }
+
+        UnloadFileData(fileData);
+
+        if (loadedFaces == faceCount)
+        {
+            // Pack all faces glyphs together, skyline packing (1) deals better with multiple sizes
+            Rectangle *recs = NULL;
+            Image atlas = GenImageFontAtlas(glyphs, &recs, faceCount*glyphCount, maxSize, FONT_ATLAS_GLYPH_PADDING, (faceCount > 1)? 1 : 0);
+            Texture2D texture = LoadTextureFromImage(atlas);
+
+            for (int f = 0; f < faceCount; f++)
+            {
+                faces[f].baseSize = sizes[f];
+                faces[f].glyphCount = glyphCount;
+                faces[f].glyphPadding = FONT_ATLAS_GLYPH_PADDING;
+                faces[f].texture = texture;
+
+                faces[f].recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+                memcpy(faces[f].recs, recs + f*glyphCount, glyphCount*sizeof(Rectangle));
+
+                faces[f].glyphs = (GlyphInfo *)RL_MALLOC(glyphCount*sizeof(GlyphInfo));
+                memcpy(faces[f].glyphs, glyphs + f*glyphCount, glyphCount*sizeof(GlyphInfo));
+
+                // Glyphs images only kept for main font (as LoadFontEx() does), not required for drawing
+                if (f > 0)
+                {
+                    for (int i = 0; i < glyphCount; i++)
+                    {
+                        UnloadImage(faces[f].glyphs[i].image);
+                        faces[f].glyphs[i].image = (Image){ 0 };
+                    }
+                }
+            }
+
+            SaveFontAtlasCache(cacheKey, fileDataSize, faces, faceCount, atlas, false);
+
+            UnloadImage(atlas);
+            RL_FREE(recs);
+        }
+        else
+        {
+            for (int i = 0; i < loadedFaces*glyphCount; i++) UnloadImage(glyphs[i].image);
+            loadedFaces = 0;
+        }
+
+        RL_FREE(glyphs);
+    }
+
+    return loadedFaces;
+}
+
+// Unload additional font faces set in raygui
+// NOTE: Faces share main font atlas texture, only recs/glyphs data is unloaded
+static void UnloadFontFaces(void)
+{
+    for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++)
+    {
+        Font face = GuiGetFontFace(i);
+
+        RL_FREE(face.recs);
+        RL_FREE(face.glyphs);
+        GuiSetFontFace(i, (Font){ 0 });
+    }
+}
+
+// Load font into a fixed size atlas, charset glyphs packed by priority (codepoints order), returns loaded glyphs count
+// NOTE: Glyphs not fitting into atlas are dropped (budget report updated), if glyph size fitting is requested
+// the biggest size (up to provided size) packing all glyphs is binary-searched, maximum coverage size kept otherwise
+// NOTE: Atlas and budget report are loaded from font atlas cache if available (no glyph size search required)
+static int LoadFontBudget(const char *fileName, int size, int *codepoints, int codepointCount, int atlasSize, bool fitSize, Font *font)
+{
+    int packedCount = 0;
+    int fileDataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileDataSize);
+    unsigned long long cacheKey = 0;
+
+    if (fileData != NULL)
+    {
+        cacheKey = GetFontAtlasCacheKey(fileData, fileDataSize, &size, 1, codepoints, codepointCount, atlasSize, fitSize);
+
+        if (LoadFontAtlasCache(cacheKey, fileDataSize, 1, true, font) == 1)
+        {
+            packedCount = font->glyphCount;
+            UnloadFileData(fileData);
+            fileData = NULL;
+        }
+    }
+
+    if (fileData != NULL)
+    {
+        int glyphCount = (codepointCount > 0)? codepointCount : 95;     // NOTE: raylib loads 95 glyphs by default
+        if (size < FONT_ATLAS_BUDGET_MIN_SIZE) size = FONT_ATLAS_BUDGET_MIN_SIZE;
+
+        int glyphSize = size;
+        GlyphInfo *glyphs = LoadFontData(fileData, fileDataSize, size, codepoints, codepointCount, FONT_DEFAULT);
+        Rectangle *recs = (Rectangle *)RL_CALLOC(glyphCount, sizeof(Rectangle));
+
+        if (glyphs != NULL) packedCount = PackGlyphsBudget(glyphs, glyphCount, atlasSize, recs);
+
+        if ((glyphs != NULL) && fitSize && (packedCount < glyphCount))
+        {
+            // Glyph size binary search, glyphs rasterized at every step, only best step glyphs kept
+            // NOTE: Atlas used area grows with glyph size, so packing all glyphs is expected to be monotonic on size
+            int minSize = FONT_ATLAS_BUDGET_MIN_SIZE;
+            int maxSize = size - 1;
+
+            while (minSize <= maxSize)
+            {
+                int testSize = (minSize + maxSize)/2;
+                GlyphInfo *testGlyphs = LoadFontData(fileData, fileDataSize, testSize, codepoints, codepointCount, FONT_DEFAULT);
+                if (testGlyphs == NULL) break;
+
+                Rectangle *testRecs = (Rectangle *)RL_CALLOC(glyphCount, sizeof(Rectangle));
+                int testCount = PackGlyphsBudget(testGlyphs, glyphCount, atlasSize, testRecs);
+
+                if (testCount == glyphCount) minSize = testSize + 1;
+                else maxSize = testSize - 1;
+
+                // Keep biggest size packing all glyphs, best coverage size while no size packs all glyphs
+                if ((testCount == glyphCount) || ((packedCount < glyphCount) && (testCount > packedCount)))
+                {
+                    UnloadFontData(glyphs, glyphCount);
+                    RL_FREE(recs);
+
+                    glyphs = testGlyphs;
+                    recs = testRecs;
+                    glyphSize = testSize;
+                    packedCount = testCount;
+                }
+                else
+                {
+                    UnloadFontData(testGlyphs, glyphCount);
+                    RL_FREE(testRecs);
+                }
+            }
+        }
+
+        UnloadFileData(fileData);
+
+        // Update budget report, dropped codepoints kept in priority order
+        RL_FREE(budgetDroppedCodepoints);
+        budgetDroppedCodepoints = NULL;
+        budgetDroppedCount = 0;
+        budgetCodepointCount = 0;
+        budgetGlyphSize = 0;
+
+        if ((glyphs != NULL) && (packedCount > 0))
+        {
+            budgetCodepointCount = glyphCount;
+            budgetGlyphSize = glyphSize;
+            if (packedCount < glyphCount) budgetDroppedCodepoints = (int *)RL_MALLOC((glyphCount - packedCount)*sizeof(int));
+
+            // Generate atlas image, same format as raylib GenImageFontAtlas(): GRAY_ALPHA, white color and glyph alpha
+            unsigned char *pixels = (unsigned char *)RL_CALLOC(atlasSize*atlasSize, 2);
+            for (int i = 0; i < atlasSize*atlasSize; i++) pixels[i*2] = 255;
+
+            font->baseSize = glyphSize;
+            font->glyphCount = packedCount;
+            font->glyphPadding = FONT_ATLAS_GLYPH_PADDING;
+            font->recs = (Rectangle *)RL_MALLOC(packedCount*sizeof(Rectangle));
+            font->glyphs = (GlyphInfo *)RL_MALLOC(packedCount*sizeof(GlyphInfo));
+
+            for (int i = 0, k = 0; i < glyphCount; i++)
+            {
+                if (recs[i].x < 0)
+                {
+                    budgetDroppedCodepoints[budgetDroppedCount] = glyphs[i].value;
+                    budgetDroppedCount++;
+                    UnloadImage(glyphs[i].image);
+                    continue;
+                }
+
+                // NOTE: Glyphs images generated by LoadFontData() are GRAYSCALE (1 byte per pixel)
+                const unsigned char *glyphPixels = (const unsigned char *)glyphs[i].image.data;
+
+                for (int y = 0; (glyphPixels != NULL) && (y < glyphs[i].image.height); y++)
+                {
+                    for (int x = 0; x < glyphs[i].image.width; x++)
+                    {
+                        pixels[(((int)recs[i].y + y)*atlasSize + (int)recs[i].x + x)*2 + 1] = glyphPixels[y*glyphs[i].image.width + x];
+                    }
+                }
+
+                font->recs[k] = recs[i];
+                font->glyphs[k] = glyphs[i];       // NOTE: Glyph image ownership moved to font (as LoadFontEx() does)
+                k++;
+            }
+
+            // Add a white rectangle at the bottom-right corner, 3x3 pixels (as raylib GenImageFontAtlas() does)
+            for (int y = atlasSize - 3; y < atlasSize; y++)
+            {
+                for (int x = atlasSize - 3; x < atlasSize; x++) pixels[(y*atlasSize + x)*2 + 1] = 255;
+            }
+
+            Image atlas = { pixels, atlasSize, atlasSize, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+            font->texture = LoadTextureFromImage(atlas);
+            SaveFontAtlasCache(cacheKey, fileDataSize, font, 1, atlas, true);
+            UnloadImage(atlas);
+
+            RL_FREE(glyphs);
+        }
+        else
+        {
+            if (glyphs != NULL) UnloadFontData(glyphs, glyphCount);
+            packedCount = 0;
+        }
+
+        RL_FREE(recs);
+    }
+
+    return packedCount;
+}
+
+// Pack glyphs into a fixed size atlas, in glyphs order, glyphs not fitting are skipped (rec.x = -1)
+// NOTE: Skyline bottom-left packing, only skyline segments starts are checked as glyph position,
+// glyphs padding and white rectangle (bottom-right corner) considered, returns packed glyphs count
+static int PackGlyphsBudget(const GlyphInfo *glyphs, int glyphCount, int atlasSize, Rectangle *recs)
+{
+    int packedCount = 0;
+    int *skyline = (int *)RL_CALLOC(atlasSize, sizeof(int));   // Atlas columns used height
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int width = glyphs[i].image.width + 2*FONT_ATLAS_GLYPH_PADDING;
+        int height = glyphs[i].image.height + 2*FONT_ATLAS_GLYPH_PADDING;
+        int bestX = -1;
+        int bestY = atlasSize;
+
+        for (int x = 0; (x + width) <= atlasSize; x++)
+        {
+            if ((x > 0) && (skyline[x] == skyline[x - 1])) continue;
+
+            int y = 0;
+            for (int k = x; (k < (x + width)) && (y < bestY); k++) if (skyline[k] > y) y = skyline[k];
+
+            if ((y < bestY) && ((y + height) <= atlasSize) &&
+                !(((x + width) > (atlasSize - 3)) && ((y + height) > (atlasSize - 3)))) { bestX = x; bestY = y; }
+        }
+
+        if (bestX >= 0)
+        {
+            for (int k = bestX; k < (bestX + width); k++) skyline[k] = bestY + height;
+
+            recs[i] = (Rectangle){ (float)(bestX + FONT_ATLAS_GLYPH_PADDING), (float)(bestY + FONT_ATLAS_GLYPH_PADDING), (float)glyphs[i].image.width, (float)glyphs[i].image.height };
+            packedCount++;
+        }
+        else recs[i] = (Rectangle){ -1, -1, 0, 0 };
+    }
+
+    RL_FREE(skyline);
+
+    return packedCount;
+}
+
+// Get font atlas cache key, hash (FNV-1a, 64 bit) of font file data, font sizes, charset codepoints and packing options
+// NOTE: Packing options considered: glyphs padding, packing method (depends on faces count), budget atlas size and fitting
+static unsigned long long GetFontAtlasCacheKey(const unsigned char *fileData, int fileDataSize, const int *sizes, int faceCount, const int *codepoints, int codepointCount, int atlasSize, bool fitSize)
+{
+    int options[5] = { FONT_ATLAS_CACHE_VERSION, FONT_ATLAS_GLYPH_PADDING, faceCount, atlasSize, fitSize? 1 : 0 };
+    unsigned long long hash = 14695981039346656037ull;
+
+    for (int i = 0; i < fileDataSize; i++) hash = (hash ^ fileData[i])*1099511628211ull;
+    for (int i = 0; i < faceCount*(int)sizeof(int); i++) hash = (hash ^ ((const unsigned char *)sizes)[i])*1099511628211ull;
+    for (int i = 0; (codepoints != NULL) && (i < codepointCount*(int)sizeof(int)); i++) hash = (hash ^ ((const unsigned char *)codepoints)[i])*1099511628211ull;
+    for (int i = 0; i < (int)sizeof(options); i++) hash = (hash ^ ((const unsigned char *)options)[i])*1099511628211ull;
+
+    return hash;
+}
+
+// Load font atlas from cache, returns number of faces loaded (0 if not cached or cache file not valid)
+// NOTE: Atlas pixel data is uploaded directly from cache file data, glyphs images are not provided,
+// budget report is also restored if requested
+static int LoadFontAtlasCache(unsigned long long key, int fileDataSize, int faceCount, bool budget, Font *faces)
+{
+    // Font Atlas Cache File Structure (.rfac)
+    // NOTE: All fields are 4 bytes aligned, tables and pixel data can be used directly from file data
+    // ------------------------------------------------------
+    // Offset  | Size    | Type       | Description
+    // ------------------------------------------------------
+    // 0       | 4       | char       | Signature: "rFAC"
+    // 4       | 4       | int        | Version: 101
+    // 8       | 8       | int        | Cache key (font data, sizes, charset and packing options hash), low/high 32 bit
+    // 16      | 4       | int        | Font file data size
+    // 20      | 4       | int        | Faces count [faceCount]
+    // 24      | 4       | int        | Atlas image width
+    // 28      | 4       | int        | Atlas image height
+    // 32      | 4       | int        | Atlas image format
+    // 36      | 4       | int        | Budget codepoints requested count (0 - no budget atlas)
+    // 40      | 4       | int        | Budget codepoints dropped count [droppedCount]
+
+    // Faces Data: (baseSize (4 bytes) + glyphCount (4 bytes))*faceCount
+    // foreach (face)
+    // {
+    //   44+8*i | 4      | int        | Face base size
+    //   48+8*i | 4      | int        | Face glyph count [glyphCount]
+    // }
+
+    // Faces Tables: (recs (16 bytes) + glyphs (16 bytes))*glyphCount, per face
+    // foreach (face)
+    // {
+    //   ...   | 16*glyphCount | Rectangle | Glyphs rectangles in atlas
+    //   ...   | 16*glyphCount | int       | Glyphs info: value, offsetX, offsetY, advanceX
+    // }
+
+    //   ...   | 4*droppedCount | int      | Budget dropped codepoints, priority order
+    //   ...   | imSize   | *             | Atlas image data (uncompressed)
+
+    int loadedFaces = 0;
+    const char *fileName = TextFormat("%s/%016llx.rfac", fontAtlasCacheDir, key);
+
+    if ((fontAtlasCacheDir[0] != '\0') && (faceCount <= RAYGUI_MAX_FONT_FACES) && FileExists(fileName))
+    {
+        int dataSize = 0;
+        unsigned char *data = LoadFileData(fileName, &dataSize);
+        int header[10] = { 0 };
+        int faceInfo[2*RAYGUI_MAX_FONT_FACES] = { 0 };
+
+        if ((data != NULL) && (dataSize >= (44 + faceCount*8)) && (memcmp(data, "rFAC", 4) == 0))
+        {
+            memcpy(header, data + 4, 10*sizeof(int));
+            memcpy(faceInfo, data + 44, 2*faceCount*sizeof(int));
+        }
+
+        // NOTE: Full 64 bit key and font file size are checked, file name only considers the key
+        if ((header[0] == FONT_ATLAS_CACHE_VERSION) && ((unsigned int)header[1] == (unsigned int)key) && ((unsigned int)header[2] == (unsigned int)(key >> 32)) &&
+            (header[3] == fileDataSize) && (header[4] == faceCount) && (header[5] > 0) && (header[6] > 0) && (header[9] >= 0) && (header[9] <= dataSize/4))
+        {
+            // Check expected file size, considering all faces tables
+            // NOTE: Counts are bounded by file size before sizes are added, no overflow possible
+            int pixelsSize = GetPixelDataSize(header[5], header[6], header[7]);
+            long long expectedSize = 44 + faceCount*8 + (long long)header[9]*4 + pixelsSize;
+            bool validFaces = true;
+
+            for (int f = 0; f < faceCount; f++)
+            {
+                if ((faceInfo[f*2 + 1] > 0) && (faceInfo[f*2 + 1] <= dataSize/32)) expectedSize += (long long)faceInfo[f*2 + 1]*32;
+                else validFaces = false;
+            }
+
+            if (validFaces && (pixelsSize > 0) && (expectedSize == dataSize))
+            {
+                Image atlas = { data + dataSize - pixelsSize, header[5], header[6], 1, header[7] };
+                Texture2D texture = LoadTextureFromImage(atlas);
+                int offset = 44 + faceCount*8;
+
+                for (int f = 0; f < faceCount; f++)
+                {
+                    int glyphCount = faceInfo[f*2 + 1];
+
+                    faces[f].baseSize = faceInfo[f*2];
+                    faces[f].glyphCount = glyphCount;
+                    faces[f].glyphPadding = FONT_ATLAS_GLYPH_PADDING;
+                    faces[f].texture = texture;
+
+                    faces[f].recs = (Rectangle *)RL_MALLOC(glyphCount*sizeof(Rectangle));
+                    memcpy(faces[f].recs, data + offset, glyphCount*sizeof(Rectangle));
+                    offset += glyphCount*16;
+
+                    faces[f].glyphs = (GlyphInfo *)RL_CALLOC(glyphCount, sizeof(GlyphInfo));
+                    for (int i = 0; i < glyphCount; i++)
+                    {
+                        int glyphInfo[4] = { 0 };
+                        memcpy(glyphInfo, data + offset + i*16, 4*sizeof(int));
+
+                        faces[f].glyphs[i].value = glyphInfo[0];
+                        faces[f].glyphs[i].offsetX = glyphInfo[1];
+                        faces[f].glyphs[i].offsetY = glyphInfo[2];
+                        faces[f].glyphs[i].advanceX = glyphInfo[3];
+                    }
+                    offset += glyphCount*16;
+                }
+
+                if (budget)
+                {
+                    RL_FREE(budgetDroppedCodepoints);
+                    budgetDroppedCodepoints = NULL;
+                    budgetCodepointCount = header[8];
+                    budgetDroppedCount = header[9];
+                    budgetGlyphSize = faces[0].baseSize;
+
+                    if (budgetDroppedCount > 0)
+                    {
+                        budgetDroppedCodepoints = (int *)RL_MALLOC(budgetDroppedCount*sizeof(int));
+                        memcpy(budgetDroppedCodepoints, data + offset, budgetDroppedCount*sizeof(int));
+                    }
+                }
+
+                loadedFaces = faceCount;
+            }
+        }
+
+        UnloadFileData(data);
+    }
+
+    return loadedFaces;
+}
+
+// Save font atlas to cache, file named by cache key (hexadecimal)
+// NOTE: Cache files are never evicted, a changed font file generates a new key
+static void SaveFontAtlasCache(unsigned long long key, int fileDataSize, const Font *faces, int faceCount, Image atlas, bool budget)
+{
+    if ((fontAtlasCacheDir[0] != '\0') && (atlas.data != NULL) && (atlas.mipmaps == 1))
+    {
+        int droppedCount = budget? budgetDroppedCount : 0;
+        int pixelsSize = GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+        int dataSize = 44 + faceCount*8 + droppedCount*4 + pixelsSize;
+        for (int f = 0; f < faceCount; f++) dataSize += faces[f].glyphCount*32;
+
+        unsigned char *data = (unsigned char *)RL_CALLOC(dataSize, 1);
+        int header[10] = { FONT_ATLAS_CACHE_VERSION, (int)(unsigned int)key, (int)(unsigned int)(key >> 32), fileDataSize, faceCount,
+                           atlas.width, atlas.height, atlas.format, budget? budgetCodepointCount : 0, droppedCount };
+
+        memcpy(data, "rFAC", 4);
+        memcpy(data + 4, header, 10*sizeof(int));
+
+        int offset = 44;
+        for (int f = 0; f < faceCount; f++)
+        {
+            int faceInfo[2] = { faces[f].baseSize, faces[f].glyphCount };
+            memcpy(data + offset, faceInfo, 2*sizeof(int));
+            offset += 8;
+        }
+
+        for (int f = 0; f < faceCount; f++)
+        {
+            memcpy(data + offset, faces[f].recs, faces[f].glyphCount*sizeof(Rectangle));
+            offset += faces[f].glyphCount*16;
+
+            for (int i = 0; i < faces[f].glyphCount; i++)
+            {
+                int glyphInfo[4] = { faces[f].glyphs[i].value, faces[f].glyphs[i].offsetX, faces[f].glyphs[i].offsetY, faces[f].glyphs[i].advanceX };
+                memcpy(data + offset, glyphInfo, 4*sizeof(int));
+                offset += 16;
+            }
+        }
+
+        if (droppedCount > 0) memcpy(data + offset, budgetDroppedCodepoints, droppedCount*sizeof(int));
+        offset += droppedCount*4;
+
+        memcpy(data + offset, atlas.data, pixelsSize);
+
+        SaveFileData(TextFormat("%s/%016llx.rfac", fontAtlasCacheDir, key), data, dataSize);
+        RL_FREE(data);
+    }
+}
+
+// Update font atlas glyphs spatial index (uniform grid), all faces sharing atlas texture included
+// NOTE: Grid is only rebuilt if atlas changed, picking is reset in that case
+static void UpdateGlyphsGrid(Texture2D texture)
+{
+    Font font = GuiGetFontFace(0);
+
+    if ((glyphGridCells != NULL) && (glyphGridTextureId == texture.id) && (glyphGridRecs == font.recs) && (glyphGridCount == font.glyphCount)) return;
+
+    RL_FREE(glyphGridCells);
+    RL_FREE(glyphGridEntries);
+    glyphGridCells = NULL;
+    glyphGridEntries = NULL;
+
+    glyphGridTextureId = texture.id;
+    glyphGridRecs = font.recs;
+    glyphGridCount = font.glyphCount;
+
+    hoveredGlyphEntry = -1;
+    selectedGlyphEntry = -1;
+    blockGlyphEntriesCount = 0;
+
+    if ((texture.id == 0) || (font.texture.id != texture.id) || (font.recs == NULL)) return;
+
+    glyphGridCols = (texture.width + FONT_ATLAS_GRID_CELL_SIZE - 1)/FONT_ATLAS_GRID_CELL_SIZE;
+    glyphGridRows = (texture.height + FONT_ATLAS_GRID_CELL_SIZE - 1)/FONT_ATLAS_GRID_CELL_SIZE;
+    glyphGridCells = (int *)RL_CALLOC(glyphGridCols*glyphGridRows + 1, sizeof(int));
+
+    // Two passes: count glyphs per cell, then fill entries (cells entries stored contiguously)
+    int *cellsFill = (int *)RL_CALLOC(glyphGridCols*glyphGridRows, sizeof(int));
+    int entriesCount = 0;
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int f = 0; f < RAYGUI_MAX_FONT_FACES; f++)
+        {
+            Font face = GuiGetFontFace(f);
+            if ((face.texture.id != texture.id) || (face.recs == NULL)) continue;
+
+            for (int i = 0; i < face.glyphCount; i++)
+            {
+                Rectangle rec = face.recs[i];
+                if ((rec.width <= 0) || (rec.height <= 0)) continue;
+
+                int x0 = (int)rec.x/FONT_ATLAS_GRID_CELL_SIZE;
+                int y0 = (int)rec.y/FONT_ATLAS_GRID_CELL_SIZE;
+                int x1 = (int)(rec.x + rec.width - 1)/FONT_ATLAS_GRID_CELL_SIZE;
+                int y1 = (int)(rec.y + rec.height - 1)/FONT_ATLAS_GRID_CELL_SIZE;
+                if (x0 < 0) x0 = 0;
+                if (y0 < 0) y0 = 0;
+                if (x1 >= glyphGridCols) x1 = glyphGridCols - 1;
+                if (y1 >= glyphGridRows) y1 = glyphGridRows - 1;
+
+                for (int y = y0; y <= y1; y++)
+                {
+                    for (int x = x0; x <= x1; x++)
+                    {
+                        int cell = y*glyphGridCols + x;
+
+                        if (pass == 0) { glyphGridCells[cell + 1]++; entriesCount++; }
+                        else
+                        {
+                            glyphGridEntries[glyphGridCells[cell] + cellsFill[cell]] = i*RAYGUI_MAX_FONT_FACES + f;
+                            cellsFill[cell]++;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            for (int c = 0; c < glyphGridCols*glyphGridRows; c++) glyphGridCells[c + 1] += glyphGridCells[c];
+            glyphGridEntries = (int *)RL_MALLOC((entriesCount + 1)*sizeof(int));
+        }
+    }
+
+    RL_FREE(cellsFill);
+}
+
+// Get glyph entry at atlas point, -1 if no glyph
+// NOTE: Only glyphs overlapping point cell are checked
+static int GetGlyphsGridEntry(Vector2 point)
+{
+    if ((glyphGridCells == NULL) || (point.x < 0) || (point.y < 0)) return -1;
+
+    int x = (int)point.x/FONT_ATLAS_GRID_CELL_SIZE;
+    int y = (int)point.y/FONT_ATLAS_GRID_CELL_SIZE;
+    if ((x >= glyphGridCols) || (y >= glyphGridRows)) return -1;
+
+    int cell = y*glyphGridCols + x;
+
+    for (int i = glyphGridCells[cell]; i < glyphGridCells[cell + 1]; i++)
+    {
+        if (CheckCollisionPointRec(point, GetGlyphEntryFont(glyphGridEntries[i]).recs[glyphGridEntries[i]/RAYGUI_MAX_FONT_FACES])) return glyphGridEntries[i];
+    }
+
+    return -1;
+}
+
+// Get glyph entry font face
+static Font GetGlyphEntryFont(int entry)
+{
+    return GuiGetFontFace(entry%RAYGUI_MAX_FONT_FACES);
+}
+
+// Update glyph entries in same Unicode block than provided entry (same font face)
+// NOTE: Only updated on picking, so highlighting does not require checking all glyphs every frame
+static void UpdateBlockGlyphs(int entry)
+{
+    blockGlyphEntriesCount = 0;
+    if (entry < 0) return;
+
+    Font font = GetGlyphEntryFont(entry);
+    int face = entry%RAYGUI_MAX_FONT_FACES;
+    int blockStart = 0, blockEnd = 0;
+
+    GetUnicodeBlockName(font.glyphs[entry/RAYGUI_MAX_FONT_FACES].value, &blockStart, &blockEnd);
+
+    RL_FREE(blockGlyphEntries);
+    blockGlyphEntries = (int *)RL_MALLOC(font.glyphCount*sizeof(int));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if ((font.glyphs[i].value >= blockStart) && (font.glyphs[i].value <= blockEnd))
+        {
+            blockGlyphEntries[blockGlyphEntriesCount] = i*RAYGUI_MAX_FONT_FACES + face;
+            blockGlyphEntriesCount++;
+        }
+    }
+}
+
+// Get Unicode block name and range for codepoint
+// NOTE: Only most common blocks are named, other codepoints grouped in 128 codepoints ranges
+static const char *GetUnicodeBlockName(int codepoint, int *blockStart, int *blockEnd)
+{
+    static const struct { int start; int end; const char *name; } blocks[] = {
+        { 0x0000, 0x007f, "Basic Latin" }, { 0x0080, 0x00ff, "Latin-1 Supplement" },
+        { 0x0100, 0x017f, "Latin Extended-A" }, { 0x0180, 0x024f, "Latin Extended-B" },
+        { 0x0250, 0x02af, "IPA Extensions" }, { 0x02b0, 0x02ff, "Spacing Modifier Letters" },
+        { 0x0300, 0x036f, "Combining Diacritical Marks" }, { 0x0370, 0x03ff, "Greek and Coptic" },
+        { 0x0400, 0x04ff, "Cyrillic" }, { 0x0500, 0x052f, "Cyrillic Supplement" },
+        { 0x0530, 0x058f, "Armenian" }, { 0x0590, 0x05ff, "Hebrew" },
+        { 0x0600, 0x06ff, "Arabic" }, { 0x0900, 0x097f, "Devanagari" },
+        { 0x0e00, 0x0e7f, "Thai" }, { 0x10a0, 0x10ff, "Georgian" },
+        { 0x1100, 0x11ff, "Hangul Jamo" }, { 0x1e00, 0x1eff, "Latin Extended Additional" },
+        { 0x1f00, 0x1fff, "Greek Extended" }, { 0x2000, 0x206f, "General Punctuation" },
+        { 0x2070, 0x209f, "Superscripts and Subscripts" }, { 0x20a0, 0x20cf, "Currency Symbols" },
+        { 0x2100, 0x214f, "Letterlike Symbols" }, { 0x2150, 0x218f, "Number Forms" },
+        { 0x2190, 0x21ff, "Arrows" }, { 0x2200, 0x22ff, "Mathematical Operators" },
+        { 0x2300, 0x23ff, "Miscellaneous Technical" }, { 0x2500, 0x257f, "Box Drawing" },
+        { 0x2580, 0x259f, "Block Elements" }, { 0x25a0, 0x25ff, "Geometric Shapes" },
+        { 0x2600, 0x26ff, "Miscellaneous Symbols" }, { 0x2700, 0x27bf, "Dingbats" },
+        { 0x3000, 0x303f, "CJK Symbols and Punctuation" }, { 0x3040, 0x309f, "Hiragana" },
+        { 0x30a0, 0x30ff, "Katakana" }, { 0x3100, 0x312f, "Bopomofo" },
+        { 0x3130, 0x318f, "Hangul Compatibility Jamo" }, { 0x3400, 0x4dbf, "CJK Unified Ideographs Extension A" },
+        { 0x4e00, 0x9fff, "CJK Unified Ideographs" }, { 0xac00, 0xd7af, "Hangul Syllables" },
+        { 0xe000, 0xf8ff, "Private Use Area" }, { 0xf900, 0xfaff, "CJK Compatibility Ideographs" },
+        { 0xfb00, 0xfb4f, "Alphabetic Presentation Forms" }, { 0xfe30, 0xfe4f, "CJK Compatibility Forms" },
+        { 0xff00, 0xffef, "Halfwidth and Fullwidth Forms" }, { 0x1f300, 0x1f5ff, "Miscellaneous Symbols and Pictographs" },
+        { 0x1f600, 0x1f64f, "Emoticons" }
+    };
+
+    for (int i = 0; i < (int)(sizeof(blocks)/sizeof(blocks[0])); i++)
+    {
+        if ((codepoint >= blocks[i].start) && (codepoint <= blocks[i].end))
+        {
+            *blockStart = blocks[i].start;
+            *blockEnd = blocks[i].end;
+            return blocks[i].name;
+        }
+    }
+
+    *blockStart = codepoint & ~0x7f;
+    *blockEnd = *blockStart + 0x7f;
+
+    return TextFormat("U+%04X..U+%04X", *blockStart, *blockEnd);
+}
+
 #endif // GUI_WINDOW_FONT_ATLAS_IMPLEMENTATION
@@ -118,9 +118,21 @@ static const char *helpLines[] = {
     "LCTRL + O - Open style file (.rgs)",
     "LCTRL + S - Save style file (.rgs)",
     "LCTRL + E - Export style file",
+    "LCTRL + T - New style tab",
+    "LCTRL + TAB - Select next style tab",
+    "LCTRL + L - Push style as layer",
+    "LCTRL + LSHIFT + L - Pop style layer",
+    "LCTRL + LSHIFT + S - Save style layer (.rgs)",
+    "LSHIFT + Drop (.rgs) - Push style file as layer",
+    "LALT + Drop (.rgs) - Replace base style layer",
     "-Tool Controls",
     "F5 - Show Style table",
     "F6 - Show Font atlas",
+    "F7 - Show Style parameters",
+    "Drop (.rgsp) - Load style parameters",
+    "RMB (Font atlas) - Pick glyph, show info",
+    "LCTRL + Click - Select several controls/properties",
+    "LCTRL + Z - Undo controls properties change",
     "1,2,3,4 - Force controls state",
     "LCTRL + R - Reload style template",
     "-Tool Visuals",
@@ -197,6 +209,8 @@ void GuiWindowHelp(GuiWindowHelpState *state)
 
             if (state->dragMode)
             {
+                GuiRedrawAll();     // Window moved, full redraw required
+
                 state->windowBounds.x = (mousePosition.x - state->panOffset.x);
                 state->windowBounds.y = (mousePosition.y - state->panOffset.y);
 
@@ -0,0 +1,241 @@
+/*******************************************************************************************
+*
+*   Window Style Parameters
+*
+*   MODULE USAGE:
+*       #define GUI_WINDOW_PARAMS_IMPLEMENTATION
+*       #include "gui_window_params.h"
+*
+*   On game init call:  GuiWindowParamsState state = InitGuiWindowParams();
+*   On game draw call:  GuiWindowParams(&state);
+*
+*   NOTE: Style parameters are edited live, state.paramsChanged is set when parameters changed,
+*   parameters compilation into current style is expected to be done by the tool
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include "raylib.h"
+
+// WARNING: raygui implementation is expected to be defined before including this header
+// WARNING: rgs library (rgs.h) is expected to be included before including this header
+
+#ifndef GUI_WINDOW_PARAMS_H
+#define GUI_WINDOW_PARAMS_H
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+//...
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Gui window structure declaration
+typedef struct {
+    bool windowActive;
+
+    Rectangle windowBounds;
+    Vector2 panOffset;
+    bool dragMode;
+    bool supportDrag;
+
+    rgs_params params;          // Style parameters edited
+    bool paramsChanged;         // Style parameters changed (compilation required)
+
+    bool btnRandomPressed;
+    bool btnSavePressed;
+
+} GuiWindowParamsState;
+
+#ifdef __cplusplus
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+//...
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+GuiWindowParamsState InitGuiWindowParams(void);
+void GuiWindowParams(GuiWindowParamsState *state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GUI_WINDOW_PARAMS_H
+
+/***********************************************************************************
+*
+*   GUI_WINDOW_PARAMS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(GUI_WINDOW_PARAMS_IMPLEMENTATION)
+
+#include "raygui.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define GUIPARAMSWINDOW_LINE_HEIGHT         22
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// ...
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *cmbHarmonyText = "MONOCHROME;COMPLEMENTARY FOCUSED;COMPLEMENTARY PRESSED;SPLIT";
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init window style parameters
+GuiWindowParamsState InitGuiWindowParams(void)
+{
+    GuiWindowParamsState state = { 0 };
+
+    state.windowActive = false;
+    state.supportDrag = true;
+
+    // NOTE: Window placed over controls list by default, style preview kept visible while editing
+    state.windowBounds = (Rectangle){ 10, 52, 320, (float)(24 + 8 + RGS_PARAMS_COUNT*GUIPARAMSWINDOW_LINE_HEIGHT + 40) };
+    state.panOffset = (Vector2){ 0, 0 };
+    state.dragMode = false;
+
+    rgs_params_default(&state.params);
+    state.paramsChanged = false;
+
+    state.btnRandomPressed = false;
+    state.btnSavePressed = false;
+
+    return state;
+}
+
+// Gui window style parameters
+void GuiWindowParams(GuiWindowParamsState *state)
+{
+    state->paramsChanged = false;
+    state->btnRandomPressed = false;
+    state->btnSavePressed = false;
+
+    if (state->windowActive)
+    {
+        // Update window dragging
+        //----------------------------------------------------------------------------------------
+        if (state->supportDrag)
+        {
+            Vector2 mousePosition = GetMousePosition();
+
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+            {
+                // Window can be dragged from the top window bar
+                if (CheckCollisionPointRec(mousePosition, (Rectangle){ state->windowBounds.x, state->windowBounds.y, state->windowBounds.width, RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT }))
+                {
+                    state->dragMode = true;
+                    state->panOffset.x = mousePosition.x - state->windowBounds.x;
+                    state->panOffset.y = mousePosition.y - state->windowBounds.y;
+                }
+            }
+
+            if (state->dragMode)
+            {
+                GuiRedrawAll();     // Window moved, full redraw required
+
+                state->windowBounds.x = (mousePosition.x - state->panOffset.x);
+                state->windowBounds.y = (mousePosition.y - state->panOffset.y);
+
+                // Check screen limits to avoid moving out of screen
+                if (state->windowBounds.x < 0) state->windowBounds.x = 0;
+                else if (state->windowBounds.x > (GetScreenWidth() - state->windowBounds.width)) state->windowBounds.x = GetScreenWidth() - state->windowBounds.width;
+
+                if (state->windowBounds.y < 40) state->windowBounds.y = 40;
+                else if (state->windowBounds.y > (GetScreenHeight() - state->windowBounds.height - 24)) state->windowBounds.y = GetScreenHeight() - state->windowBounds.height - 24;
+
+                if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) state->dragMode = false;
+            }
+        }
+        //----------------------------------------------------------------------------------------
+
+        // Draw window and controls
+        //----------------------------------------------------------------------------------------
+        state->windowActive = !GuiWindowBox(state->windowBounds, "#29#Parametric Style");
+
+        // Parameters edition, one line per parameter (same order as rgs_params)
+        // NOTE: Harmony rule combobox is drawn last, it could overlap next lines when opened
+        int harmonyIndex = -1;
+
+        for (int i = 0; i < RGS_PARAMS_COUNT; i++)
+        {
+            const rgs_param_info *info = rgs_params_get_info(i);
+            float posY = state->windowBounds.y + 24 + 8 + i*GUIPARAMSWINDOW_LINE_HEIGHT;
+            float value = rgs_params_get(&state->params, i);
+            float prevValue = value;
+
+            GuiLabel((Rectangle){ state->windowBounds.x + 10, posY, 120, 20 }, info->name);
+
+            if (info->type == RGS_PARAM_HARMONY) harmonyIndex = i;
+            else GuiSlider((Rectangle){ state->windowBounds.x + 130, posY + 3, 130, 14 }, NULL, (info->type == RGS_PARAM_INT)? TextFormat("%i", (int)value) : TextFormat("%.2f", value), &value, info->min, info->max);
+
+            if (value != prevValue)
+            {
+                rgs_params_set(&state->params, i, value);
+                state->paramsChanged = true;
+            }
+        }
+
+        if (harmonyIndex >= 0)
+        {
+            int harmony = (int)rgs_params_get(&state->params, harmonyIndex);
+            int prevHarmony = harmony;
+
+            GuiComboBox((Rectangle){ state->windowBounds.x + 130, state->windowBounds.y + 24 + 8 + harmonyIndex*GUIPARAMSWINDOW_LINE_HEIGHT, 180, 20 }, cmbHarmonyText, &harmony);
+
+            if (harmony != prevHarmony)
+            {
+                rgs_params_set(&state->params, harmonyIndex, (float)harmony);
+                state->paramsChanged = true;
+            }
+        }
+
+        GuiLine((Rectangle){ state->windowBounds.x, state->windowBounds.y + state->windowBounds.height - 40, state->windowBounds.width, 12 }, NULL);
+
+        float buttonsY = state->windowBounds.y + state->windowBounds.height - 30;
+        if (GuiButton((Rectangle){ state->windowBounds.x + 10, buttonsY, 96, 24 }, "#211#Reset"))
+        {
+            rgs_params_default(&state->params);
+            state->paramsChanged = true;
+        }
+        state->btnRandomPressed = GuiButton((Rectangle){ state->windowBounds.x + 112, buttonsY, 96, 24 }, "#78#Random");
+        state->btnSavePressed = GuiButton((Rectangle){ state->windowBounds.x + 214, buttonsY, 96, 24 }, "#2#Save");
+        //----------------------------------------------------------------------------------------
+    }
+}
+
+#endif // GUI_WINDOW_PARAMS_IMPLEMENTATION
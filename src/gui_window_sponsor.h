@@ -195,6 +195,8 @@ void GuiWindowSponsor(GuiWindowSponsorState *state)
 
             if (state->dragMode)
             {
+                GuiRedrawAll();     // Window moved, full redraw required
+
                 state->windowBounds.x = (mousePosition.x - state->panOffset.x);
                 state->windowBounds.y = (mousePosition.y - state->panOffset.y);
 
@@ -282,10 +284,9 @@ static bool GuiImageButton(Rectangle bounds, Texture2D texture)
     //--------------------------------------------------------------------
     if ((state != STATE_DISABLED) && !guiLocked)
     {
-        Vector2 mousePoint = GetMousePosition();
-
-        // Check button state
-        if (CheckCollisionPointRec(mousePoint, bounds))
+            // Check button state
+        // NOTE: Bounds registered for partial redraw, as any raygui control
+        if (GuiCheckMouseHover(bounds))
         {
             if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) state = STATE_PRESSED;
             else state = STATE_FOCUSED;
@@ -0,0 +1,4061 @@
+/**********************************************************************************************
+*
+*   rgs v1.0 - rGuiStyler style core library, GUI-free (no raylib/raygui required)
+*
+*   FEATURES:
+*       - Load/validate/save raygui binary style data (.rgs) from/to memory buffers
+*       - Style properties access, DEFAULT properties propagation considered
+*       - Style font data (atlas, recs, glyphs and font faces) and custom icons data
+*       - Export style as embeddable code (.h), same output as rGuiStyler tool
+*       - Read/write style data embedded on PNG images as custom chunk (rGSf)
+*       - Style files index (.rgsi): properties, colors, font hashes and charset stats,
+*         incremental update by file time/size/hash and queries without loading style files
+*       - Near-duplicate styles clusters and nearest styles search (perceptual style distance, SSE2 kernels)
+*       - Layered styles: sparse properties layers stack (base, brand, user tweaks...) lazily resolved
+*         into flat style values (only properties touched by changed layers), layer deltas generation
+*       - Parametric styles (.rgsp): a few HSV, contrast and size parameters plus harmony rule,
+*         compiled into style properties and flat style values in one pass
+*       - Font atlas block compression: alpha encoded/decoded as BC4 (DXT5) or EAC (ETC2_EAC) blocks
+*
+*   LIMITATIONS:
+*       - Font atlas is kept as stored on style loading/saving, block compression must be requested explicitly
+*       - Unknown style extension chunks are skipped on loading (same as raygui)
+*       - Style index only considers binary style data (.rgs or PNG rGSf chunk), text style files are not indexed
+*       - Compressed data is decoded with a simple bounds checked inflater (corrupted DEFLATE streams rejected),
+*         slower than sinfl but enough for style data sizes; sdefl is only used for compression
+*
+*   CONFIGURATION:
+*       #define RGS_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*       #define RGS_NO_DEFLATE_IMPLEMENTATION
+*           Do not include sdefl/sinfl deflate implementation (provided by rpng),
+*           useful if already provided by another module (i.e. raylib provides sdefl/sinfl)
+*           NOTE: rpng implementation is included, do not link with another rpng implementation,
+*           if rpng implementation is already included in the same file, it is not included again
+*
+*       #define RGS_NO_STDIO
+*           Do not include FILE I/O API, only load/save from/to memory buffers
+*
+*   DEPENDENCIES: libc (C standard library), libm (C math library)
+*       rpng 1.1                - PNG chunks management and DEFLATE compression (sdefl/sinfl)
+*
+*   BUILDING:
+*       Static/shared library targets available on src/Makefile: make librgs [RGS_LIBTYPE=SHARED]
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2023 raylib technologies (@raylibtech) / Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RGS_H
+#define RGS_H
+
+#define RGS_VERSION    "1.0"
+
+// Function specifiers in case library is build/used as a shared library (Windows)
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define RGSAPI __declspec(dllexport)     // We are building the library as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED)
+        #define RGSAPI __declspec(dllimport)     // We are using the library as a Win32 shared library (.dll)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef RGSAPI
+    #define RGSAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Allow custom memory allocators
+#ifndef RGS_MALLOC
+    #define RGS_MALLOC(sz)          malloc(sz)
+#endif
+#ifndef RGS_CALLOC
+    #define RGS_CALLOC(n,sz)        calloc(n,sz)
+#endif
+#ifndef RGS_REALLOC
+    #define RGS_REALLOC(ptr,sz)     realloc(ptr,sz)
+#endif
+#ifndef RGS_FREE
+    #define RGS_FREE(ptr)           free(ptr)
+#endif
+
+// WARNING: Those values define the style data layout, they must match raygui values
+#define RGS_MAX_CONTROLS                16      // Maximum number of controls
+#define RGS_MAX_PROPS_BASE              16      // Maximum number of base properties
+#define RGS_MAX_PROPS_EXTENDED           8      // Maximum number of extended properties
+#define RGS_MAX_PROPERTIES          (RGS_MAX_CONTROLS*(RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))
+#define RGS_MAX_FONT_FACES               4      // Maximum number of font faces (main font included)
+
+#define RGS_ICON_SIZE                   16      // Size of icons in pixels (squared)
+#define RGS_ICON_MAX_ICONS             256      // Maximum number of icons
+#define RGS_ICON_DATA_ELEMENTS  (RGS_ICON_SIZE*RGS_ICON_SIZE/32)   // Icon data elements (one bit per pixel)
+
+// Style save flags
+#define RGS_SAVE_PROPS_COMPACT        0x01      // Properties compact encoding (colors dictionary + varints)
+#define RGS_SAVE_FONT_DATA_COMPRESSED 0x02      // Font recs and glyphs data compressed (DEFLATE)
+#define RGS_SAVE_FONT_ATLAS_COMPRESSED 0x04     // Font atlas image data compressed (DEFLATE)
+
+// Font atlas pixel formats used by style data (raylib PixelFormat values)
+#define RGS_PIXELFORMAT_GRAY_ALPHA       2      // PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+#define RGS_PIXELFORMAT_DXT1_RGB        14      // PIXELFORMAT_COMPRESSED_DXT1_RGB (first block compressed format)
+#define RGS_PIXELFORMAT_DXT5_RGBA       17      // PIXELFORMAT_COMPRESSED_DXT5_RGBA
+#define RGS_PIXELFORMAT_ETC2_EAC_RGBA   20      // PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA
+
+// Style index font charset stats
+#define RGS_CHARSET_BLOCKS              14      // Unicode blocks considered (rgs_index_entry.charset_mask bits)
+#define RGS_INDEX_MAX_QUERY_TERMS       16      // Maximum number of terms per query
+#define RGS_STYLE_DISTANCE_MAX      100.0f      // Style distance maximum value (0.0f for same resolved style)
+#define RGS_MAX_LAYERS                   8      // Maximum number of style layers (base layer included)
+#define RGS_PARAMS_COUNT                16      // Style parameters count (rgs_params fields)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#ifndef __cplusplus
+#include <stdbool.h>        // Boolean type
+#endif
+
+// Style result codes
+typedef enum {
+    RGS_OK = 0,                     // No error
+    RGS_ERROR_INVALID_DATA = -1,    // Invalid data provided (NULL or truncated)
+    RGS_ERROR_SIGNATURE = -2,       // Data signature is not "rGS "
+    RGS_ERROR_PROPERTIES = -3,      // Properties data not valid (ids out of range)
+    RGS_ERROR_FONT = -4,            // Font data not valid
+    RGS_ERROR_CHUNK = -5,           // Extension chunk data not valid
+    RGS_ERROR_DECOMPRESS = -6,      // Compressed data could not be decompressed to expected size
+    RGS_ERROR_PNG = -7,             // PNG data not valid or no rGSf chunk available
+    RGS_ERROR_FILE = -8,            // File could not be read/written
+    RGS_ERROR_INDEX = -9,           // Index data not valid
+    RGS_ERROR_QUERY = -10,          // Index query not valid
+    RGS_ERROR_LAYER = -11,          // Style layer not valid (out of range or layers stack full)
+    RGS_ERROR_PARAMS = -12,         // Style parameters text not valid (unknown parameter or value)
+    RGS_ERROR_VERSION = -13         // Style data version not supported (newer than library)
+} rgs_result;
+
+// Style property, same as raygui GuiStyleProp
+typedef struct {
+    unsigned short control_id;      // Control identifier
+    unsigned short property_id;     // Property identifier
+    unsigned int value;             // Property value
+} rgs_property;
+
+// Font glyph rectangle on atlas
+typedef struct {
+    float x, y, width, height;
+} rgs_rectangle;
+
+// Font glyph info (no image data)
+typedef struct {
+    int value;                      // Glyph codepoint
+    int offset_x;                   // Glyph offset X
+    int offset_y;                   // Glyph offset Y
+    int advance_x;                  // Glyph advance X
+} rgs_glyph;
+
+// Font face data, all faces share main font atlas
+typedef struct {
+    int base_size;                  // Face base size
+    int glyph_count;                // Face glyphs count (0 if face not available)
+    rgs_rectangle *recs;            // Face glyphs rectangles on atlas
+    rgs_glyph *glyphs;              // Face glyphs info
+} rgs_font_face;
+
+// Style font data
+typedef struct {
+    int type;                       // Font type: 0-NORMAL, 1-SDF
+    rgs_rectangle white_rec;        // Font white rectangle, used for shapes drawing
+    int atlas_width;                // Font atlas width
+    int atlas_height;               // Font atlas height
+    int atlas_format;               // Font atlas pixel format (raylib PixelFormat)
+    int atlas_size;                 // Font atlas data size (uncompressed)
+    unsigned char *atlas_data;      // Font atlas data (uncompressed)
+    rgs_font_face faces[RGS_MAX_FONT_FACES];   // Font faces, face 0 is main font
+} rgs_font;
+
+// Style data
+// NOTE: Properties are kept sorted by control and property ids, DEFAULT properties first
+typedef struct {
+    short version;                  // Style data version
+    short flags;                    // Style header flags
+    int property_count;             // Properties count
+    rgs_property properties[RGS_MAX_PROPERTIES];   // Properties changed from raygui default style
+
+    rgs_font font;                  // Font data (available if font.faces[0].glyph_count > 0)
+
+    int icon_count;                 // Custom icons count
+    unsigned char icons_map[RGS_ICON_MAX_ICONS/8];  // Custom icons ids bitmap
+    unsigned int *icons_data;       // Custom icons data (icon_count*RGS_ICON_DATA_ELEMENTS)
+} rgs_style;
+
+// Style index entry, style file data required for queries
+typedef struct {
+    char *file_name;                // Style file name (as provided on update)
+    long long mod_time;             // File modification time
+    int file_size;                  // File size
+    unsigned int file_hash;         // File data hash (FNV-1a)
+    int result;                     // Style loading result, only RGS_OK entries are queried
+
+    unsigned int font_hash;         // Font hash: atlas and main face glyphs data (FNV-1a), 0 if no font
+    int font_base_size;             // Font base size
+    int glyph_count;                // Font glyphs count (main face)
+    int codepoint_min;              // Font glyphs minimum codepoint
+    int codepoint_max;              // Font glyphs maximum codepoint
+    unsigned int charset_mask;      // Font glyphs Unicode blocks available (one bit per block)
+
+    int icon_count;                 // Custom icons count
+    int property_count;             // Properties count
+    rgs_property *properties;       // Style properties (same order as rgs_style)
+} rgs_index_entry;
+
+// Style index posting, one searchable key for one entry
+typedef struct {
+    unsigned long long key;         // Posting key: type (8 bit) + data (56 bit)
+    int entry;                      // Entry index
+} rgs_index_posting;
+
+// Style index cluster, near-duplicate styles
+typedef struct {
+    int representative;             // Representative entry, closest style to cluster mean style
+    int entry_count;                // Cluster entries count (representative included)
+    int *entries;                   // Cluster entries, sorted by distance to representative
+    float distance_max;             // Maximum distance to representative
+} rgs_index_cluster;
+
+// Style index (inverted index)
+// NOTE: Postings are kept sorted by key and entry, queries only require index data
+typedef struct {
+    int entry_count;                // Entries count
+    rgs_index_entry *entries;       // Entries data
+    int posting_count;              // Postings count
+    rgs_index_posting *postings;    // Postings data
+} rgs_index;
+
+// Style layers stack, sparse properties layers resolved into flat style values
+// NOTE: Layers are applied in order over raygui default style (layer 0 is base layer), same result as loading
+// layers styles in order, resolved values are only re-flattened for properties touched by changed layers
+typedef struct {
+    int layer_count;                // Layers count
+    unsigned int values[RGS_MAX_LAYERS][RGS_MAX_PROPERTIES];        // Layers properties values
+    unsigned char defined[RGS_MAX_LAYERS][RGS_MAX_PROPERTIES/8];    // Layers properties defined (one bit per property)
+    unsigned int default_values[RGS_MAX_PROPERTIES];                // raygui default style values
+    unsigned int resolved[RGS_MAX_PROPERTIES];                      // Resolved style values (same layout as raygui style data)
+    unsigned char dirty[RGS_MAX_PROPERTIES/8];                      // Resolved values pending to re-flatten (one bit per property)
+} rgs_layers;
+
+// Style parameters harmony rule, states hue derivation from base hue
+typedef enum {
+    RGS_HARMONY_MONOCHROME = 0,         // All states use base hue
+    RGS_HARMONY_COMPLEMENTARY_FOCUSED,  // Focused state hue rotated by harmony angle
+    RGS_HARMONY_COMPLEMENTARY_PRESSED,  // Pressed state hue rotated by harmony angle
+    RGS_HARMONY_SPLIT                   // Focused and pressed states hue rotated by harmony angle, opposite directions
+} rgs_harmony;
+
+// Style parameters type
+typedef enum {
+    RGS_PARAM_FLOAT = 0,            // Float value
+    RGS_PARAM_INT,                  // Integer value
+    RGS_PARAM_HARMONY               // Harmony rule (rgs_harmony), saved by name
+} rgs_param_type;
+
+// Style parameters, parametric style definition
+// NOTE: Same derivation as rGuiStyler random styles, every state gets a base color (controls fill) and
+// accent colors (border, text) from a few HSV values, accent colors value solved to reach contrast targets
+// over the state base color (WCAG contrast ratio), other properties are kept as raygui default style
+typedef struct {
+    float hue;                      // Base hue (degrees) [0..360]
+    float saturation;               // Accent colors saturation (border, text) [0..1]
+    float base_saturation;          // Base colors saturation [0..1]
+    float base_value;               // Base colors value, dark styles below 0.5 [0..1]
+    float state_shift;              // Base colors value shift per state (focused, pressed), towards accent colors [0..0.5]
+    int harmony;                    // States hue harmony rule (rgs_harmony)
+    float harmony_angle;            // Harmony hue rotation (degrees) [0..180]
+    float disabled_saturation;      // Disabled state saturation scale [0..1]
+    float text_contrast;            // Text contrast target over base colors [1..21]
+    float border_contrast;          // Border contrast target over base colors [1..21]
+    float disabled_contrast;        // Disabled state contrast target (border and text) [1..21]
+    float background_shift;         // Background value shift from base normal color [-1..1]
+    int border_width;               // Controls border width (propagated to all controls)
+    int text_size;                  // Text size
+    int text_spacing;               // Text spacing
+    int text_line_spacing;          // Text line spacing
+} rgs_params;
+
+// Style parameter info, text format name and valid range
+typedef struct {
+    const char *name;               // Parameter name (rgs_params field name)
+    int type;                       // Parameter type (rgs_param_type)
+    float min;                      // Parameter minimum value
+    float max;                      // Parameter maximum value
+} rgs_param_info;
+
+#ifdef __cplusplus
+extern "C" {                // Prevents name mangling of functions
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Style data load/save from/to memory
+RGSAPI int rgs_validate(const unsigned char *data, int size);                            // Validate style data, returns result code
+RGSAPI int rgs_load_from_memory(rgs_style *style, const unsigned char *data, int size);  // Load style data from memory, returns result code
+RGSAPI unsigned char *rgs_save_to_memory(const rgs_style *style, int flags, int *size);   // Save style data to memory (RGS_SAVE_* flags)
+RGSAPI void rgs_unload(rgs_style *style);                                                // Unload style allocated data
+RGSAPI void rgs_free(void *ptr);                                                         // Free data returned by library
+
+#if !defined(RGS_NO_STDIO)
+RGSAPI int rgs_load(rgs_style *style, const char *fileName);                  // Load style file (.rgs), returns result code
+RGSAPI int rgs_save(const rgs_style *style, const char *fileName, int flags); // Save style file (.rgs), returns result code
+#endif
+
+// Style properties access
+RGSAPI bool rgs_get_property(const rgs_style *style, int control, int property, unsigned int *value);  // Get property value, false if not defined (raygui default)
+RGSAPI int rgs_set_property(rgs_style *style, int control, int property, unsigned int value);          // Set property value, returns result code
+RGSAPI void rgs_remove_property(rgs_style *style, int control, int property);                          // Remove property, raygui default used
+
+// Style export
+RGSAPI char *rgs_export_as_code(const rgs_style *style, const char *styleName, int *size);  // Export style as code (.h), null-terminated text
+
+// Style data embedded on PNG (rGSf chunk)
+RGSAPI int rgs_load_from_png_memory(rgs_style *style, const unsigned char *png, int size);  // Load style from PNG rGSf chunk, returns result code
+RGSAPI unsigned char *rgs_save_to_png_memory(const rgs_style *style, int flags, const unsigned char *png, int size, int *outputSize); // Save style as PNG rGSf chunk (previous one replaced)
+
+// Style index: search across style files without loading them
+RGSAPI int rgs_index_load_from_memory(rgs_index *index, const unsigned char *data, int size);     // Load style index from memory, returns result code
+RGSAPI unsigned char *rgs_index_save_to_memory(const rgs_index *index, int *size);               // Save style index to memory
+RGSAPI int rgs_index_query(const rgs_index *index, const char *query, int *results, int maxResults); // Query style index, returns matching entries count or result code
+RGSAPI void rgs_index_unload(rgs_index *index);                                                   // Unload style index allocated data
+
+// Style index similarity: near-duplicate styles, distance in [0..RGS_STYLE_DISTANCE_MAX] range
+RGSAPI rgs_index_cluster *rgs_index_find_clusters(const rgs_index *index, float threshold, int *count);   // Find near-duplicate styles clusters (2 or more entries)
+RGSAPI void rgs_index_unload_clusters(rgs_index_cluster *clusters, int count);                         // Unload near-duplicate styles clusters
+RGSAPI int rgs_index_find_nearest(const rgs_index *index, const rgs_style *style, int *results, float *distances, int maxResults); // Find nearest styles, returns results count
+
+// Style layers: sparse properties layers stack, lazily resolved into flat style values
+RGSAPI void rgs_layers_init(rgs_layers *layers);                                           // Init style layers stack (no layers, raygui default style resolved)
+RGSAPI int rgs_layers_push(rgs_layers *layers, const rgs_style *style);                    // Push style properties as top layer, returns layer index or result code
+RGSAPI void rgs_layers_pop(rgs_layers *layers);                                            // Pop top layer
+RGSAPI int rgs_layers_set_layer(rgs_layers *layers, int layer, const rgs_style *style);    // Replace layer properties with style properties, returns result code
+RGSAPI int rgs_layers_set_property(rgs_layers *layers, int layer, int control, int property, unsigned int value); // Set layer property value, returns result code
+RGSAPI void rgs_layers_remove_property(rgs_layers *layers, int layer, int control, int property);  // Remove layer property, lower layers value used
+RGSAPI int rgs_layers_resolve(rgs_layers *layers, rgs_property *changed, int maxChanged);  // Resolve pending properties, returns changed values count (changed properties filled if provided)
+RGSAPI int rgs_layers_get_delta(const rgs_layers *layers, int layer, const unsigned int *values, rgs_style *delta); // Get style values delta over layers below provided one, returns properties count or result code
+
+// Style parameters: parametric style definition compiled into style properties
+RGSAPI void rgs_params_default(rgs_params *params);                                        // Init style parameters with default values (light style)
+RGSAPI const rgs_param_info *rgs_params_get_info(int index);                               // Get style parameter info (RGS_PARAMS_COUNT parameters), NULL if out of range
+RGSAPI float rgs_params_get(const rgs_params *params, int index);                          // Get style parameter value
+RGSAPI void rgs_params_set(rgs_params *params, int index, float value);                    // Set style parameter value (clamped to parameter range)
+RGSAPI int rgs_params_compile(const rgs_params *params, rgs_style *style, unsigned int *values); // Compile style parameters into style properties and/or flat style values, returns properties count
+RGSAPI int rgs_params_load_from_text(rgs_params *params, const char *text);                // Load style parameters from text (.rgsp), returns result code
+RGSAPI char *rgs_params_save_to_text(const rgs_params *params, int *size);                 // Save style parameters as text (.rgsp), null-terminated text
+
+#if !defined(RGS_NO_STDIO)
+RGSAPI int rgs_index_load(rgs_index *index, const char *fileName);                  // Load style index file (.rgsi), returns result code
+RGSAPI int rgs_index_save(const rgs_index *index, const char *fileName);            // Save style index file (.rgsi), returns result code
+RGSAPI int rgs_index_update(rgs_index *index, const char **fileNames, int count);   // Update style index with style files (.rgs/.png), returns files loaded count
+RGSAPI int rgs_params_load(rgs_params *params, const char *fileName);              // Load style parameters file (.rgsp), returns result code
+RGSAPI int rgs_params_save(const rgs_params *params, const char *fileName);        // Save style parameters file (.rgsp), returns result code
+#endif
+
+// Font atlas block compression: alpha only, font atlas color is always white
+RGSAPI unsigned char *rgs_font_atlas_encode(const unsigned char *alpha, int width, int height, int format); // Encode font atlas alpha values into GPU blocks (DXT5/ETC2_EAC), 16 bytes per 4x4 block
+RGSAPI unsigned char *rgs_font_atlas_decode(const unsigned char *blocks, int width, int height, int format); // Decode font atlas GPU blocks (DXT5/ETC2_EAC) alpha into GRAY+ALPHA data
+RGSAPI void rgs_encode_block_bc4(const unsigned char *alpha, unsigned char *block);   // Encode 4x4 alpha values block as BC4 (8 bytes)
+RGSAPI void rgs_encode_block_eac(const unsigned char *alpha, unsigned char *block);   // Encode 4x4 alpha values block as EAC (8 bytes)
+RGSAPI void rgs_decode_block_bc4(const unsigned char *block, unsigned char *alpha);   // Decode BC4 block (8 bytes) into 4x4 alpha values
+RGSAPI void rgs_decode_block_eac(const unsigned char *block, unsigned char *alpha);   // Decode EAC block (8 bytes) into 4x4 alpha values
+
+RGSAPI const char *rgs_result_text(int result);                               // Get result code description
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RGS_H
+
+/***********************************************************************************
+*
+*   RGS IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RGS_IMPLEMENTATION)
+
+#if !defined(RGS_NO_STDIO)
+    #include <stdio.h>      // Required for: FILE, fopen(), fread(), fwrite(), fclose(), snprintf()
+    #include <sys/types.h>
+    #include <sys/stat.h>   // Required for: stat() [rgs_index_update()]
+#endif
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <string.h>         // Required for: memcmp(), memcpy(), memmove(), strlen()
+#include <stdarg.h>         // Required for: va_list, va_start(), va_end()
+#include <stddef.h>         // Required for: offsetof() [rgsParamsInfo]
+#include <math.h>           // Required for: powf(), cbrtf() [rgs_compute_features()]
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RGS_SIMD_SSE2
+    #include <emmintrin.h>  // Required for: _mm_sad_epu8() [rgs_features_distance()]
+#endif
+
+// NOTE: rpng implementation could be already included in the same file (i.e. rGuiStyler tool)
+#if !defined(RPNG_IMPLEMENTATION)
+    #define RPNG_IMPLEMENTATION
+    #if !defined(RGS_NO_DEFLATE_IMPLEMENTATION)
+        #define RPNG_DEFLATE_IMPLEMENTATION
+    #endif
+    #include "external/rpng.h"  // PNG chunks management and DEFLATE compression (sdefl/sinfl)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RGS_STYLE_VERSION           400     // Style data version saved
+#define RGS_STYLE_VERSION_COMPACT   410     // Style data version saved with properties compact encoding (raygui 4.0 does not check version, misreads it)
+#define RGS_FLAG_PROPS_COMPACT      0x01    // Style header flag: properties compact encoding
+
+#define RGS_DEFLATE_LEVEL             8     // DEFLATE compression level, same as raylib CompressData()
+#define RGS_MAX_GLYPHS          0x110000    // Maximum number of glyphs accepted on loading (Unicode codepoints range)
+
+#define RGS_INDEX_VERSION           100     // Style index data version saved
+#define RGS_INDEX_ENTRY_MIN_SIZE     54     // Style index entry minimum data size (empty file name, no properties)
+
+// Style index posting key types, stored on key upper 8 bits
+#define RGS_INDEX_KEY_PROPERTY        1     // Property: control (8 bit), property (8 bit), value (32 bit)
+#define RGS_INDEX_KEY_COLOR           2     // Color property value (32 bit), any control/property
+#define RGS_INDEX_KEY_FONT            3     // Font hash (32 bit)
+#define RGS_INDEX_KEY_FONT_SIZE       4     // Font base size
+#define RGS_INDEX_KEY_GLYPHS          5     // Font glyphs count, 0 if no font
+#define RGS_INDEX_KEY_CHARSET         6     // Font charset block id
+#define RGS_INDEX_KEY_ICONS           7     // Custom icons count
+
+// Style features vector: resolved properties, colors as CIELAB + alpha and clamped integer values
+// NOTE: 194 colors (4 bytes) + 48 base values + 126 extended values, padded to 16 bytes (SIMD kernels)
+#define RGS_FEATURES_USED           950     // Style features vector used size
+#define RGS_FEATURES_SIZE           960     // Style features vector size
+#define RGS_CLUSTER_PIVOTS            8     // Number of pivot styles used to prune distance computations
+
+#define RGS_DEFAULT_TEXT_SIZE        10     // raygui default TEXT_SIZE, used if not defined by style
+#define RGS_DEFAULT_TEXT_SPACING      1     // raygui default TEXT_SPACING, used if not defined by style
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Style data reader, all reads are bounds checked
+typedef struct {
+    const unsigned char *data;      // Data to read
+    int size;                       // Data size
+    int offset;                     // Current read offset
+    bool error;                     // Read out of bounds detected
+} rgs_reader;
+
+// DEFLATE stream decoding state, all reads/writes are bounds checked
+typedef struct {
+    const unsigned char *compData;  // Compressed data
+    int compSize;                   // Compressed data size
+    int compOffset;                 // Compressed data read offset
+    unsigned int bitBuffer;         // Bits pending to be read
+    int bitCount;                   // Bits count on buffer
+    unsigned char *data;            // Output data
+    int size;                       // Output data capacity
+    int offset;                     // Output data write offset
+    bool error;                     // Out of bounds or invalid code detected
+} rgs_inflater;
+
+// DEFLATE canonical Huffman code, symbols sorted by code length
+typedef struct {
+    short counts[16];               // Codes count per code length
+    short symbols[288];             // Code symbols (literals/lengths max count)
+} rgs_huffman;
+
+// Text output buffer, grows as required
+typedef struct {
+    char *text;                     // Text data
+    int length;                     // Text length
+    int capacity;                   // Text buffer capacity
+} rgs_text_buffer;
+
+// Font charset Unicode block
+typedef struct {
+    const char *name;               // Block name, used on queries
+    int first;                      // Block first codepoint
+    int last;                       // Block last codepoint
+} rgs_charset_block;
+
+// Style cluster item, grid cell by pivots distances
+typedef struct {
+    unsigned long long cell;        // Grid cell: x (32 bit), y (32 bit)
+    int id;                         // Style features id
+    unsigned int distances[RGS_CLUSTER_PIVOTS];     // Style distances to pivots (sequential access while linking)
+} rgs_cluster_item;
+
+// Style index query term, postings keys range to match
+typedef struct {
+    unsigned long long keyMin;      // Posting key minimum
+    unsigned long long keyMax;      // Posting key maximum
+    int control;                    // Property control, DEFAULT propagation considered if > 0
+    int property;                   // Property id
+} rgs_index_term;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Controls name text
+static const char *rgsControlText[RGS_MAX_CONTROLS] = {
+    "DEFAULT", "LABEL", "BUTTON", "TOGGLE", "SLIDER", "PROGRESSBAR", "CHECKBOX", "COMBOBOX",
+    "DROPDOWNBOX", "TEXTBOX", "VALUEBOX", "SPINNER", "LISTVIEW", "COLORPICKER", "SCROLLBAR", "STATUSBAR"
+};
+
+// Controls properties name text (common to all controls)
+static const char *rgsPropsText[RGS_MAX_PROPS_BASE] = {
+    "BORDER_COLOR_NORMAL", "BASE_COLOR_NORMAL", "TEXT_COLOR_NORMAL",
+    "BORDER_COLOR_FOCUSED", "BASE_COLOR_FOCUSED", "TEXT_COLOR_FOCUSED",
+    "BORDER_COLOR_PRESSED", "BASE_COLOR_PRESSED", "TEXT_COLOR_PRESSED",
+    "BORDER_COLOR_DISABLED", "BASE_COLOR_DISABLED", "TEXT_COLOR_DISABLED",
+    "BORDER_WIDTH", "TEXT_PADDING", "TEXT_ALIGNMENT", "RESERVED"
+};
+
+// DEFAULT extended properties name text
+static const char *rgsPropsExtText[RGS_MAX_PROPS_EXTENDED] = {
+    "TEXT_SIZE", "TEXT_SPACING", "LINE_COLOR", "BACKGROUND_COLOR",
+    "TEXT_LINE_SPACING", "TEXT_ALIGNMENT_VERTICAL", "TEXT_WRAP_MODE", "TEXT_FONT_FACE"
+};
+
+// Font atlas texture loading code, exported with block compressed font atlas (DXT5/ETC2_EAC)
+// NOTE: Exported styles do not require rGuiStyler raygui version (GuiLoadFontAtlasTexture()),
+// code is guarded, so multiple exported styles can be included in the same file
+static const char *rgsFontAtlasDecodeCode =
+    "// Font atlas texture loading, block compressed atlas alpha decoded on CPU if format not supported by GPU\n"
+    "// NOTE: Same as rGuiStyler raygui GuiLoadFontAtlasTexture(), provided for raygui versions not including it\n"
+    "#if !defined(GUI_STYLE_FONT_ATLAS_DECODE)\n"
+    "#define GUI_STYLE_FONT_ATLAS_DECODE\n"
+    "static Texture2D GuiStyleLoadFontAtlasTexture(Image atlas)\n"
+    "{\n"
+    "    // NOTE: Texture loading fails (id = 0) if compressed format is not supported by GPU\n"
+    "    Texture2D texture = LoadTextureFromImage(atlas);\n"
+    "\n"
+    "    if ((texture.id == 0) && ((atlas.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA) || (atlas.format == PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)))\n"
+    "    {\n"
+    "        // EAC alpha modifiers tables\n"
+    "        static const signed char eacModifiers[16][8] = {\n"
+    "            { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },\n"
+    "            { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },\n"
+    "            { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },\n"
+    "            { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },\n"
+    "            { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },\n"
+    "            { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },\n"
+    "            { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },\n"
+    "            { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }\n"
+    "        };\n"
+    "\n"
+    "        // Decode alpha blocks into GRAY+ALPHA data (BC4 on DXT5, EAC on ETC2_EAC), font atlas color is always white\n"
+    "        unsigned char *data = (unsigned char *)RAYGUI_CALLOC(atlas.width*atlas.height*2, 1);\n"
+    "        int blocksX = (atlas.width + 3)/4;\n"
+    "        int blocksY = (atlas.height + 3)/4;\n"
+    "\n"
+    "        for (int by = 0; by < blocksY; by++)\n"
+    "        {\n"
+    "            for (int bx = 0; bx < blocksX; bx++)\n"
+    "            {\n"
+    "                // NOTE: Every block is 16 bytes: alpha block (8 bytes) followed by color block (8 bytes)\n"
+    "                const unsigned char *block = (const unsigned char *)atlas.data + (by*blocksX + bx)*16;\n"
+    "                unsigned char alpha[16] = { 0 };\n"
+    "                unsigned long long bits = 0;\n"
+    "\n"
+    "                if (atlas.format == PIXELFORMAT_COMPRESSED_DXT5_RGBA)\n"
+    "                {\n"
+    "                    // BC4: two endpoints and 3-bit indices (little-endian, row-major)\n"
+    "                    unsigned char palette[8] = { block[0], block[1], 0 };\n"
+    "\n"
+    "                    if (block[0] > block[1]) for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*block[0] + i*block[1] + 3)/7);\n"
+    "                    else\n"
+    "                    {\n"
+    "                        for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*block[0] + i*block[1] + 2)/5);\n"
+    "                        palette[6] = 0;\n"
+    "                        palette[7] = 255;\n"
+    "                    }\n"
+    "\n"
+    "                    for (int i = 0; i < 6; i++) bits |= ((unsigned long long)block[2 + i] << (8*i));\n"
+    "                    for (int i = 0; i < 16; i++) alpha[i] = palette[(bits >> (3*i)) & 0x07];\n"
+    "                }\n"
+    "                else\n"
+    "                {\n"
+    "                    // EAC: base, multiplier and modifiers table, 3-bit indices (big-endian, column-major)\n"
+    "                    int base = block[0];\n"
+    "                    int multiplier = block[1] >> 4;\n"
+    "                    int table = block[1] & 0x0f;\n"
+    "\n"
+    "                    for (int i = 0; i < 6; i++) bits = (bits << 8) | block[2 + i];\n"
+    "                    for (int i = 0; i < 16; i++)\n"
+    "                    {\n"
+    "                        int value = base + eacModifiers[table][(bits >> (45 - 3*i)) & 0x07]*multiplier;\n"
+    "                        alpha[(i%4)*4 + i/4] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));\n"
+    "                    }\n"
+    "                }\n"
+    "\n"
+    "                for (int y = 0; (y < 4) && ((by*4 + y) < atlas.height); y++)\n"
+    "                {\n"
+    "                    for (int x = 0; (x < 4) && ((bx*4 + x) < atlas.width); x++)\n"
+    "                    {\n"
+    "                        int k = ((by*4 + y)*atlas.width + bx*4 + x)*2;\n"
+    "                        data[k] = 255;\n"
+    "                        data[k + 1] = alpha[y*4 + x];\n"
+    "                    }\n"
+    "                }\n"
+    "            }\n"
+    "        }\n"
+    "\n"
+    "        Image imDecoded = { data, atlas.width, atlas.height, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };\n"
+    "        texture = LoadTextureFromImage(imDecoded);\n"
+    "        RAYGUI_FREE(data);\n"
+    "    }\n"
+    "\n"
+    "    return texture;\n"
+    "}\n"
+    "#endif\n"
+    "\n";
+
+// raygui default style (light) properties, same order as GuiLoadStyleDefault()
+// NOTE: DEFAULT base properties are propagated to all controls when resolving style values
+static const rgs_property rgsDefaultProperties[] = {
+    { 0, 0, 0x838383ff }, { 0, 1, 0xc9c9c9ff }, { 0, 2, 0x686868ff }, { 0, 3, 0x5bb2d9ff }, { 0, 4, 0xc9effeff }, { 0, 5, 0x6c9bbcff },
+    { 0, 6, 0x0492c7ff }, { 0, 7, 0x97e8ffff }, { 0, 8, 0x368bafff }, { 0, 9, 0xb5c1c2ff }, { 0, 10, 0xe6e9e9ff }, { 0, 11, 0xaeb7b8ff },
+    { 0, 12, 1 }, { 0, 13, 0 }, { 0, 14, 1 },
+    { 0, 16, 10 }, { 0, 17, 1 }, { 0, 18, 0x90abb5ff }, { 0, 19, 0xf5f5f5ff }, { 0, 20, 15 }, { 0, 21, 1 }, { 0, 22, 0 }, { 0, 23, 0 },
+    { 1, 14, 0 }, { 2, 12, 2 }, { 4, 13, 4 }, { 5, 13, 4 }, { 6, 13, 4 }, { 6, 14, 2 }, { 8, 13, 0 }, { 8, 14, 1 },
+    { 9, 13, 4 }, { 9, 14, 0 }, { 10, 13, 0 }, { 10, 14, 0 }, { 11, 13, 0 }, { 11, 14, 0 }, { 15, 13, 8 }, { 15, 14, 0 },
+    { 3, 16, 2 }, { 4, 16, 16 }, { 4, 17, 1 }, { 5, 16, 1 }, { 6, 16, 1 }, { 7, 16, 32 }, { 7, 17, 2 }, { 8, 16, 16 }, { 8, 17, 2 },
+    { 11, 16, 24 }, { 11, 17, 2 }, { 14, 12, 0 }, { 14, 17, 0 }, { 14, 16, 6 }, { 14, 18, 0 }, { 14, 19, 16 }, { 14, 20, 0 }, { 14, 21, 12 },
+    { 12, 16, 28 }, { 12, 17, 2 }, { 12, 18, 12 }, { 12, 19, 1 }, { 13, 16, 8 }, { 13, 17, 16 }, { 13, 18, 8 }, { 13, 19, 8 }, { 13, 20, 2 }
+};
+
+// EAC alpha block modifiers, by table index, used by block compressed font atlas (ETC2_EAC)
+static const signed char rgsEacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+// Font charset Unicode blocks, last block includes all glyphs out of previous blocks
+static const rgs_charset_block rgsCharsetBlocks[RGS_CHARSET_BLOCKS] = {
+    { "basic_latin", 0x20, 0x7f }, { "latin1", 0xa0, 0xff }, { "latin_ext", 0x100, 0x24f }, { "greek", 0x370, 0x3ff },
+    { "cyrillic", 0x400, 0x52f }, { "hebrew", 0x590, 0x5ff }, { "arabic", 0x600, 0x6ff }, { "devanagari", 0x900, 0x97f },
+    { "thai", 0xe00, 0xe7f }, { "symbols", 0x2000, 0x2bff }, { "kana", 0x3040, 0x30ff }, { "cjk", 0x4e00, 0x9fff },
+    { "hangul", 0xac00, 0xd7af }, { "other", 0, 0x10ffff }
+};
+
+// Style parameters info and fields offset, same order as rgs_params
+static const rgs_param_info rgsParamsInfo[RGS_PARAMS_COUNT] = {
+    { "hue", RGS_PARAM_FLOAT, 0.0f, 360.0f }, { "saturation", RGS_PARAM_FLOAT, 0.0f, 1.0f },
+    { "base_saturation", RGS_PARAM_FLOAT, 0.0f, 1.0f }, { "base_value", RGS_PARAM_FLOAT, 0.0f, 1.0f },
+    { "state_shift", RGS_PARAM_FLOAT, 0.0f, 0.5f }, { "harmony", RGS_PARAM_HARMONY, 0.0f, 3.0f },
+    { "harmony_angle", RGS_PARAM_FLOAT, 0.0f, 180.0f }, { "disabled_saturation", RGS_PARAM_FLOAT, 0.0f, 1.0f },
+    { "text_contrast", RGS_PARAM_FLOAT, 1.0f, 21.0f }, { "border_contrast", RGS_PARAM_FLOAT, 1.0f, 21.0f },
+    { "disabled_contrast", RGS_PARAM_FLOAT, 1.0f, 21.0f }, { "background_shift", RGS_PARAM_FLOAT, -1.0f, 1.0f },
+    { "border_width", RGS_PARAM_INT, 0.0f, 8.0f }, { "text_size", RGS_PARAM_INT, 6.0f, 64.0f },
+    { "text_spacing", RGS_PARAM_INT, 0.0f, 16.0f }, { "text_line_spacing", RGS_PARAM_INT, 6.0f, 96.0f }
+};
+
+static const int rgsParamsOffset[RGS_PARAMS_COUNT] = {
+    offsetof(rgs_params, hue), offsetof(rgs_params, saturation), offsetof(rgs_params, base_saturation), offsetof(rgs_params, base_value),
+    offsetof(rgs_params, state_shift), offsetof(rgs_params, harmony), offsetof(rgs_params, harmony_angle), offsetof(rgs_params, disabled_saturation),
+    offsetof(rgs_params, text_contrast), offsetof(rgs_params, border_contrast), offsetof(rgs_params, disabled_contrast), offsetof(rgs_params, background_shift),
+    offsetof(rgs_params, border_width), offsetof(rgs_params, text_size), offsetof(rgs_params, text_spacing), offsetof(rgs_params, text_line_spacing)
+};
+
+// Style parameters harmony rules name, used on text format
+static const char *rgsHarmonyText[4] = { "monochrome", "complementary_focused", "complementary_pressed", "split" };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int rgs_read_int(rgs_reader *reader);                            // Read int value
+static short rgs_read_short(rgs_reader *reader);                        // Read short value
+static const unsigned char *rgs_read_bytes(rgs_reader *reader, int count);  // Read bytes, returns pointer to data (NULL if out of bounds)
+static unsigned long long rgs_read_varint(rgs_reader *reader);          // Read variable-length integer (LEB128)
+static int rgs_write_varint(unsigned char *buffer, unsigned long long value);   // Write variable-length integer (LEB128), returns bytes written
+
+static unsigned char *rgs_compress(const unsigned char *data, int size, int *compSize);            // Compress data (DEFLATE)
+static unsigned char *rgs_decompress(const unsigned char *compData, int compSize, int size, int *result); // Decompress data (DEFLATE), NULL on error (result code provided)
+static int rgs_inflate(unsigned char *data, int size, const unsigned char *compData, int compSize);   // Decompress DEFLATE stream, returns data size or -1 if stream not valid
+static int rgs_read_font_data(rgs_reader *reader, int glyphCount, rgs_rectangle **recs, rgs_glyph **glyphs, bool compSizeRead); // Read font recs and glyphs data
+
+static int rgs_find_property(const rgs_style *style, int control, int property);   // Find property index, -1 if not found
+static int rgs_load_font_faces(rgs_style *style, rgs_reader *reader);   // Load font faces chunk (FNTF)
+static int rgs_load_icons(rgs_style *style, rgs_reader *reader);        // Load custom icons chunk (ICNS)
+
+static int rgs_png_find_chunk(const unsigned char *png, int size, const char *type, int *offset, int *length); // Find PNG chunk, returns result code
+
+static void rgs_text_append(rgs_text_buffer *buffer, const char *format, ...);     // Append formatted text to buffer
+static void rgs_text_case(char *dst, const char *src, int mode, int maxLength);    // Convert text case: 0-lower, 1-upper, 2-pascal
+static bool rgs_text_equal_nocase(const char *text1, const char *text2);           // Check if texts are equal, case insensitive
+
+static unsigned int rgs_hash_fnv1a(unsigned int hash, const unsigned char *data, int size);   // Compute data hash (FNV-1a), continuing from previous hash
+static void rgs_index_entry_load(rgs_index_entry *entry, const unsigned char *data, int size); // Load index entry data from style data (.rgs or PNG)
+static void rgs_index_entry_unload(rgs_index_entry *entry);             // Unload index entry allocated data
+static void rgs_index_build_postings(rgs_index *index);                 // Build index postings from entries data
+static int rgs_index_compare_postings(const void *a, const void *b);    // Compare postings by key and entry [qsort()]
+static int rgs_index_lower_bound(const rgs_index *index, unsigned long long key);   // Find first posting with key not less than provided
+static int rgs_index_parse_term(const char *text, rgs_index_term *term);            // Parse query term, returns result code
+static void rgs_index_match_term(const rgs_index *index, const rgs_index_term *term, int termId, int *entryTerm, int *entryMatches); // Match query term postings
+#if !defined(RGS_NO_STDIO)
+static unsigned char *rgs_read_file(const char *fileName, int *size);   // Read file data, NULL if not available
+static int rgs_index_compare_names(const void *a, const void *b);       // Compare entries by file name [qsort(), bsearch()]
+#endif
+
+static void rgs_resolve_properties(const rgs_property *properties, int count, unsigned int *values); // Resolve style values (raygui default style + properties)
+static void rgs_compute_features(const unsigned int *values, const float *linearTable, unsigned char *features); // Compute style features vector from resolved values
+static unsigned int rgs_features_distance(const unsigned char *features1, const unsigned char *features2, unsigned int limit); // Compute features distance (L1), early exit over limit
+static unsigned char *rgs_index_load_features(const rgs_index *index, int *entries, int *count);   // Compute index loaded entries features, returns features data
+static void rgs_init_linear_table(float *table);                        // Init sRGB to linear color components table (256 values)
+static int rgs_cluster_find(int *parent, int id);                       // Find cluster root (union-find, path halving)
+static void rgs_cluster_link(const unsigned char *features, const rgs_cluster_item *item1, const rgs_cluster_item *item2, int *parent, unsigned int limit); // Link styles clusters if styles distance is not over limit
+static int rgs_compare_cluster_items(const void *a, const void *b);     // Compare cluster items by grid cell and id [qsort()]
+static int rgs_compare_keys(const void *a, const void *b);              // Compare 64bit sorting keys [qsort()]
+static int rgs_compare_clusters(const void *a, const void *b);          // Compare clusters by entries count [qsort()]
+static void rgs_layers_mark(rgs_layers *layers, int control, int property);    // Mark resolved values touched by layer property as pending
+static unsigned int rgs_layers_value(const rgs_layers *layers, int layerCount, int id);  // Get property value resolved from layers below provided count
+static unsigned int rgs_color_from_hsv(float hue, float saturation, float value);         // Get color (RGBA) from HSV values, same as raylib ColorFromHSV()
+static float rgs_color_luminance(unsigned int color, const float *linearTable);           // Get color relative luminance (WCAG)
+static unsigned int rgs_params_contrast_color(float hue, float saturation, unsigned int baseColor, float contrast, const float *linearTable); // Get accent color reaching contrast target over base color
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Validate style data, returns result code
+// NOTE: Style data is fully loaded (compressed data included) and unloaded
+int rgs_validate(const unsigned char *data, int size)
+{
+    rgs_style *style = (rgs_style *)RGS_CALLOC(1, sizeof(rgs_style));
+    int result = rgs_load_from_memory(style, data, size);
+
+    rgs_unload(style);
+    RGS_FREE(style);
+
+    return result;
+}
+
+// Load style data from memory, returns result code
+// NOTE: Style is reset before loading, on error style is left empty
+int rgs_load_from_memory(rgs_style *style, const unsigned char *data, int size)
+{
+    if (style == NULL) return RGS_ERROR_INVALID_DATA;
+
+    memset(style, 0, sizeof(rgs_style));
+
+    if ((data == NULL) || (size < 12)) return RGS_ERROR_INVALID_DATA;
+    if (memcmp(data, "rGS ", 4) != 0) return RGS_ERROR_SIGNATURE;
+
+    rgs_reader reader = { data, size, 4, false };
+    int result = RGS_OK;
+
+    style->version = rgs_read_short(&reader);
+    style->flags = rgs_read_short(&reader);
+    int propertyCount = rgs_read_int(&reader);
+
+    if (style->version > RGS_STYLE_VERSION_COMPACT) return RGS_ERROR_VERSION;
+    if ((propertyCount < 0) || (propertyCount > RGS_MAX_PROPERTIES)) return RGS_ERROR_PROPERTIES;
+
+    // Load properties, compact encoding defined by header flags (version 410 required)
+    // NOTE: Compact encoding stores a colors dictionary followed by properties as
+    // [1 byte: controlId << 4 | propertyId & 0x0f][varint: payload << 2 | extended << 1 | dictionary]
+    bool compactProps = ((style->version >= RGS_STYLE_VERSION_COMPACT) && ((style->flags & RGS_FLAG_PROPS_COMPACT) != 0));
+    unsigned int *colors = NULL;
+    unsigned int colorCount = 0;
+
+    if (compactProps)
+    {
+        unsigned long long count = rgs_read_varint(&reader);
+        if ((count > RGS_MAX_PROPERTIES) || (count*4 > (unsigned long long)(reader.size - reader.offset))) return RGS_ERROR_PROPERTIES;
+
+        colorCount = (unsigned int)count;
+        colors = (unsigned int *)RGS_CALLOC(colorCount + 1, sizeof(unsigned int));
+        for (unsigned int i = 0; i < colorCount; i++) colors[i] = (unsigned int)rgs_read_int(&reader);
+    }
+
+    for (int i = 0; (i < propertyCount) && !reader.error; i++)
+    {
+        int controlId = 0;
+        int propertyId = 0;
+        unsigned int value = 0;
+
+        if (compactProps)
+        {
+            const unsigned char *ids = rgs_read_bytes(&reader, 1);
+            unsigned long long code = rgs_read_varint(&reader);
+            if (ids == NULL) break;
+
+            controlId = ids[0] >> 4;
+            propertyId = (ids[0] & 0x0f) + ((code & 0x02)? RGS_MAX_PROPS_BASE : 0);
+
+            if (code & 0x01)
+            {
+                if ((code >> 2) >= colorCount) { result = RGS_ERROR_PROPERTIES; break; }
+                value = colors[code >> 2];
+            }
+            else
+            {
+                unsigned int zigzag = (unsigned int)(code >> 2);
+                value = (zigzag >> 1) ^ (0u - (zigzag & 1));
+            }
+        }
+        else
+        {
+            controlId = rgs_read_short(&reader);
+            propertyId = rgs_read_short(&reader);
+            value = (unsigned int)rgs_read_int(&reader);
+        }
+
+        if ((controlId < 0) || (controlId >= RGS_MAX_CONTROLS) ||
+            (propertyId < 0) || (propertyId >= (RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))) { result = RGS_ERROR_PROPERTIES; break; }
+
+        rgs_set_property(style, controlId, propertyId, value);
+    }
+
+    RGS_FREE(colors);
+
+    if ((result == RGS_OK) && reader.error) result = RGS_ERROR_INVALID_DATA;
+
+    // Load font data (if embedded)
+    if (result == RGS_OK)
+    {
+        int fontDataSize = rgs_read_int(&reader);
+
+        if (reader.error) result = RGS_ERROR_INVALID_DATA;
+        else if (fontDataSize > 0)
+        {
+            rgs_font *font = &style->font;
+            int fontImageUncompSize = 0;
+            int fontImageCompSize = 0;
+
+            font->faces[0].base_size = rgs_read_int(&reader);
+            font->faces[0].glyph_count = rgs_read_int(&reader);
+            font->type = rgs_read_int(&reader);
+            const unsigned char *whiteRec = rgs_read_bytes(&reader, 16);
+            if (whiteRec != NULL) memcpy(&font->white_rec, whiteRec, 16);
+
+            fontImageUncompSize = rgs_read_int(&reader);
+            fontImageCompSize = rgs_read_int(&reader);
+            font->atlas_width = rgs_read_int(&reader);
+            font->atlas_height = rgs_read_int(&reader);
+            font->atlas_format = rgs_read_int(&reader);
+
+            if (reader.error || (font->faces[0].glyph_count <= 0) || (fontImageUncompSize <= 0) || (fontImageCompSize < 0) ||
+                (font->atlas_width <= 0) || (font->atlas_height <= 0)) result = RGS_ERROR_FONT;
+            else if ((fontImageCompSize > 0) && (fontImageCompSize != fontImageUncompSize))
+            {
+                // Font atlas image data compressed (DEFLATE)
+                const unsigned char *compData = rgs_read_bytes(&reader, fontImageCompSize);
+
+                if (compData == NULL) result = RGS_ERROR_FONT;
+                else font->atlas_data = rgs_decompress(compData, fontImageCompSize, fontImageUncompSize, &result);
+            }
+            else
+            {
+                const unsigned char *atlasData = rgs_read_bytes(&reader, fontImageUncompSize);
+
+                if (atlasData == NULL) result = RGS_ERROR_FONT;
+                else
+                {
+                    font->atlas_data = (unsigned char *)RGS_MALLOC(fontImageUncompSize);
+                    memcpy(font->atlas_data, atlasData, fontImageUncompSize);
+                }
+            }
+
+            if (result == RGS_OK)
+            {
+                font->atlas_size = fontImageUncompSize;
+
+                // NOTE: Version 400 adds the compression size parameter for recs and glyphs data
+                result = rgs_read_font_data(&reader, font->faces[0].glyph_count, &font->faces[0].recs, &font->faces[0].glyphs, (style->version >= 400));
+            }
+        }
+    }
+
+    // Load style extension chunks (if available), placed after font data
+    // NOTE: Every chunk is defined as [4 bytes id][int size][size bytes of data], unknown chunks are skipped
+    while ((result == RGS_OK) && ((reader.offset + 8) <= reader.size))
+    {
+        const unsigned char *chunkId = rgs_read_bytes(&reader, 4);
+        int chunkSize = rgs_read_int(&reader);
+
+        if ((chunkSize < 0) || ((reader.offset + chunkSize) > reader.size)) { result = RGS_ERROR_CHUNK; break; }
+
+        rgs_reader chunkReader = { reader.data + reader.offset, chunkSize, 0, false };
+
+        if (memcmp(chunkId, "FNTF", 4) == 0) result = rgs_load_font_faces(style, &chunkReader);
+        else if (memcmp(chunkId, "ICNS", 4) == 0) result = rgs_load_icons(style, &chunkReader);
+
+        reader.offset += chunkSize;
+    }
+
+    if (result != RGS_OK) rgs_unload(style);
+
+    return result;
+}
+
+// Save style data to memory (RGS_SAVE_* flags)
+// NOTE: Data layout matches rGuiStyler saved files, same options produce same data
+unsigned char *rgs_save_to_memory(const rgs_style *style, int flags, int *size)
+{
+    *size = 0;
+    if (style == NULL) return NULL;
+
+    const rgs_font *font = &style->font;
+    bool fontEmbedded = ((font->faces[0].glyph_count > 0) && (font->atlas_data != NULL));
+
+    // Compute required buffer size (worst case)
+    int bufferSize = 12 + 8 + style->property_count*(8 + 11) + 4;
+    if (fontEmbedded)
+    {
+        bufferSize += 52 + sdefl_bound(font->atlas_size) + 8;
+        for (int f = 0; f < RGS_MAX_FONT_FACES; f++) bufferSize += 16 + 2*(4 + sdefl_bound(font->faces[f].glyph_count*16));
+    }
+    bufferSize += 48 + sdefl_bound(style->icon_count*RGS_ICON_DATA_ELEMENTS*4);
+
+    unsigned char *buffer = (unsigned char *)RGS_CALLOC(bufferSize, 1);
+    int dataSize = 0;
+
+    // NOTE: Compact properties encoding bumps data version, so loaders not supporting it reject the data
+    short version = (flags & RGS_SAVE_PROPS_COMPACT)? RGS_STYLE_VERSION_COMPACT : RGS_STYLE_VERSION;
+    short reserved = (flags & RGS_SAVE_PROPS_COMPACT)? RGS_FLAG_PROPS_COMPACT : 0;
+
+    memcpy(buffer, "rGS ", 4);
+    memcpy(buffer + 4, &version, sizeof(short));
+    memcpy(buffer + 6, &reserved, sizeof(short));
+    memcpy(buffer + 8, &style->property_count, sizeof(int));
+    dataSize += 12;
+
+    if (flags & RGS_SAVE_PROPS_COMPACT)
+    {
+        // Compact properties encoding: colors dictionary + packed ids + varint values
+        // NOTE: Only values repeated and large enough (usually colors) are added to dictionary,
+        // sorted by usage, so most used colors get the smaller indices
+        unsigned int colors[RGS_MAX_PROPERTIES] = { 0 };
+        int colorUsage[RGS_MAX_PROPERTIES] = { 0 };
+        int colorCount = 0;
+
+        for (int i = 0; i < style->property_count; i++)
+        {
+            int value = (int)style->properties[i].value;
+            unsigned int zigzag = ((unsigned int)value << 1) ^ (unsigned int)(value >> 31);
+            if (((unsigned long long)zigzag << 2) < (1 << 14)) continue;    // Value fits in 2 bytes, not worth a reference
+
+            int k = 0;
+            for (; k < colorCount; k++) if (colors[k] == (unsigned int)value) break;
+
+            if (k == colorCount) { colors[colorCount] = (unsigned int)value; colorCount++; }
+            colorUsage[k]++;
+        }
+
+        // Remove values used only once and sort by usage (insertion sort, small list)
+        int usedColorCount = 0;
+        for (int k = 0; k < colorCount; k++)
+        {
+            if (colorUsage[k] < 2) continue;
+
+            unsigned int color = colors[k];
+            int usage = colorUsage[k];
+            int n = usedColorCount;
+
+            while ((n > 0) && (colorUsage[n - 1] < usage)) { colors[n] = colors[n - 1]; colorUsage[n] = colorUsage[n - 1]; n--; }
+
+            colors[n] = color;
+            colorUsage[n] = usage;
+            usedColorCount++;
+        }
+        colorCount = usedColorCount;
+
+        dataSize += rgs_write_varint(buffer + dataSize, colorCount);
+        for (int k = 0; k < colorCount; k++)
+        {
+            memcpy(buffer + dataSize, &colors[k], sizeof(unsigned int));
+            dataSize += 4;
+        }
+
+        for (int i = 0; i < style->property_count; i++)
+        {
+            const rgs_property *prop = &style->properties[i];
+            int value = (int)prop->value;
+            unsigned long long code = (prop->property_id >= RGS_MAX_PROPS_BASE)? 0x02 : 0;
+
+            int k = 0;
+            for (; k < colorCount; k++) if (colors[k] == prop->value) break;
+
+            if (k < colorCount) code |= (((unsigned long long)k << 2) | 0x01);
+            else code |= ((unsigned long long)(((unsigned int)value << 1) ^ (unsigned int)(value >> 31)) << 2);
+
+            buffer[dataSize] = (unsigned char)((prop->control_id << 4) | (prop->property_id & 0x0f));
+            dataSize += 1;
+            dataSize += rgs_write_varint(buffer + dataSize, code);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < style->property_count; i++)
+        {
+            short controlId = (short)style->properties[i].control_id;
+            short propertyId = (short)style->properties[i].property_id;
+
+            memcpy(buffer + dataSize, &controlId, sizeof(short));
+            memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
+            memcpy(buffer + dataSize + 4, &style->properties[i].value, sizeof(int));
+            dataSize += 8;
+        }
+    }
+
+    if (fontEmbedded)
+    {
+        const rgs_font_face *main = &font->faces[0];
+        int fontImageCompSize = font->atlas_size;
+        unsigned char *compData = NULL;
+
+        if (flags & RGS_SAVE_FONT_ATLAS_COMPRESSED) compData = rgs_compress(font->atlas_data, font->atlas_size, &fontImageCompSize);
+
+        // NOTE: Actually, fontDataSize is only used to check that there is font data included in the file
+        int fontDataSize = 32 + fontImageCompSize + main->glyph_count*32;
+
+        memcpy(buffer + dataSize, &fontDataSize, sizeof(int));
+        memcpy(buffer + dataSize + 4, &main->base_size, sizeof(int));
+        memcpy(buffer + dataSize + 8, &main->glyph_count, sizeof(int));
+        memcpy(buffer + dataSize + 12, &font->type, sizeof(int));
+        memcpy(buffer + dataSize + 16, &font->white_rec, 16);
+        dataSize += 32;
+
+        memcpy(buffer + dataSize, &font->atlas_size, sizeof(int));
+        memcpy(buffer + dataSize + 4, &fontImageCompSize, sizeof(int));
+        memcpy(buffer + dataSize + 8, &font->atlas_width, sizeof(int));
+        memcpy(buffer + dataSize + 12, &font->atlas_height, sizeof(int));
+        memcpy(buffer + dataSize + 16, &font->atlas_format, sizeof(int));
+        memcpy(buffer + dataSize + 20, (compData != NULL)? compData : font->atlas_data, fontImageCompSize);
+        dataSize += (20 + fontImageCompSize);
+
+        RGS_FREE(compData);
+    }
+    else
+    {
+        memset(buffer + dataSize, 0, sizeof(int));
+        dataSize += 4;
+    }
+
+    // Write font recs and glyphs data, main font and faces (FNTF chunk)
+    // NOTE: Faces glyphs are packed into main font atlas, only recs and glyphs info are saved
+    int faceCount = 0;
+    int chunkSizeOffset = 0;
+
+    for (int f = 0; (f < RGS_MAX_FONT_FACES) && fontEmbedded; f++)
+    {
+        const rgs_font_face *face = &font->faces[f];
+
+        if (face->glyph_count <= 0) continue;
+
+        if (f > 0)
+        {
+            if (faceCount == 0)
+            {
+                for (int k = f; k < RGS_MAX_FONT_FACES; k++) if (font->faces[k].glyph_count > 0) faceCount++;
+
+                chunkSizeOffset = dataSize + 4;     // Chunk size is filled once data is written
+                memcpy(buffer + dataSize, "FNTF", 4);
+                memcpy(buffer + dataSize + 8, &faceCount, sizeof(int));
+                dataSize += 12;
+            }
+
+            memcpy(buffer + dataSize, &f, sizeof(int));
+            memcpy(buffer + dataSize + 4, &face->base_size, sizeof(int));
+            memcpy(buffer + dataSize + 8, &face->glyph_count, sizeof(int));
+            dataSize += 12;
+        }
+
+        int *glyphsData = (int *)RGS_MALLOC(face->glyph_count*4*sizeof(int));
+        for (int i = 0; i < face->glyph_count; i++)
+        {
+            glyphsData[4*i + 0] = face->glyphs[i].value;
+            glyphsData[4*i + 1] = face->glyphs[i].offset_x;
+            glyphsData[4*i + 2] = face->glyphs[i].offset_y;
+            glyphsData[4*i + 3] = face->glyphs[i].advance_x;
+        }
+
+        const unsigned char *blocks[2] = { (const unsigned char *)face->recs, (const unsigned char *)glyphsData };
+
+        for (int b = 0; b < 2; b++)
+        {
+            int compSize = 0;
+            unsigned char *compData = NULL;
+
+            if (flags & RGS_SAVE_FONT_DATA_COMPRESSED) compData = rgs_compress(blocks[b], face->glyph_count*16, &compSize);
+
+            memcpy(buffer + dataSize, &compSize, sizeof(int));
+            memcpy(buffer + dataSize + 4, (compData != NULL)? compData : blocks[b], (compData != NULL)? compSize : face->glyph_count*16);
+            dataSize += (4 + ((compData != NULL)? compSize : face->glyph_count*16));
+
+            RGS_FREE(compData);
+        }
+
+        RGS_FREE(glyphsData);
+    }
+
+    if (faceCount > 0)
+    {
+        int chunkSize = dataSize - (chunkSizeOffset + 4);
+        memcpy(buffer + chunkSizeOffset, &chunkSize, sizeof(int));
+    }
+
+    // Embed custom icons if available (ICNS chunk)
+    // NOTE: Only icons changed from default icons are saved, one bit per pixel, compressed
+    if ((style->icon_count > 0) && (style->icons_data != NULL))
+    {
+        short iconSize = RGS_ICON_SIZE;
+        short iconCount = (short)style->icon_count;
+        int iconsDataSize = style->icon_count*RGS_ICON_DATA_ELEMENTS*sizeof(unsigned int);
+        int iconsDataCompSize = 0;
+        unsigned char *iconsDataCompressed = rgs_compress((const unsigned char *)style->icons_data, iconsDataSize, &iconsDataCompSize);
+
+        // NOTE: Compressed data only used if smaller than raw data
+        if ((iconsDataCompressed == NULL) || (iconsDataCompSize >= iconsDataSize)) iconsDataCompSize = 0;
+
+        int chunkSize = 40 + ((iconsDataCompSize > 0)? iconsDataCompSize : iconsDataSize);
+
+        memcpy(buffer + dataSize, "ICNS", 4);
+        memcpy(buffer + dataSize + 4, &chunkSize, sizeof(int));
+        memcpy(buffer + dataSize + 8, &iconSize, sizeof(short));
+        memcpy(buffer + dataSize + 10, &iconCount, sizeof(short));
+        memcpy(buffer + dataSize + 12, style->icons_map, RGS_ICON_MAX_ICONS/8);
+        memcpy(buffer + dataSize + 44, &iconsDataCompSize, sizeof(int));
+        if (iconsDataCompSize > 0) memcpy(buffer + dataSize + 48, iconsDataCompressed, iconsDataCompSize);
+        else memcpy(buffer + dataSize + 48, style->icons_data, iconsDataSize);
+        dataSize += (8 + chunkSize);
+
+        RGS_FREE(iconsDataCompressed);
+    }
+
+    *size = dataSize;
+    return buffer;
+}
+
+// Unload style allocated data
+void rgs_unload(rgs_style *style)
+{
+    if (style == NULL) return;
+
+    RGS_FREE(style->font.atlas_data);
+    for (int f = 0; f < RGS_MAX_FONT_FACES; f++)
+    {
+        RGS_FREE(style->font.faces[f].recs);
+        RGS_FREE(style->font.faces[f].glyphs);
+    }
+    RGS_FREE(style->icons_data);
+
+    memset(style, 0, sizeof(rgs_style));
+}
+
+// Free data returned by library
+void rgs_free(void *ptr)
+{
+    RGS_FREE(ptr);
+}
+
+#if !defined(RGS_NO_STDIO)
+// Load style file (.rgs), returns result code
+int rgs_load(rgs_style *style, const char *fileName)
+{
+    int result = RGS_ERROR_FILE;
+    int size = 0;
+    unsigned char *data = rgs_read_file(fileName, &size);
+
+    if (data != NULL)
+    {
+        result = rgs_load_from_memory(style, data, size);
+        RGS_FREE(data);
+    }
+
+    return result;
+}
+
+// Save style file (.rgs), returns result code
+int rgs_save(const rgs_style *style, const char *fileName, int flags)
+{
+    int result = RGS_ERROR_FILE;
+    int size = 0;
+    unsigned char *data = rgs_save_to_memory(style, flags, &size);
+
+    if (data != NULL)
+    {
+        FILE *file = fopen(fileName, "wb");
+
+        if (file != NULL)
+        {
+            if (fwrite(data, 1, size, file) == (size_t)size) result = RGS_OK;
+            fclose(file);
+        }
+
+        RGS_FREE(data);
+    }
+
+    return result;
+}
+#endif
+
+// Get property value, false if not defined (raygui default)
+// NOTE: DEFAULT base properties are propagated to all controls (same as raygui loading)
+bool rgs_get_property(const rgs_style *style, int control, int property, unsigned int *value)
+{
+    int index = rgs_find_property(style, control, property);
+
+    if ((index < 0) && (control > 0) && (property < RGS_MAX_PROPS_BASE)) index = rgs_find_property(style, 0, property);
+
+    if (index >= 0)
+    {
+        if (value != NULL) *value = style->properties[index].value;
+        return true;
+    }
+
+    return false;
+}
+
+// Set property value, returns result code
+// NOTE: Properties are kept sorted, DEFAULT properties must be loaded first
+int rgs_set_property(rgs_style *style, int control, int property, unsigned int value)
+{
+    if ((control < 0) || (control >= RGS_MAX_CONTROLS) ||
+        (property < 0) || (property >= (RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))) return RGS_ERROR_PROPERTIES;
+
+    int index = rgs_find_property(style, control, property);
+
+    if (index < 0)
+    {
+        int key = control*(RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED) + property;
+
+        index = style->property_count;
+        while ((index > 0) && ((style->properties[index - 1].control_id*(RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED) + style->properties[index - 1].property_id) > key)) index--;
+
+        memmove(&style->properties[index + 1], &style->properties[index], (style->property_count - index)*sizeof(rgs_property));
+        style->property_count++;
+
+        style->properties[index].control_id = (unsigned short)control;
+        style->properties[index].property_id = (unsigned short)property;
+    }
+
+    style->properties[index].value = value;
+
+    return RGS_OK;
+}
+
+// Remove property, raygui default used
+void rgs_remove_property(rgs_style *style, int control, int property)
+{
+    int index = rgs_find_property(style, control, property);
+
+    if (index >= 0)
+    {
+        memmove(&style->properties[index], &style->properties[index + 1], (style->property_count - index - 1)*sizeof(rgs_property));
+        style->property_count--;
+    }
+}
+
+// Export style as code (.h), null-terminated text
+// NOTE: Output matches rGuiStyler exported code, font atlas data always compressed
+char *rgs_export_as_code(const rgs_style *style, const char *styleName, int *size)
+{
+    #define RGS_BYTES_TEXT_PER_LINE     20
+
+    rgs_text_buffer out = { 0 };
+    const rgs_font *font = &style->font;
+    bool fontEmbedded = ((font->faces[0].glyph_count > 0) && (font->atlas_data != NULL));
+
+    char nameLower[64] = { 0 };
+    char nameUpper[64] = { 0 };
+    char namePascal[64] = { 0 };
+    rgs_text_case(nameLower, styleName, 0, 63);
+    rgs_text_case(nameUpper, styleName, 1, 63);
+    rgs_text_case(namePascal, styleName, 2, 63);
+
+    rgs_text_append(&out, "//////////////////////////////////////////////////////////////////////////////////\n");
+    rgs_text_append(&out, "//                                                                              //\n");
+    rgs_text_append(&out, "// StyleAsCode exporter v2.0 - Style data exported as a values array            //\n");
+    rgs_text_append(&out, "//                                                                              //\n");
+    rgs_text_append(&out, "// USAGE: On init call: GuiLoadStyle%s();                                   //\n", namePascal);
+    rgs_text_append(&out, "//                                                                              //\n");
+    rgs_text_append(&out, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
+    rgs_text_append(&out, "// feedback and support:       ray[at]raylibtech.com                            //\n");
+    rgs_text_append(&out, "//                                                                              //\n");
+    rgs_text_append(&out, "// Copyright (c) 2020-2023 raylib technologies (@raylibtech)                    //\n");
+    rgs_text_append(&out, "//                                                                              //\n");
+    rgs_text_append(&out, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    // Export only properties that change from default style
+    rgs_text_append(&out, "#define %s_STYLE_PROPS_COUNT  %i\n\n", nameUpper, style->property_count);
+    rgs_text_append(&out, "// Custom style name: %s\n", styleName);
+    rgs_text_append(&out, "static const GuiStyleProp %sStyleProps[%s_STYLE_PROPS_COUNT] = {\n", nameLower, nameUpper);
+
+    for (int i = 0; i < style->property_count; i++)
+    {
+        const rgs_property *prop = &style->properties[i];
+
+        if (prop->control_id == 0)
+        {
+            rgs_text_append(&out, "    { 0, %i, 0x%08x },    // DEFAULT_%s \n", prop->property_id, prop->value,
+                (prop->property_id < RGS_MAX_PROPS_BASE)? rgsPropsText[prop->property_id] : rgsPropsExtText[prop->property_id - RGS_MAX_PROPS_BASE]);
+        }
+        else if (prop->property_id < RGS_MAX_PROPS_BASE)
+        {
+            rgs_text_append(&out, "    { %i, %i, 0x%08x },    // %s_%s \n", prop->control_id, prop->property_id, prop->value, rgsControlText[prop->control_id], rgsPropsText[prop->property_id]);
+        }
+        else rgs_text_append(&out, "    { %i, %i, 0x%08x },    // %s_EXTENDED%02i \n", prop->control_id, prop->property_id, prop->value, rgsControlText[prop->control_id], prop->property_id - RGS_MAX_PROPS_BASE + 1);
+    }
+
+    rgs_text_append(&out, "};\n\n");
+
+    unsigned int textSize = RGS_DEFAULT_TEXT_SIZE;
+    unsigned int textSpacing = RGS_DEFAULT_TEXT_SPACING;
+    rgs_get_property(style, 0, RGS_MAX_PROPS_BASE + 0, &textSize);
+    rgs_get_property(style, 0, RGS_MAX_PROPS_BASE + 1, &textSpacing);
+
+    if (fontEmbedded)
+    {
+        rgs_text_append(&out, "// WARNING: This style uses a custom font (size: %i, spacing: %i)\n\n", (int)textSize, (int)textSpacing);
+
+        // Save font image data (compressed)
+        int compDataSize = 0;
+        unsigned char *compData = rgs_compress(font->atlas_data, font->atlas_size, &compDataSize);
+
+        rgs_text_append(&out, "#define %s_STYLE_FONT_ATLAS_COMP_SIZE %i\n\n", nameUpper, compDataSize);
+        if (font->atlas_format == RGS_PIXELFORMAT_DXT5_RGBA) rgs_text_append(&out, "// Font atlas image pixels data: DXT5 blocks (BC4 alpha), DEFLATE compressed\n");
+        else if (font->atlas_format == RGS_PIXELFORMAT_ETC2_EAC_RGBA) rgs_text_append(&out, "// Font atlas image pixels data: ETC2_EAC blocks (EAC alpha), DEFLATE compressed\n");
+        else rgs_text_append(&out, "// Font atlas image pixels data: DEFLATE compressed\n");
+        rgs_text_append(&out, "static unsigned char %sFontData[%s_STYLE_FONT_ATLAS_COMP_SIZE] = { ", nameLower, nameUpper);
+        for (int i = 0; i < compDataSize - 1; i++) rgs_text_append(&out, ((i%RGS_BYTES_TEXT_PER_LINE == 0)? "0x%02x,\n    " : "0x%02x, "), compData[i]);
+        rgs_text_append(&out, "0x%02x };\n\n", compData[compDataSize - 1]);
+        RGS_FREE(compData);
+
+        // Save font recs and glyphs data, main font and faces
+        // NOTE: Individual glyphs image data not saved, it could be generated from atlas and recs
+        for (int f = 0; f < RGS_MAX_FONT_FACES; f++)
+        {
+            const rgs_font_face *face = &font->faces[f];
+
+            if (face->glyph_count <= 0) continue;
+
+            if (f == 0)
+            {
+                rgs_text_append(&out, "// Font glyphs rectangles data (on atlas)\n");
+                rgs_text_append(&out, "static const Rectangle %sFontRecs[%i] = {\n", nameLower, face->glyph_count);
+            }
+            else
+            {
+                rgs_text_append(&out, "// Font face %i glyphs rectangles data (on atlas), size: %i\n", f, face->base_size);
+                rgs_text_append(&out, "static const Rectangle %sFontFace%02iRecs[%i] = {\n", nameLower, f, face->glyph_count);
+            }
+            for (int i = 0; i < face->glyph_count; i++)
+            {
+                rgs_text_append(&out, "    { %1.0f, %1.0f, %1.0f , %1.0f },\n", face->recs[i].x, face->recs[i].y, face->recs[i].width, face->recs[i].height);
+            }
+            rgs_text_append(&out, "};\n\n");
+
+            if (f == 0)
+            {
+                rgs_text_append(&out, "// Font glyphs info data\n");
+                rgs_text_append(&out, "// NOTE: No glyphs.image data provided\n");
+                rgs_text_append(&out, "static const GlyphInfo %sFontGlyphs[%i] = {\n", nameLower, face->glyph_count);
+            }
+            else
+            {
+                rgs_text_append(&out, "// Font face %i glyphs info data\n", f);
+                rgs_text_append(&out, "static const GlyphInfo %sFontFace%02iGlyphs[%i] = {\n", nameLower, f, face->glyph_count);
+            }
+            for (int i = 0; i < face->glyph_count; i++)
+            {
+                rgs_text_append(&out, "    { %i, %i, %i, %i, { 0 }},\n", face->glyphs[i].value, face->glyphs[i].offset_x, face->glyphs[i].offset_y, face->glyphs[i].advance_x);
+            }
+            rgs_text_append(&out, "};\n\n");
+        }
+    }
+
+    // Save custom icons data (if available)
+    if ((style->icon_count > 0) && (style->icons_data != NULL))
+    {
+        rgs_text_append(&out, "#define %s_STYLE_ICONS_COUNT %i\n\n", nameUpper, style->icon_count);
+        rgs_text_append(&out, "// Custom icons ids, replacing default raygui icons\n");
+        rgs_text_append(&out, "static const int %sIconsIds[%s_STYLE_ICONS_COUNT] = { ", nameLower, nameUpper);
+        for (int i = 0, k = 0; i < RGS_ICON_MAX_ICONS; i++)
+        {
+            if (style->icons_map[i/8] & (1 << (i%8))) { rgs_text_append(&out, (k < (style->icon_count - 1))? "%i, " : "%i };\n\n", i); k++; }
+        }
+
+        rgs_text_append(&out, "// Custom icons data, one bit per pixel (%ix%i)\n", RGS_ICON_SIZE, RGS_ICON_SIZE);
+        rgs_text_append(&out, "static const unsigned int %sIconsData[%s_STYLE_ICONS_COUNT*%i] = {\n", nameLower, nameUpper, RGS_ICON_DATA_ELEMENTS);
+        for (int i = 0, k = 0; i < RGS_ICON_MAX_ICONS; i++)
+        {
+            if ((style->icons_map[i/8] & (1 << (i%8))) == 0) continue;
+
+            rgs_text_append(&out, "    ");
+            for (int j = 0; j < RGS_ICON_DATA_ELEMENTS; j++) rgs_text_append(&out, "0x%08x, ", style->icons_data[k*RGS_ICON_DATA_ELEMENTS + j]);
+            rgs_text_append(&out, "     // ICON_%03i\n", i);
+            k++;
+        }
+        rgs_text_append(&out, "};\n\n");
+    }
+
+    // Block compressed font atlas requires the font atlas texture loading code (CPU decoding fallback)
+    if (fontEmbedded && (font->atlas_format >= RGS_PIXELFORMAT_DXT1_RGB)) rgs_text_append(&out, "%s", rgsFontAtlasDecodeCode);
+
+    rgs_text_append(&out, "// Style loading function: %s\n", styleName);
+    rgs_text_append(&out, "static void GuiLoadStyle%s(void)\n{\n", namePascal);
+    rgs_text_append(&out, "    // Load style properties provided\n");
+    rgs_text_append(&out, "    // NOTE: Default properties are propagated\n");
+    rgs_text_append(&out, "    for (int i = 0; i < %s_STYLE_PROPS_COUNT; i++)\n    {\n", nameUpper);
+    rgs_text_append(&out, "        GuiSetStyle(%sStyleProps[i].controlId, %sStyleProps[i].propertyId, %sStyleProps[i].propertyValue);\n    }\n\n", nameLower, nameLower, nameLower);
+
+    if (fontEmbedded)
+    {
+        rgs_text_append(&out, "    // Custom font loading\n");
+        rgs_text_append(&out, "    // NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function\n");
+        rgs_text_append(&out, "    int %sFontDataSize = 0;\n", nameLower);
+        rgs_text_append(&out, "    unsigned char *data = DecompressData(%sFontData, %s_STYLE_FONT_ATLAS_COMP_SIZE, &%sFontDataSize);\n", nameLower, nameUpper, nameLower);
+        rgs_text_append(&out, "    Image imFont = { data, %i, %i, 1, %i };\n\n", font->atlas_width, font->atlas_height, font->atlas_format);
+        rgs_text_append(&out, "    Font font = { 0 };\n");
+        rgs_text_append(&out, "    font.baseSize = %i;\n", (int)textSize);
+        rgs_text_append(&out, "    font.glyphCount = %i;\n\n", font->faces[0].glyph_count);
+
+        rgs_text_append(&out, "    // Load texture from image\n");
+        if (font->atlas_format >= RGS_PIXELFORMAT_DXT1_RGB)
+        {
+            rgs_text_append(&out, "    // NOTE: Block compressed font atlas, decoded on CPU if format not supported by GPU\n");
+            rgs_text_append(&out, "    font.texture = GuiStyleLoadFontAtlasTexture(imFont);\n");
+        }
+        else rgs_text_append(&out, "    font.texture = LoadTextureFromImage(imFont);\n");
+        rgs_text_append(&out, "    UnloadImage(imFont);  // Uncompressed image data can be unloaded from memory\n\n");
+
+        rgs_text_append(&out, "    // Copy char recs data from global fontRecs\n");
+        rgs_text_append(&out, "    // NOTE: Required to avoid issues if trying to free font\n");
+        rgs_text_append(&out, "    font.recs = (Rectangle *)RAYGUI_MALLOC(font.glyphCount*sizeof(Rectangle));\n");
+        rgs_text_append(&out, "    memcpy(font.recs, %sFontRecs, font.glyphCount*sizeof(Rectangle));\n\n", nameLower);
+
+        rgs_text_append(&out, "    // Copy font char info data from global fontChars\n");
+        rgs_text_append(&out, "    // NOTE: Required to avoid issues if trying to free font\n");
+        rgs_text_append(&out, "    font.glyphs = (GlyphInfo *)RAYGUI_MALLOC(font.glyphCount*sizeof(GlyphInfo));\n");
+        rgs_text_append(&out, "    memcpy(font.glyphs, %sFontGlyphs, font.glyphCount*sizeof(GlyphInfo));\n\n", nameLower);
+
+        rgs_text_append(&out, "    GuiSetFont(font);\n\n");
+
+        bool faceDeclared = false;
+
+        for (int f = 1; f < RGS_MAX_FONT_FACES; f++)
+        {
+            const rgs_font_face *face = &font->faces[f];
+
+            if (face->glyph_count <= 0) continue;
+
+            if (!faceDeclared)
+            {
+                rgs_text_append(&out, "    // Additional font faces, sharing font atlas texture\n");
+                rgs_text_append(&out, "    // NOTE: Face is selected with GuiSetStyle(DEFAULT, TEXT_FONT_FACE, face)\n");
+                rgs_text_append(&out, "    Font face = { 0 };\n");
+                rgs_text_append(&out, "    face.texture = font.texture;\n\n");
+                faceDeclared = true;
+            }
+
+            rgs_text_append(&out, "    face.baseSize = %i;\n", face->base_size);
+            rgs_text_append(&out, "    face.glyphCount = %i;\n", face->glyph_count);
+            rgs_text_append(&out, "    face.recs = (Rectangle *)RAYGUI_MALLOC(face.glyphCount*sizeof(Rectangle));\n");
+            rgs_text_append(&out, "    memcpy(face.recs, %sFontFace%02iRecs, face.glyphCount*sizeof(Rectangle));\n", nameLower, f);
+            rgs_text_append(&out, "    face.glyphs = (GlyphInfo *)RAYGUI_MALLOC(face.glyphCount*sizeof(GlyphInfo));\n");
+            rgs_text_append(&out, "    memcpy(face.glyphs, %sFontFace%02iGlyphs, face.glyphCount*sizeof(GlyphInfo));\n", nameLower, f);
+            rgs_text_append(&out, "    GuiSetFontFace(%i, face);\n\n", f);
+        }
+
+        const rgs_rectangle *rec = &font->white_rec;
+
+        if ((rec->x > 0) && (rec->y > 0) && (rec->width > 0) && (rec->height > 0))
+        {
+            rgs_text_append(&out, "    // Setup a white rectangle on the font to be used on shapes drawing,\n");
+            rgs_text_append(&out, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
+            rgs_text_append(&out, "    Rectangle fontWhiteRec = { %.0f, %.0f, %.0f, %.0f };\n", rec->x, rec->y, rec->width, rec->height);
+            rgs_text_append(&out, "    SetShapesTexture(font.texture, fontWhiteRec);\n\n");
+        }
+        else
+        {
+            rgs_text_append(&out, "    // TODO: Setup a white rectangle on the font to be used on shapes drawing,\n");
+            rgs_text_append(&out, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
+            rgs_text_append(&out, "    // NOTE: rGuiStyler provides a visual tool to define this rectangle on loaded font\n");
+            rgs_text_append(&out, "    //Rectangle fontWhiteRec = { 0, 0, 0, 0 };\n");
+            rgs_text_append(&out, "    //SetShapesTexture(font.texture, fontWhiteRec);\n\n");
+        }
+    }
+
+    if ((style->icon_count > 0) && (style->icons_data != NULL))
+    {
+        rgs_text_append(&out, "    // Custom icons loading, over current icons set\n");
+        rgs_text_append(&out, "    for (int i = 0; i < %s_STYLE_ICONS_COUNT; i++)\n    {\n", nameUpper);
+        rgs_text_append(&out, "        memcpy(GuiGetIcons() + %sIconsIds[i]*RAYGUI_ICON_DATA_ELEMENTS, %sIconsData + i*RAYGUI_ICON_DATA_ELEMENTS, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));\n    }\n\n", nameLower, nameLower);
+    }
+
+    rgs_text_append(&out, "    //-----------------------------------------------------------------\n\n");
+    rgs_text_append(&out, "    // TODO: Custom user style setup: Set specific properties here (if required)\n");
+    rgs_text_append(&out, "    // i.e. Controls specific BORDER_WIDTH, TEXT_PADDING, TEXT_ALIGNMENT\n");
+    rgs_text_append(&out, "}\n");
+
+    if (size != NULL) *size = out.length;
+    return out.text;
+}
+
+// Load style from PNG rGSf chunk, returns result code
+int rgs_load_from_png_memory(rgs_style *style, const unsigned char *png, int size)
+{
+    int offset = 0;
+    int length = 0;
+    int result = rgs_png_find_chunk(png, size, "rGSf", &offset, &length);
+
+    if (result == RGS_OK) result = rgs_load_from_memory(style, png + offset, length);
+    else if (style != NULL) memset(style, 0, sizeof(rgs_style));
+
+    return result;
+}
+
+// Save style as PNG rGSf chunk (previous one replaced)
+// NOTE: Style chunk is placed after IHDR chunk, same as rpng_chunk_write()
+unsigned char *rgs_save_to_png_memory(const rgs_style *style, int flags, const unsigned char *png, int size, int *outputSize)
+{
+    *outputSize = 0;
+
+    int offset = 0;
+    int length = 0;
+    int result = rgs_png_find_chunk(png, size, "rGSf", &offset, &length);
+
+    if ((result != RGS_OK) && (result != RGS_ERROR_PNG)) return NULL;
+    if ((result == RGS_ERROR_PNG) && (rgs_png_find_chunk(png, size, "IHDR", &offset, &length) != RGS_OK)) return NULL;
+
+    int styleSize = 0;
+    unsigned char *styleData = rgs_save_to_memory(style, flags, &styleSize);
+    if (styleData == NULL) return NULL;
+
+    // Previous chunk is skipped (if available), new one placed after IHDR (33 bytes: signature + IHDR)
+    int skipOffset = (result == RGS_OK)? (offset - 8) : size;
+    int skipSize = (result == RGS_OK)? (length + 12) : 0;
+    int outSize = size - skipSize + styleSize + 12;
+    unsigned char *output = (unsigned char *)RGS_MALLOC(outSize);
+    int outOffset = 0;
+
+    memcpy(output, png, 33);
+    outOffset += 33;
+
+    unsigned char *chunk = output + outOffset;
+    chunk[0] = (unsigned char)(styleSize >> 24);
+    chunk[1] = (unsigned char)(styleSize >> 16);
+    chunk[2] = (unsigned char)(styleSize >> 8);
+    chunk[3] = (unsigned char)styleSize;
+    memcpy(chunk + 4, "rGSf", 4);
+    memcpy(chunk + 8, styleData, styleSize);
+
+    unsigned int crc = compute_crc32(chunk + 4, 4 + styleSize);     // CRC32 computed over type + data
+    chunk[8 + styleSize] = (unsigned char)(crc >> 24);
+    chunk[8 + styleSize + 1] = (unsigned char)(crc >> 16);
+    chunk[8 + styleSize + 2] = (unsigned char)(crc >> 8);
+    chunk[8 + styleSize + 3] = (unsigned char)crc;
+    outOffset += (12 + styleSize);
+
+    // Copy remaining chunks, previous style chunk skipped
+    memcpy(output + outOffset, png + 33, skipOffset - 33);
+    outOffset += (skipOffset - 33);
+    memcpy(output + outOffset, png + skipOffset + skipSize, size - (skipOffset + skipSize));
+    outOffset += (size - (skipOffset + skipSize));
+
+    RGS_FREE(styleData);
+
+    *outputSize = outOffset;
+    return output;
+}
+
+// Encode font atlas alpha values into GPU blocks (DXT5: BC4 alpha, ETC2_EAC: EAC alpha)
+// NOTE: Alpha values provided one per pixel, size must be multiple of 4, color blocks are constant white
+unsigned char *rgs_font_atlas_encode(const unsigned char *alpha, int width, int height, int format)
+{
+    // Constant white color blocks: DXT1 (color0 = color1 = white) and ETC2 individual mode (base 15, modifier +2)
+    static const unsigned char whiteBlockDXT[8] = { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 };
+    static const unsigned char whiteBlockETC[8] = { 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+    if ((alpha == NULL) || (width <= 0) || (height <= 0) || ((width%4) != 0) || ((height%4) != 0)) return NULL;
+    if ((format != RGS_PIXELFORMAT_DXT5_RGBA) && (format != RGS_PIXELFORMAT_ETC2_EAC_RGBA)) return NULL;
+
+    int blocksX = width/4;
+    int blocksY = height/4;
+    unsigned char *blocks = (unsigned char *)RGS_MALLOC((size_t)blocksX*blocksY*16);
+    if (blocks == NULL) return NULL;
+
+    for (int by = 0; by < blocksY; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            unsigned char blockAlpha[16] = { 0 };    // Block alpha values, row-major order
+            unsigned char *block = blocks + ((size_t)by*blocksX + bx)*16;
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++) blockAlpha[y*4 + x] = alpha[(size_t)(by*4 + y)*width + bx*4 + x];
+            }
+
+            if (format == RGS_PIXELFORMAT_DXT5_RGBA)
+            {
+                rgs_encode_block_bc4(blockAlpha, block);
+                memcpy(block + 8, whiteBlockDXT, 8);
+            }
+            else
+            {
+                rgs_encode_block_eac(blockAlpha, block);
+                memcpy(block + 8, whiteBlockETC, 8);
+            }
+        }
+    }
+
+    return blocks;
+}
+
+// Decode font atlas GPU blocks alpha into GRAY+ALPHA data
+// NOTE: Only alpha blocks are decoded (BC4 on DXT5, EAC on ETC2_EAC), font atlas color is always white,
+// blocks data must contain (width + 3)/4*(height + 3)/4 blocks (16 bytes each)
+unsigned char *rgs_font_atlas_decode(const unsigned char *blocks, int width, int height, int format)
+{
+    if ((blocks == NULL) || (width <= 0) || (height <= 0)) return NULL;
+    if ((format != RGS_PIXELFORMAT_DXT5_RGBA) && (format != RGS_PIXELFORMAT_ETC2_EAC_RGBA)) return NULL;
+
+    unsigned char *data = (unsigned char *)RGS_CALLOC((size_t)width*height*2, 1);
+    if (data == NULL) return NULL;
+
+    int blocksX = (width + 3)/4;
+    int blocksY = (height + 3)/4;
+
+    for (int by = 0; by < blocksY; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            // NOTE: Every block is 16 bytes: alpha block (8 bytes) followed by color block (8 bytes)
+            const unsigned char *block = blocks + ((size_t)by*blocksX + bx)*16;
+            unsigned char alpha[16] = { 0 };    // Block alpha values, row-major order
+
+            if (format == RGS_PIXELFORMAT_DXT5_RGBA) rgs_decode_block_bc4(block, alpha);
+            else rgs_decode_block_eac(block, alpha);
+
+            for (int y = 0; (y < 4) && ((by*4 + y) < height); y++)
+            {
+                for (int x = 0; (x < 4) && ((bx*4 + x) < width); x++)
+                {
+                    size_t k = ((size_t)(by*4 + y)*width + bx*4 + x)*2;
+                    data[k] = 255;
+                    data[k + 1] = alpha[y*4 + x];
+                }
+            }
+        }
+    }
+
+    return data;
+}
+
+// Encode 4x4 alpha values block as BC4, both endpoints modes evaluated, lower error selected
+// NOTE: Block palette computed as decoded by rgs_decode_block_bc4()
+void rgs_encode_block_bc4(const unsigned char *alpha, unsigned char *block)
+{
+    int minAlpha = 255, maxAlpha = 0;           // Block range
+    int minInner = 255, maxInner = 0;           // Block range excluding 0 and 255, explicit on 6-values mode
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (alpha[i] < minAlpha) minAlpha = alpha[i];
+        if (alpha[i] > maxAlpha) maxAlpha = alpha[i];
+
+        if ((alpha[i] > 0) && (alpha[i] < 255))
+        {
+            if (alpha[i] < minInner) minInner = alpha[i];
+            if (alpha[i] > maxInner) maxInner = alpha[i];
+        }
+    }
+
+    if (minInner > maxInner) { minInner = 0; maxInner = 0; }
+
+    // Endpoints per mode: 8-values mode (a0 > a1) and 6-values mode (a0 <= a1)
+    int endpoints[2][2] = { { maxAlpha, minAlpha }, { minInner, maxInner } };
+    int bestError = -1;
+
+    for (int m = 0; m < 2; m++)
+    {
+        int a0 = endpoints[m][0];
+        int a1 = endpoints[m][1];
+
+        if ((m == 0) && (a0 <= a1)) continue;   // 8-values mode requires a0 > a1
+
+        unsigned char palette[8] = { (unsigned char)a0, (unsigned char)a1, 0 };
+
+        if (a0 > a1) for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*a0 + i*a1 + 3)/7);
+        else
+        {
+            for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*a0 + i*a1 + 2)/5);
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        unsigned long long bits = 0;
+        int error = 0;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int bestIndex = 0;
+            int bestDelta = 256;
+
+            for (int k = 0; k < 8; k++)
+            {
+                int delta = abs(alpha[i] - palette[k]);
+                if (delta < bestDelta) { bestDelta = delta; bestIndex = k; }
+            }
+
+            bits |= ((unsigned long long)bestIndex << (3*i));
+            error += bestDelta*bestDelta;
+        }
+
+        if ((bestError < 0) || (error < bestError))
+        {
+            bestError = error;
+            block[0] = (unsigned char)a0;
+            block[1] = (unsigned char)a1;
+            for (int i = 0; i < 6; i++) block[2 + i] = (unsigned char)(bits >> (8*i));
+        }
+    }
+}
+
+// Encode 4x4 alpha values block as EAC, searching modifiers table, multiplier and base around block range
+// NOTE: Uniform blocks are encoded exactly (table 13 contains a 0 modifier)
+void rgs_encode_block_eac(const unsigned char *alpha, unsigned char *block)
+{
+    int minAlpha = 255, maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (alpha[i] < minAlpha) minAlpha = alpha[i];
+        if (alpha[i] > maxAlpha) maxAlpha = alpha[i];
+    }
+
+    int bestError = -1;
+    int bestBase = minAlpha, bestMultiplier = 1, bestTable = 13;
+
+    if (minAlpha < maxAlpha)
+    {
+        for (int t = 0; (t < 16) && (bestError != 0); t++)
+        {
+            // NOTE: Modifiers table sorted: [3] is the lowest value and [7] the highest
+            int span = rgsEacModifiers[t][7] - rgsEacModifiers[t][3];
+            int multiplier = ((maxAlpha - minAlpha) + span/2)/span;
+
+            for (int mul = multiplier - 1; mul <= (multiplier + 1); mul++)
+            {
+                if ((mul < 1) || (mul > 15)) continue;
+
+                int base = minAlpha - rgsEacModifiers[t][3]*mul;
+
+                for (int b = base - 1; b <= (base + 1); b++)
+                {
+                    if ((b < 0) || (b > 255)) continue;
+
+                    int error = 0;
+
+                    for (int i = 0; (i < 16) && ((bestError < 0) || (error < bestError)); i++)
+                    {
+                        int bestDelta = 256;
+
+                        for (int k = 0; k < 8; k++)
+                        {
+                            int value = b + rgsEacModifiers[t][k]*mul;
+                            value = (value < 0)? 0 : ((value > 255)? 255 : value);
+                            if (abs(alpha[i] - value) < bestDelta) bestDelta = abs(alpha[i] - value);
+                        }
+
+                        error += bestDelta*bestDelta;
+                    }
+
+                    if ((bestError < 0) || (error < bestError))
+                    {
+                        bestError = error;
+                        bestBase = b;
+                        bestMultiplier = mul;
+                        bestTable = t;
+                    }
+                }
+            }
+        }
+    }
+
+    // Select pixels modifiers for best parameters, 3-bit indices in column-major order
+    unsigned long long bits = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int a = alpha[(i%4)*4 + i/4];
+        int bestIndex = 0;
+        int bestDelta = 256;
+
+        for (int k = 0; k < 8; k++)
+        {
+            int value = bestBase + rgsEacModifiers[bestTable][k]*bestMultiplier;
+            value = (value < 0)? 0 : ((value > 255)? 255 : value);
+            if (abs(a - value) < bestDelta) { bestDelta = abs(a - value); bestIndex = k; }
+        }
+
+        bits = (bits << 3) | bestIndex;
+    }
+
+    block[0] = (unsigned char)bestBase;
+    block[1] = (unsigned char)((bestMultiplier << 4) | bestTable);
+    for (int i = 0; i < 6; i++) block[2 + i] = (unsigned char)(bits >> (40 - 8*i));
+}
+
+// Decode BC4 block into 4x4 alpha values (row-major order)
+// NOTE: Two endpoints and 3-bit indices (little-endian, row-major)
+void rgs_decode_block_bc4(const unsigned char *block, unsigned char *alpha)
+{
+    unsigned char palette[8] = { block[0], block[1], 0 };
+    unsigned long long bits = 0;
+
+    if (block[0] > block[1]) for (int i = 1; i < 7; i++) palette[i + 1] = (unsigned char)(((7 - i)*block[0] + i*block[1] + 3)/7);
+    else
+    {
+        for (int i = 1; i < 5; i++) palette[i + 1] = (unsigned char)(((5 - i)*block[0] + i*block[1] + 2)/5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    for (int i = 0; i < 6; i++) bits |= ((unsigned long long)block[2 + i] << (8*i));
+    for (int i = 0; i < 16; i++) alpha[i] = palette[(bits >> (3*i)) & 0x07];
+}
+
+// Decode EAC block into 4x4 alpha values (row-major order)
+// NOTE: Base, multiplier and modifiers table, 3-bit indices (big-endian, column-major)
+void rgs_decode_block_eac(const unsigned char *block, unsigned char *alpha)
+{
+    int base = block[0];
+    int multiplier = block[1] >> 4;
+    int table = block[1] & 0x0f;
+    unsigned long long bits = 0;
+
+    for (int i = 0; i < 6; i++) bits = (bits << 8) | block[2 + i];
+    for (int i = 0; i < 16; i++)
+    {
+        int value = base + rgsEacModifiers[table][(bits >> (45 - 3*i)) & 0x07]*multiplier;
+        alpha[(i%4)*4 + i/4] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+    }
+}
+
+// Load style index from memory, returns result code
+// NOTE: Index is reset before loading, on error index is left empty
+int rgs_index_load_from_memory(rgs_index *index, const unsigned char *data, int size)
+{
+    rgs_index_unload(index);
+
+    if ((data == NULL) || (size < 16)) return RGS_ERROR_INVALID_DATA;
+
+    rgs_reader reader = { data, size, 0, false };
+    const unsigned char *signature = rgs_read_bytes(&reader, 4);
+    short version = rgs_read_short(&reader);
+    rgs_read_short(&reader);    // Reserved
+    int entryCount = rgs_read_int(&reader);
+    int postingCount = rgs_read_int(&reader);
+
+    if ((memcmp(signature, "rGSI", 4) != 0) || (version != RGS_INDEX_VERSION)) return RGS_ERROR_SIGNATURE;
+
+    // NOTE: Counts are checked against available data before allocating
+    if ((entryCount < 0) || (postingCount < 0) ||
+        (entryCount > ((size - reader.offset)/RGS_INDEX_ENTRY_MIN_SIZE)) ||
+        (postingCount > ((size - reader.offset)/12))) return RGS_ERROR_INDEX;
+
+    index->entries = (rgs_index_entry *)RGS_CALLOC((entryCount > 0)? entryCount : 1, sizeof(rgs_index_entry));
+    index->entry_count = entryCount;
+
+    int result = RGS_OK;
+
+    for (int i = 0; (i < entryCount) && (result == RGS_OK); i++)
+    {
+        rgs_index_entry *entry = &index->entries[i];
+
+        int nameLength = rgs_read_short(&reader);
+        const unsigned char *name = rgs_read_bytes(&reader, nameLength);
+        const unsigned char *modTime = rgs_read_bytes(&reader, sizeof(long long));
+
+        if ((name == NULL) || (modTime == NULL)) { result = RGS_ERROR_INDEX; break; }
+
+        entry->file_name = (char *)RGS_MALLOC(nameLength + 1);
+        memcpy(entry->file_name, name, nameLength);
+        entry->file_name[nameLength] = '\0';
+        memcpy(&entry->mod_time, modTime, sizeof(long long));
+
+        entry->file_size = rgs_read_int(&reader);
+        entry->file_hash = (unsigned int)rgs_read_int(&reader);
+        entry->result = rgs_read_int(&reader);
+        entry->font_hash = (unsigned int)rgs_read_int(&reader);
+        entry->font_base_size = rgs_read_int(&reader);
+        entry->glyph_count = rgs_read_int(&reader);
+        entry->codepoint_min = rgs_read_int(&reader);
+        entry->codepoint_max = rgs_read_int(&reader);
+        entry->charset_mask = (unsigned int)rgs_read_int(&reader);
+        entry->icon_count = rgs_read_int(&reader);
+
+        int propertyCount = rgs_read_int(&reader);
+        if ((propertyCount < 0) || (propertyCount > RGS_MAX_PROPERTIES)) { result = RGS_ERROR_INDEX; break; }
+
+        const unsigned char *properties = rgs_read_bytes(&reader, propertyCount*8);
+        if (reader.error || (properties == NULL)) { result = RGS_ERROR_INDEX; break; }
+
+        if (propertyCount > 0)
+        {
+            // NOTE: rgs_property matches saved layout (2 shorts + 1 int)
+            entry->properties = (rgs_property *)RGS_MALLOC(propertyCount*sizeof(rgs_property));
+            memcpy(entry->properties, properties, propertyCount*8);
+            entry->property_count = propertyCount;
+        }
+    }
+
+    if (result == RGS_OK)
+    {
+        const unsigned char *postings = rgs_read_bytes(&reader, postingCount*12);
+
+        if (postings == NULL) result = RGS_ERROR_INDEX;
+        else
+        {
+            index->postings = (rgs_index_posting *)RGS_MALLOC(((postingCount > 0)? postingCount : 1)*sizeof(rgs_index_posting));
+            index->posting_count = postingCount;
+
+            for (int i = 0; i < postingCount; i++)
+            {
+                memcpy(&index->postings[i].key, postings + i*12, 8);
+                memcpy(&index->postings[i].entry, postings + i*12 + 8, 4);
+
+                // Postings must reference valid entries and keep sorting, queries rely on it
+                if ((index->postings[i].entry < 0) || (index->postings[i].entry >= entryCount) ||
+                    ((i > 0) && (rgs_index_compare_postings(&index->postings[i - 1], &index->postings[i]) > 0))) { result = RGS_ERROR_INDEX; break; }
+            }
+        }
+    }
+
+    if (result != RGS_OK) rgs_index_unload(index);
+
+    return result;
+}
+
+// Save style index to memory
+// NOTE: Data layout: [header][entries][postings], postings are saved sorted to be queried directly
+unsigned char *rgs_index_save_to_memory(const rgs_index *index, int *size)
+{
+    int dataSize = 16 + index->posting_count*12;
+    for (int i = 0; i < index->entry_count; i++) dataSize += RGS_INDEX_ENTRY_MIN_SIZE + (int)strlen(index->entries[i].file_name) + index->entries[i].property_count*8;
+
+    unsigned char *data = (unsigned char *)RGS_CALLOC(dataSize, 1);
+    int offset = 0;
+
+    short version = RGS_INDEX_VERSION;
+    short reserved = 0;
+
+    memcpy(data + offset, "rGSI", 4); offset += 4;
+    memcpy(data + offset, &version, sizeof(short)); offset += sizeof(short);
+    memcpy(data + offset, &reserved, sizeof(short)); offset += sizeof(short);
+    memcpy(data + offset, &index->entry_count, sizeof(int)); offset += sizeof(int);
+    memcpy(data + offset, &index->posting_count, sizeof(int)); offset += sizeof(int);
+
+    for (int i = 0; i < index->entry_count; i++)
+    {
+        const rgs_index_entry *entry = &index->entries[i];
+        short nameLength = (short)strlen(entry->file_name);
+        int values[11] = {
+            entry->file_size, (int)entry->file_hash, entry->result, (int)entry->font_hash, entry->font_base_size, entry->glyph_count,
+            entry->codepoint_min, entry->codepoint_max, (int)entry->charset_mask, entry->icon_count, entry->property_count
+        };
+
+        memcpy(data + offset, &nameLength, sizeof(short)); offset += sizeof(short);
+        memcpy(data + offset, entry->file_name, nameLength); offset += nameLength;
+        memcpy(data + offset, &entry->mod_time, sizeof(long long)); offset += sizeof(long long);
+        memcpy(data + offset, values, sizeof(values)); offset += sizeof(values);
+
+        if (entry->property_count > 0)
+        {
+            memcpy(data + offset, entry->properties, entry->property_count*8);
+            offset += entry->property_count*8;
+        }
+    }
+
+    for (int i = 0; i < index->posting_count; i++)
+    {
+        memcpy(data + offset, &index->postings[i].key, 8); offset += 8;
+        memcpy(data + offset, &index->postings[i].entry, 4); offset += 4;
+    }
+
+    *size = offset;
+    return data;
+}
+
+// Query style index, returns matching entries count or result code
+// NOTE: Query is a list of terms separated by spaces or commas, entries must match all terms:
+//   CONTROL.PROPERTY<op>value  : Style property (names or ids), DEFAULT properties propagation considered
+//   color=#rrggbb[aa]          : Any color property with that value (alpha ignored if not provided)
+//   font=<hash>                : Font hash (hexadecimal), same embedded font
+//   size<op>value              : Font base size
+//   glyphs<op>value            : Font glyphs count, 0 if no font
+//   charset=<block>            : Font glyphs available on Unicode block (basic_latin, cyrillic, cjk...)
+//   icons<op>value             : Custom icons count
+// Supported operators: = < > <= >=, values could be decimal, hexadecimal (0x) or color (#)
+// Matching entries ids written to results (up to maxResults), an empty query matches all loaded styles
+int rgs_index_query(const rgs_index *index, const char *query, int *results, int maxResults)
+{
+    rgs_index_term terms[RGS_INDEX_MAX_QUERY_TERMS] = { 0 };
+    int termCount = 0;
+
+    // Split query terms
+    for (int i = 0; (query != NULL) && (query[i] != '\0');)
+    {
+        if ((query[i] == ' ') || (query[i] == ',') || (query[i] == '\t')) { i++; continue; }
+
+        char text[128] = { 0 };
+        int length = 0;
+
+        for (; (query[i] != '\0') && (query[i] != ' ') && (query[i] != ',') && (query[i] != '\t'); i++)
+        {
+            if (length < 127) text[length++] = query[i];
+            else return RGS_ERROR_QUERY;
+        }
+
+        if (termCount >= RGS_INDEX_MAX_QUERY_TERMS) return RGS_ERROR_QUERY;
+
+        int result = rgs_index_parse_term(text, &terms[termCount]);
+        if (result != RGS_OK) return result;
+        termCount++;
+    }
+
+    // Every term matches entries once, entries matching all terms are returned
+    int *entryTerm = (int *)RGS_MALLOC(((index->entry_count > 0)? index->entry_count : 1)*sizeof(int));
+    int *entryMatches = (int *)RGS_CALLOC((index->entry_count > 0)? index->entry_count : 1, sizeof(int));
+    for (int i = 0; i < index->entry_count; i++) entryTerm[i] = -1;
+
+    for (int t = 0; t < termCount; t++) rgs_index_match_term(index, &terms[t], t, entryTerm, entryMatches);
+
+    int count = 0;
+
+    for (int i = 0; i < index->entry_count; i++)
+    {
+        if ((index->entries[i].result == RGS_OK) && (entryMatches[i] == termCount))
+        {
+            if ((results != NULL) && (count < maxResults)) results[count] = i;
+            count++;
+        }
+    }
+
+    RGS_FREE(entryTerm);
+    RGS_FREE(entryMatches);
+
+    return count;
+}
+
+// Unload style index allocated data
+void rgs_index_unload(rgs_index *index)
+{
+    if (index == NULL) return;
+
+    for (int i = 0; i < index->entry_count; i++) rgs_index_entry_unload(&index->entries[i]);
+    RGS_FREE(index->entries);
+    RGS_FREE(index->postings);
+
+    memset(index, 0, sizeof(rgs_index));
+}
+
+// Find near-duplicate styles clusters (2 or more entries)
+// NOTE: Styles are compared by resolved properties (raygui default style + DEFAULT propagation), colors in CIELAB space,
+// clusters link styles closer than threshold (single linkage), distance computations pruned with pivot styles distances
+rgs_index_cluster *rgs_index_find_clusters(const rgs_index *index, float threshold, int *count)
+{
+    int featuresCount = 0;
+    int *entries = (int *)RGS_MALLOC(((index->entry_count > 0)? index->entry_count : 1)*sizeof(int));
+    unsigned char *features = rgs_index_load_features(index, entries, &featuresCount);
+    unsigned int limit = (unsigned int)(threshold/RGS_STYLE_DISTANCE_MAX*RGS_FEATURES_USED*255.0f);
+
+    // Pivots selected farthest-first, distances to pivots are lower bounds for styles distances (triangle inequality)
+    unsigned int *pivotDistances = (unsigned int *)RGS_CALLOC(((featuresCount > 0)? featuresCount : 1)*RGS_CLUSTER_PIVOTS, sizeof(unsigned int));
+    unsigned int *minDistances = (unsigned int *)RGS_MALLOC(((featuresCount > 0)? featuresCount : 1)*sizeof(unsigned int));
+    int pivot = 0;
+
+    for (int i = 0; i < featuresCount; i++) minDistances[i] = 0xffffffff;
+
+    for (int p = 0; (p < RGS_CLUSTER_PIVOTS) && (featuresCount > 0); p++)
+    {
+        int farthest = 0;
+
+        for (int i = 0; i < featuresCount; i++)
+        {
+            unsigned int distance = rgs_features_distance(features + i*RGS_FEATURES_SIZE, features + pivot*RGS_FEATURES_SIZE, 0xffffffff);
+
+            pivotDistances[i*RGS_CLUSTER_PIVOTS + p] = distance;
+            if (distance < minDistances[i]) minDistances[i] = distance;
+            if (minDistances[i] > minDistances[farthest]) farthest = i;
+        }
+
+        pivot = farthest;
+    }
+
+    // Styles grouped on grid cells by first two pivots distances (cell size: limit + 1),
+    // styles closer than limit can only be on the same cell or adjacent cells
+    rgs_cluster_item *items = (rgs_cluster_item *)RGS_MALLOC(((featuresCount > 0)? featuresCount : 1)*sizeof(rgs_cluster_item));
+    int *parent = (int *)RGS_MALLOC(((featuresCount > 0)? featuresCount : 1)*sizeof(int));
+
+    for (int i = 0; i < featuresCount; i++)
+    {
+        unsigned long long cellX = pivotDistances[i*RGS_CLUSTER_PIVOTS]/((unsigned long long)limit + 1);
+        unsigned long long cellY = pivotDistances[i*RGS_CLUSTER_PIVOTS + 1]/((unsigned long long)limit + 1);
+
+        items[i].cell = (cellX << 32) | cellY;
+        items[i].id = i;
+        memcpy(items[i].distances, pivotDistances + i*RGS_CLUSTER_PIVOTS, sizeof(items[i].distances));
+        parent[i] = i;
+    }
+
+    qsort(items, featuresCount, sizeof(rgs_cluster_item), rgs_compare_cluster_items);
+
+    for (int a = 0; a < featuresCount; a++)
+    {
+        unsigned long long cell = items[a].cell;
+
+        // Same cell following styles and forward adjacent cells: (x, y + 1), (x + 1, y - 1), (x + 1, y), (x + 1, y + 1)
+        for (int b = a + 1; (b < featuresCount) && (items[b].cell == cell); b++) rgs_cluster_link(features, &items[a], &items[b], parent, limit);
+
+        for (int n = 0; n < 4; n++)
+        {
+            if ((n == 1) && ((cell & 0xffffffff) == 0)) continue;
+
+            unsigned long long neighbor = (n == 0)? (cell + 1) : (cell + (1ull << 32) + (unsigned long long)(n - 2));
+
+            // Find neighbor cell first style (binary search)
+            int first = a + 1;
+            int last = featuresCount;
+
+            while (first < last)
+            {
+                int middle = first + (last - first)/2;
+
+                if (items[middle].cell < neighbor) first = middle + 1;
+                else last = middle;
+            }
+
+            for (int b = first; (b < featuresCount) && (items[b].cell == neighbor); b++) rgs_cluster_link(features, &items[a], &items[b], parent, limit);
+        }
+    }
+
+    RGS_FREE(items);
+
+    // Collect clusters with 2 or more styles
+    int *clusterIds = (int *)RGS_MALLOC(((featuresCount > 0)? featuresCount : 1)*sizeof(int));
+    int *clusterSizes = (int *)RGS_CALLOC((featuresCount > 0)? featuresCount : 1, sizeof(int));
+    unsigned long long *order = (unsigned long long *)RGS_MALLOC(((featuresCount > 0)? featuresCount : 1)*sizeof(unsigned long long));
+    int clusterCount = 0;
+
+    for (int i = 0; i < featuresCount; i++) clusterSizes[rgs_cluster_find(parent, i)]++;
+    for (int i = 0; i < featuresCount; i++)
+    {
+        if ((parent[i] == i) && (clusterSizes[i] > 1)) clusterIds[i] = clusterCount++;
+        else clusterIds[i] = -1;
+    }
+
+    rgs_index_cluster *clusters = NULL;
+
+    if (clusterCount > 0)
+    {
+        clusters = (rgs_index_cluster *)RGS_CALLOC(clusterCount, sizeof(rgs_index_cluster));
+        unsigned int *sums = (unsigned int *)RGS_MALLOC(RGS_FEATURES_SIZE*sizeof(unsigned int));
+        unsigned char mean[RGS_FEATURES_SIZE] = { 0 };
+
+        for (int i = 0; i < featuresCount; i++)
+        {
+            int root = rgs_cluster_find(parent, i);
+            int id = clusterIds[root];
+            if (id < 0) continue;
+
+            if (clusters[id].entries == NULL) clusters[id].entries = (int *)RGS_MALLOC(clusterSizes[root]*sizeof(int));
+            clusters[id].entries[clusters[id].entry_count++] = i;   // NOTE: Features id, converted to entry below
+        }
+
+        for (int c = 0; c < clusterCount; c++)
+        {
+            rgs_index_cluster *cluster = &clusters[c];
+
+            // Representative: closest style to cluster mean style
+            memset(sums, 0, RGS_FEATURES_SIZE*sizeof(unsigned int));
+            for (int m = 0; m < cluster->entry_count; m++)
+            {
+                const unsigned char *feature = features + cluster->entries[m]*RGS_FEATURES_SIZE;
+                for (int k = 0; k < RGS_FEATURES_SIZE; k++) sums[k] += feature[k];
+            }
+            for (int k = 0; k < RGS_FEATURES_SIZE; k++) mean[k] = (unsigned char)((sums[k] + cluster->entry_count/2)/cluster->entry_count);
+
+            int representative = cluster->entries[0];
+            unsigned int minDistance = 0xffffffff;
+
+            for (int m = 0; m < cluster->entry_count; m++)
+            {
+                unsigned int distance = rgs_features_distance(features + cluster->entries[m]*RGS_FEATURES_SIZE, mean, minDistance);
+                if (distance < minDistance) { minDistance = distance; representative = cluster->entries[m]; }
+            }
+
+            // Cluster entries sorted by distance to representative
+            for (int m = 0; m < cluster->entry_count; m++)
+            {
+                unsigned int distance = rgs_features_distance(features + cluster->entries[m]*RGS_FEATURES_SIZE, features + representative*RGS_FEATURES_SIZE, 0xffffffff);
+                order[m] = ((unsigned long long)distance << 32) | (unsigned int)cluster->entries[m];
+            }
+
+            qsort(order, cluster->entry_count, sizeof(unsigned long long), rgs_compare_keys);
+
+            for (int m = 0; m < cluster->entry_count; m++) cluster->entries[m] = entries[order[m] & 0xffffffff];
+
+            cluster->representative = entries[representative];
+            cluster->distance_max = (float)(order[cluster->entry_count - 1] >> 32)*RGS_STYLE_DISTANCE_MAX/(RGS_FEATURES_USED*255.0f);
+        }
+
+        // Clusters sorted by size, biggest first
+        qsort(clusters, clusterCount, sizeof(rgs_index_cluster), rgs_compare_clusters);
+
+        RGS_FREE(sums);
+    }
+
+    RGS_FREE(clusterIds);
+    RGS_FREE(clusterSizes);
+    RGS_FREE(parent);
+    RGS_FREE(order);
+    RGS_FREE(minDistances);
+    RGS_FREE(pivotDistances);
+    RGS_FREE(features);
+    RGS_FREE(entries);
+
+    *count = clusterCount;
+    return clusters;
+}
+
+// Unload near-duplicate styles clusters
+void rgs_index_unload_clusters(rgs_index_cluster *clusters, int count)
+{
+    if (clusters == NULL) return;
+
+    for (int c = 0; c < count; c++) RGS_FREE(clusters[c].entries);
+    RGS_FREE(clusters);
+}
+
+// Find nearest styles, returns results count
+// NOTE: Results sorted by distance, same style distance used by rgs_index_find_clusters()
+int rgs_index_find_nearest(const rgs_index *index, const rgs_style *style, int *results, float *distances, int maxResults)
+{
+    if (maxResults <= 0) return 0;
+
+    int featuresCount = 0;
+    int *entries = (int *)RGS_MALLOC(((index->entry_count > 0)? index->entry_count : 1)*sizeof(int));
+    unsigned char *features = rgs_index_load_features(index, entries, &featuresCount);
+
+    float linearTable[256] = { 0 };
+    rgs_init_linear_table(linearTable);
+
+    unsigned int *values = (unsigned int *)RGS_MALLOC(RGS_MAX_PROPERTIES*sizeof(unsigned int));
+    unsigned char target[RGS_FEATURES_SIZE] = { 0 };
+    rgs_resolve_properties(style->properties, style->property_count, values);
+    rgs_compute_features(values, linearTable, target);
+
+    // Nearest styles kept sorted (insertion), current worst distance used as early exit limit
+    unsigned int *nearest = (unsigned int *)RGS_MALLOC(maxResults*sizeof(unsigned int));
+    int count = 0;
+
+    for (int i = 0; i < featuresCount; i++)
+    {
+        unsigned int limit = (count < maxResults)? 0xffffffff : nearest[count - 1];
+        unsigned int distance = rgs_features_distance(features + i*RGS_FEATURES_SIZE, target, limit);
+
+        if ((count < maxResults) || (distance < limit))
+        {
+            int position = (count < maxResults)? count++ : (count - 1);
+
+            while ((position > 0) && (nearest[position - 1] > distance))
+            {
+                nearest[position] = nearest[position - 1];
+                results[position] = results[position - 1];
+                position--;
+            }
+
+            nearest[position] = distance;
+            results[position] = entries[i];
+        }
+    }
+
+    if (distances != NULL) for (int i = 0; i < count; i++) distances[i] = (float)nearest[i]*RGS_STYLE_DISTANCE_MAX/(RGS_FEATURES_USED*255.0f);
+
+    RGS_FREE(nearest);
+    RGS_FREE(values);
+    RGS_FREE(features);
+    RGS_FREE(entries);
+
+    return count;
+}
+
+// Init style layers stack, no layers and raygui default style resolved
+void rgs_layers_init(rgs_layers *layers)
+{
+    if (layers == NULL) return;
+
+    memset(layers, 0, sizeof(rgs_layers));
+    rgs_resolve_properties(NULL, 0, layers->default_values);
+    memcpy(layers->resolved, layers->default_values, RGS_MAX_PROPERTIES*sizeof(unsigned int));
+}
+
+// Push style properties as top layer, returns layer index or result code
+// NOTE: Only style properties are considered, font and icons data is not part of layers
+int rgs_layers_push(rgs_layers *layers, const rgs_style *style)
+{
+    if ((layers == NULL) || (layers->layer_count >= RGS_MAX_LAYERS)) return RGS_ERROR_LAYER;
+
+    int layer = layers->layer_count;
+    layers->layer_count++;
+
+    memset(layers->defined[layer], 0, RGS_MAX_PROPERTIES/8);
+
+    int result = rgs_layers_set_layer(layers, layer, style);
+    if (result != RGS_OK) { layers->layer_count--; return result; }
+
+    return layer;
+}
+
+// Pop top layer, its properties are resolved from lower layers
+void rgs_layers_pop(rgs_layers *layers)
+{
+    if ((layers == NULL) || (layers->layer_count == 0)) return;
+
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+    int layer = layers->layer_count - 1;
+
+    for (int id = 0; id < RGS_MAX_PROPERTIES; id++)
+    {
+        if (layers->defined[layer][id/8] & (1 << (id%8))) rgs_layers_mark(layers, id/propsCount, id%propsCount);
+    }
+
+    memset(layers->defined[layer], 0, RGS_MAX_PROPERTIES/8);
+    layers->layer_count--;
+}
+
+// Replace layer properties with style properties, returns result code
+// NOTE: Previous and new layer properties are pending to resolve, other properties are kept
+int rgs_layers_set_layer(rgs_layers *layers, int layer, const rgs_style *style)
+{
+    if ((layers == NULL) || (layer < 0) || (layer >= layers->layer_count)) return RGS_ERROR_LAYER;
+    if ((style != NULL) && ((style->property_count < 0) || (style->property_count > RGS_MAX_PROPERTIES))) return RGS_ERROR_PROPERTIES;
+
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+
+    for (int id = 0; id < RGS_MAX_PROPERTIES; id++)
+    {
+        if (layers->defined[layer][id/8] & (1 << (id%8))) rgs_layers_mark(layers, id/propsCount, id%propsCount);
+    }
+
+    memset(layers->defined[layer], 0, RGS_MAX_PROPERTIES/8);
+
+    for (int i = 0; (style != NULL) && (i < style->property_count); i++)
+    {
+        rgs_layers_set_property(layers, layer, style->properties[i].control_id, style->properties[i].property_id, style->properties[i].value);
+    }
+
+    return RGS_OK;
+}
+
+// Set layer property value, returns result code
+int rgs_layers_set_property(rgs_layers *layers, int layer, int control, int property, unsigned int value)
+{
+    if ((layers == NULL) || (layer < 0) || (layer >= layers->layer_count)) return RGS_ERROR_LAYER;
+    if ((control < 0) || (control >= RGS_MAX_CONTROLS) || (property < 0) || (property >= (RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))) return RGS_ERROR_PROPERTIES;
+
+    int id = control*(RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED) + property;
+
+    // Same value already defined by layer, nothing to resolve
+    if ((layers->defined[layer][id/8] & (1 << (id%8))) && (layers->values[layer][id] == value)) return RGS_OK;
+
+    layers->values[layer][id] = value;
+    layers->defined[layer][id/8] |= (1 << (id%8));
+    rgs_layers_mark(layers, control, property);
+
+    return RGS_OK;
+}
+
+// Remove layer property, lower layers value used
+void rgs_layers_remove_property(rgs_layers *layers, int layer, int control, int property)
+{
+    if ((layers == NULL) || (layer < 0) || (layer >= layers->layer_count)) return;
+    if ((control < 0) || (control >= RGS_MAX_CONTROLS) || (property < 0) || (property >= (RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))) return;
+
+    int id = control*(RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED) + property;
+
+    if (layers->defined[layer][id/8] & (1 << (id%8)))
+    {
+        layers->defined[layer][id/8] &= ~(1 << (id%8));
+        rgs_layers_mark(layers, control, property);
+    }
+}
+
+// Resolve pending properties, returns changed values count
+// NOTE: Changed properties (resolved values, no DEFAULT propagation required) are filled if provided,
+// up to maxChanged properties, RGS_MAX_PROPERTIES is always enough
+int rgs_layers_resolve(rgs_layers *layers, rgs_property *changed, int maxChanged)
+{
+    if (layers == NULL) return 0;
+
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+    int changedCount = 0;
+
+    for (int i = 0; i < RGS_MAX_PROPERTIES/8; i++)
+    {
+        if (layers->dirty[i] == 0) continue;    // No pending properties, 8 properties skipped
+
+        for (int b = 0; b < 8; b++)
+        {
+            if ((layers->dirty[i] & (1 << b)) == 0) continue;
+
+            int id = i*8 + b;
+            unsigned int value = rgs_layers_value(layers, layers->layer_count, id);
+
+            if (value != layers->resolved[id])
+            {
+                layers->resolved[id] = value;
+
+                if ((changed != NULL) && (changedCount < maxChanged))
+                {
+                    changed[changedCount].control_id = (unsigned short)(id/propsCount);
+                    changed[changedCount].property_id = (unsigned short)(id%propsCount);
+                    changed[changedCount].value = value;
+                }
+
+                changedCount++;
+            }
+        }
+
+        layers->dirty[i] = 0;
+    }
+
+    return changedCount;
+}
+
+// Get style values delta over layers below provided one, returns properties count or result code
+// NOTE: Delta properties applied over layers below (DEFAULT properties first, as loading) give the provided
+// style values, delta style is reset (no font or icons data) and it can be saved as a layer style file
+int rgs_layers_get_delta(const rgs_layers *layers, int layer, const unsigned int *values, rgs_style *delta)
+{
+    if ((layers == NULL) || (values == NULL) || (delta == NULL)) return RGS_ERROR_INVALID_DATA;
+    if ((layer < 0) || (layer > layers->layer_count)) return RGS_ERROR_LAYER;
+
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+
+    memset(delta, 0, sizeof(rgs_style));
+    delta->version = RGS_STYLE_VERSION;
+
+    for (int control = 0; control < RGS_MAX_CONTROLS; control++)
+    {
+        for (int property = 0; property < propsCount; property++)
+        {
+            int id = control*propsCount + property;
+            unsigned int value = rgs_layers_value(layers, layer, id);
+
+            // Delta DEFAULT base properties are propagated, they define controls value to compare with
+            if ((control > 0) && (property < RGS_MAX_PROPS_BASE) && (values[property] != rgs_layers_value(layers, layer, property))) value = values[property];
+
+            if (values[id] != value)
+            {
+                delta->properties[delta->property_count].control_id = (unsigned short)control;
+                delta->properties[delta->property_count].property_id = (unsigned short)property;
+                delta->properties[delta->property_count].value = values[id];
+                delta->property_count++;
+            }
+        }
+    }
+
+    return delta->property_count;
+}
+
+// Init style parameters with default values (light style)
+void rgs_params_default(rgs_params *params)
+{
+    if (params == NULL) return;
+
+    params->hue = 200.0f;
+    params->saturation = 0.6f;
+    params->base_saturation = 0.15f;
+    params->base_value = 0.92f;
+    params->state_shift = 0.06f;
+    params->harmony = RGS_HARMONY_MONOCHROME;
+    params->harmony_angle = 180.0f;
+    params->disabled_saturation = 0.3f;
+    params->text_contrast = 4.5f;
+    params->border_contrast = 3.0f;
+    params->disabled_contrast = 1.6f;
+    params->background_shift = 0.04f;
+    params->border_width = 1;
+    params->text_size = 10;
+    params->text_spacing = 1;
+    params->text_line_spacing = 15;
+}
+
+// Get style parameter info (RGS_PARAMS_COUNT parameters), NULL if out of range
+const rgs_param_info *rgs_params_get_info(int index)
+{
+    if ((index < 0) || (index >= RGS_PARAMS_COUNT)) return NULL;
+
+    return &rgsParamsInfo[index];
+}
+
+// Get style parameter value
+float rgs_params_get(const rgs_params *params, int index)
+{
+    if ((params == NULL) || (index < 0) || (index >= RGS_PARAMS_COUNT)) return 0.0f;
+
+    const unsigned char *field = (const unsigned char *)params + rgsParamsOffset[index];
+
+    if (rgsParamsInfo[index].type == RGS_PARAM_FLOAT) return *(const float *)field;
+    else return (float)(*(const int *)field);
+}
+
+// Set style parameter value (clamped to parameter range)
+void rgs_params_set(rgs_params *params, int index, float value)
+{
+    if ((params == NULL) || (index < 0) || (index >= RGS_PARAMS_COUNT)) return;
+
+    unsigned char *field = (unsigned char *)params + rgsParamsOffset[index];
+
+    if (value < rgsParamsInfo[index].min) value = rgsParamsInfo[index].min;
+    else if (value > rgsParamsInfo[index].max) value = rgsParamsInfo[index].max;
+
+    if (rgsParamsInfo[index].type == RGS_PARAM_FLOAT) *(float *)field = value;
+    else *(int *)field = (int)(value + 0.5f);
+}
+
+// Compile style parameters into style properties and/or flat style values, returns properties count
+// NOTE: Only DEFAULT properties are generated (base properties propagated to all controls), style is reset
+// (no font or icons data) and values are resolved over raygui default style, both are optional
+int rgs_params_compile(const rgs_params *params, rgs_style *style, unsigned int *values)
+{
+    if (params == NULL) return RGS_ERROR_INVALID_DATA;
+
+    // Parameters clamped to valid ranges, out of range values from text or user code are accepted
+    rgs_params p = *params;
+    for (int i = 0; i < RGS_PARAMS_COUNT; i++) rgs_params_set(&p, i, rgs_params_get(params, i));
+
+    float linearTable[256] = { 0 };
+    rgs_init_linear_table(linearTable);
+
+    // States hue by harmony rule, disabled state uses base hue
+    float hues[4] = { p.hue, p.hue, p.hue, p.hue };
+    if ((p.harmony == RGS_HARMONY_COMPLEMENTARY_FOCUSED) || (p.harmony == RGS_HARMONY_SPLIT)) hues[1] = p.hue + p.harmony_angle;
+    if (p.harmony == RGS_HARMONY_COMPLEMENTARY_PRESSED) hues[2] = p.hue + p.harmony_angle;
+    else if (p.harmony == RGS_HARMONY_SPLIT) hues[2] = p.hue - p.harmony_angle;
+
+    // States base value shifted towards accent colors: darker on light styles, lighter on dark styles
+    float shift = (p.base_value >= 0.5f)? -p.state_shift : p.state_shift;
+    float baseValues[4] = { p.base_value, p.base_value + shift, p.base_value + 2*shift, p.base_value };
+
+    rgs_property properties[24] = { 0 };
+    int count = 0;
+
+    for (int state = 0; state < 4; state++)
+    {
+        float saturationScale = (state == 3)? p.disabled_saturation : 1.0f;
+        float hue = fmodf(hues[state] + 360.0f, 360.0f);
+        float baseValue = (baseValues[state] < 0.0f)? 0.0f : (baseValues[state] > 1.0f)? 1.0f : baseValues[state];
+
+        unsigned int baseColor = rgs_color_from_hsv(hue, p.base_saturation*saturationScale, baseValue);
+        unsigned int borderColor = rgs_params_contrast_color(hue, p.saturation*saturationScale, baseColor, (state == 3)? p.disabled_contrast : p.border_contrast, linearTable);
+        unsigned int textColor = rgs_params_contrast_color(hue, p.saturation*saturationScale, baseColor, (state == 3)? p.disabled_contrast : p.text_contrast, linearTable);
+
+        properties[count++] = (rgs_property){ 0, (unsigned short)(state*3), borderColor };
+        properties[count++] = (rgs_property){ 0, (unsigned short)(state*3 + 1), baseColor };
+        properties[count++] = (rgs_property){ 0, (unsigned short)(state*3 + 2), textColor };
+    }
+
+    float backgroundValue = p.base_value + p.background_shift;
+    if (backgroundValue < 0.0f) backgroundValue = 0.0f;
+    else if (backgroundValue > 1.0f) backgroundValue = 1.0f;
+
+    properties[count++] = (rgs_property){ 0, 12, (unsigned int)p.border_width };                          // BORDER_WIDTH
+    properties[count++] = (rgs_property){ 0, RGS_MAX_PROPS_BASE + 0, (unsigned int)p.text_size };          // TEXT_SIZE
+    properties[count++] = (rgs_property){ 0, RGS_MAX_PROPS_BASE + 1, (unsigned int)p.text_spacing };       // TEXT_SPACING
+    properties[count++] = (rgs_property){ 0, RGS_MAX_PROPS_BASE + 2, properties[0].value };                // LINE_COLOR: border normal
+    properties[count++] = (rgs_property){ 0, RGS_MAX_PROPS_BASE + 3, rgs_color_from_hsv(p.hue, p.base_saturation, backgroundValue) };  // BACKGROUND_COLOR
+    properties[count++] = (rgs_property){ 0, RGS_MAX_PROPS_BASE + 4, (unsigned int)p.text_line_spacing };  // TEXT_LINE_SPACING
+
+    if (style != NULL)
+    {
+        memset(style, 0, sizeof(rgs_style));
+        style->version = RGS_STYLE_VERSION;
+        memcpy(style->properties, properties, count*sizeof(rgs_property));
+        style->property_count = count;
+    }
+
+    if (values != NULL) rgs_resolve_properties(properties, count, values);
+
+    return count;
+}
+
+// Load style parameters from text (.rgsp), returns result code
+// NOTE: One parameter per line (name value), '#' starts a comment, parameters not provided keep their value
+int rgs_params_load_from_text(rgs_params *params, const char *text)
+{
+    if ((params == NULL) || (text == NULL)) return RGS_ERROR_INVALID_DATA;
+
+    int result = RGS_OK;
+
+    for (const char *line = text; *line != '\0'; )
+    {
+        const char *end = line;
+        while ((*end != '\0') && (*end != '\n')) end++;
+
+        char buffer[128] = { 0 };
+        int length = (int)(end - line);
+        if (length > 127) length = 127;
+        memcpy(buffer, line, length);
+
+        char *comment = strchr(buffer, '#');
+        if (comment != NULL) *comment = '\0';
+
+        char name[64] = { 0 };
+        char valueText[64] = { 0 };
+        int nameLength = 0;
+        int valueLength = 0;
+        char *c = buffer;
+
+        while ((*c == ' ') || (*c == '\t') || (*c == '\r')) c++;
+        while ((*c != '\0') && (*c != ' ') && (*c != '\t') && (*c != '\r') && (nameLength < 63)) name[nameLength++] = *c++;
+        while ((*c == ' ') || (*c == '\t')) c++;
+        while ((*c != '\0') && (*c != ' ') && (*c != '\t') && (*c != '\r') && (valueLength < 63)) valueText[valueLength++] = *c++;
+
+        if (nameLength > 0)
+        {
+            int index = 0;
+            for (; index < RGS_PARAMS_COUNT; index++) if (strcmp(rgsParamsInfo[index].name, name) == 0) break;
+
+            char *valueEnd = valueText;
+            float value = 0.0f;
+
+            if ((index < RGS_PARAMS_COUNT) && (rgsParamsInfo[index].type == RGS_PARAM_HARMONY))
+            {
+                for (int h = 0; h < 4; h++) if (rgs_text_equal_nocase(rgsHarmonyText[h], valueText)) { value = (float)h; valueEnd = valueText + valueLength; }
+            }
+            if (valueEnd == valueText) value = strtof(valueText, &valueEnd);
+
+            if ((index < RGS_PARAMS_COUNT) && (valueLength > 0) && (*valueEnd == '\0')) rgs_params_set(params, index, value);
+            else result = RGS_ERROR_PARAMS;
+        }
+
+        line = (*end == '\n')? (end + 1) : end;
+    }
+
+    return result;
+}
+
+// Save style parameters as text (.rgsp), null-terminated text
+char *rgs_params_save_to_text(const rgs_params *params, int *size)
+{
+    if (params == NULL) return NULL;
+
+    rgs_text_buffer out = { 0 };
+
+    rgs_text_append(&out, "# rgs parametric style (.rgsp), compiled into style properties\n");
+    rgs_text_append(&out, "# harmony: monochrome, complementary_focused, complementary_pressed, split\n");
+
+    for (int i = 0; i < RGS_PARAMS_COUNT; i++)
+    {
+        float value = rgs_params_get(params, i);
+
+        if (rgsParamsInfo[i].type == RGS_PARAM_HARMONY) rgs_text_append(&out, "%s %s\n", rgsParamsInfo[i].name, rgsHarmonyText[(int)value]);
+        else if (rgsParamsInfo[i].type == RGS_PARAM_INT) rgs_text_append(&out, "%s %i\n", rgsParamsInfo[i].name, (int)value);
+        else rgs_text_append(&out, "%s %.3f\n", rgsParamsInfo[i].name, value);
+    }
+
+    if (size != NULL) *size = out.length;
+
+    return out.text;
+}
+
+#if !defined(RGS_NO_STDIO)
+// Load style index file (.rgsi), returns result code
+int rgs_index_load(rgs_index *index, const char *fileName)
+{
+    int result = RGS_ERROR_FILE;
+    int size = 0;
+    unsigned char *data = rgs_read_file(fileName, &size);
+
+    if (data != NULL)
+    {
+        result = rgs_index_load_from_memory(index, data, size);
+        RGS_FREE(data);
+    }
+
+    return result;
+}
+
+// Save style index file (.rgsi), returns result code
+int rgs_index_save(const rgs_index *index, const char *fileName)
+{
+    int result = RGS_ERROR_FILE;
+    int size = 0;
+    unsigned char *data = rgs_index_save_to_memory(index, &size);
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        if (fwrite(data, 1, size, file) == (size_t)size) result = RGS_OK;
+        fclose(file);
+    }
+
+    RGS_FREE(data);
+
+    return result;
+}
+
+// Update style index with style files (.rgs/.png), returns files loaded count
+// NOTE: Index entries are replaced by provided files list (missing files removed),
+// files are only loaded if modification time or size changed, and only reindexed if data hash changed
+int rgs_index_update(rgs_index *index, const char **fileNames, int count)
+{
+    // Previous entries sorted by file name for lookup
+    int prevCount = index->entry_count;
+    rgs_index_entry *prevEntries = index->entries;
+    rgs_index_entry **sorted = (rgs_index_entry **)RGS_MALLOC(((prevCount > 0)? prevCount : 1)*sizeof(rgs_index_entry *));
+    bool *reused = (bool *)RGS_CALLOC((prevCount > 0)? prevCount : 1, sizeof(bool));
+
+    for (int i = 0; i < prevCount; i++) sorted[i] = &prevEntries[i];
+    qsort(sorted, prevCount, sizeof(rgs_index_entry *), rgs_index_compare_names);
+
+    rgs_index_entry *entries = (rgs_index_entry *)RGS_CALLOC((count > 0)? count : 1, sizeof(rgs_index_entry));
+    int entryCount = 0;
+    int loadedCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        struct stat info = { 0 };
+        if ((strlen(fileNames[i]) > 4095) || (stat(fileNames[i], &info) != 0)) continue;
+
+        rgs_index_entry key = { 0 };
+        key.file_name = (char *)fileNames[i];
+        const rgs_index_entry *keyPtr = &key;
+        rgs_index_entry **found = (rgs_index_entry **)bsearch(&keyPtr, sorted, prevCount, sizeof(rgs_index_entry *), rgs_index_compare_names);
+
+        rgs_index_entry *prev = NULL;
+        if ((found != NULL) && !reused[*found - prevEntries]) prev = *found;
+
+        long long modTime = (long long)info.st_mtime;
+        int fileSize = (int)info.st_size;
+        rgs_index_entry *entry = &entries[entryCount];
+
+        if ((prev != NULL) && (prev->mod_time == modTime) && (prev->file_size == fileSize))
+        {
+            *entry = *prev;
+            reused[prev - prevEntries] = true;
+        }
+        else
+        {
+            int size = 0;
+            unsigned char *data = rgs_read_file(fileNames[i], &size);
+            if (data == NULL) continue;
+
+            unsigned int hash = rgs_hash_fnv1a(2166136261u, data, size);
+
+            if ((prev != NULL) && (prev->file_hash == hash) && (prev->file_size == size))
+            {
+                // File touched but not changed, only file time updated
+                *entry = *prev;
+                reused[prev - prevEntries] = true;
+            }
+            else
+            {
+                int nameLength = (int)strlen(fileNames[i]);
+
+                rgs_index_entry_load(entry, data, size);
+                entry->file_name = (char *)RGS_MALLOC(nameLength + 1);
+                memcpy(entry->file_name, fileNames[i], nameLength + 1);
+                entry->file_hash = hash;
+                loadedCount++;
+            }
+
+            entry->file_size = size;
+            RGS_FREE(data);
+        }
+
+        entry->mod_time = modTime;
+        entryCount++;
+    }
+
+    // Previous entries not reused are unloaded
+    for (int i = 0; i < prevCount; i++) if (!reused[i]) rgs_index_entry_unload(&prevEntries[i]);
+
+    RGS_FREE(prevEntries);
+    RGS_FREE(sorted);
+    RGS_FREE(reused);
+
+    index->entries = entries;
+    index->entry_count = entryCount;
+    rgs_index_build_postings(index);
+
+    return loadedCount;
+}
+
+// Load style parameters file (.rgsp), returns result code
+// NOTE: Parameters are reset to default values before loading
+int rgs_params_load(rgs_params *params, const char *fileName)
+{
+    int size = 0;
+    unsigned char *data = rgs_read_file(fileName, &size);
+
+    if (data == NULL) return RGS_ERROR_FILE;
+
+    char *text = (char *)RGS_MALLOC(size + 1);
+    memcpy(text, data, size);
+    text[size] = '\0';
+
+    rgs_params_default(params);
+    int result = rgs_params_load_from_text(params, text);
+
+    RGS_FREE(text);
+    RGS_FREE(data);
+
+    return result;
+}
+
+// Save style parameters file (.rgsp), returns result code
+int rgs_params_save(const rgs_params *params, const char *fileName)
+{
+    int result = RGS_ERROR_FILE;
+    int size = 0;
+    char *text = rgs_params_save_to_text(params, &size);
+    FILE *file = (text != NULL)? fopen(fileName, "wb") : NULL;
+
+    if (file != NULL)
+    {
+        if (fwrite(text, 1, size, file) == (size_t)size) result = RGS_OK;
+        fclose(file);
+    }
+
+    RGS_FREE(text);
+
+    return result;
+}
+#endif
+
+// Get result code description
+const char *rgs_result_text(int result)
+{
+    switch (result)
+    {
+        case RGS_OK: return "OK";
+        case RGS_ERROR_INVALID_DATA: return "Invalid data (NULL or truncated)";
+        case RGS_ERROR_SIGNATURE: return "Invalid signature, not a style file";
+        case RGS_ERROR_PROPERTIES: return "Invalid properties data";
+        case RGS_ERROR_FONT: return "Invalid font data";
+        case RGS_ERROR_CHUNK: return "Invalid extension chunk data";
+        case RGS_ERROR_DECOMPRESS: return "Compressed data could not be decompressed";
+        case RGS_ERROR_PNG: return "Invalid PNG data or no style chunk (rGSf) available";
+        case RGS_ERROR_FILE: return "File could not be read/written";
+        case RGS_ERROR_INDEX: return "Invalid index data";
+        case RGS_ERROR_QUERY: return "Invalid index query";
+        case RGS_ERROR_LAYER: return "Invalid style layer (out of range or layers stack full)";
+        case RGS_ERROR_PARAMS: return "Invalid style parameters (unknown parameter or value)";
+        case RGS_ERROR_VERSION: return "Style data version not supported";
+        default: return "Unknown error";
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Read int value
+static int rgs_read_int(rgs_reader *reader)
+{
+    int value = 0;
+    const unsigned char *data = rgs_read_bytes(reader, sizeof(int));
+    if (data != NULL) memcpy(&value, data, sizeof(int));
+    return value;
+}
+
+// Read short value
+static short rgs_read_short(rgs_reader *reader)
+{
+    short value = 0;
+    const unsigned char *data = rgs_read_bytes(reader, sizeof(short));
+    if (data != NULL) memcpy(&value, data, sizeof(short));
+    return value;
+}
+
+// Read bytes, returns pointer to data (NULL if out of bounds)
+static const unsigned char *rgs_read_bytes(rgs_reader *reader, int count)
+{
+    if (reader->error || (count < 0) || (count > (reader->size - reader->offset)))
+    {
+        reader->error = true;
+        return NULL;
+    }
+
+    const unsigned char *data = reader->data + reader->offset;
+    reader->offset += count;
+
+    return data;
+}
+
+// Read variable-length integer (LEB128)
+// NOTE: Used by compact style properties encoding, 7 bits per byte, up to 10 bytes
+static unsigned long long rgs_read_varint(rgs_reader *reader)
+{
+    unsigned long long value = 0;
+
+    for (int i = 0, shift = 0; i < 10; i++, shift += 7)
+    {
+        const unsigned char *byte = rgs_read_bytes(reader, 1);
+        if (byte == NULL) break;
+
+        value |= ((unsigned long long)(byte[0] & 0x7f) << shift);
+        if ((byte[0] & 0x80) == 0) break;
+    }
+
+    return value;
+}
+
+// Write variable-length integer (LEB128), returns bytes written
+static int rgs_write_varint(unsigned char *buffer, unsigned long long value)
+{
+    int size = 0;
+
+    do
+    {
+        buffer[size] = (unsigned char)(value & 0x7f);
+        value >>= 7;
+        if (value > 0) buffer[size] |= 0x80;
+        size++;
+    } while (value > 0);
+
+    return size;
+}
+
+// Compress data (DEFLATE)
+// NOTE: Same compressor and level as raylib CompressData(), data is compatible with DecompressData()
+static unsigned char *rgs_compress(const unsigned char *data, int size, int *compSize)
+{
+    struct sdefl *sdefl = (struct sdefl *)RGS_CALLOC(1, sizeof(struct sdefl));
+    unsigned char *compData = (unsigned char *)RGS_CALLOC(sdefl_bound(size), 1);
+
+    *compSize = sdeflate(sdefl, compData, data, size, RGS_DEFLATE_LEVEL);
+
+    RGS_FREE(sdefl);
+
+    return compData;
+}
+
+// Decompress data (DEFLATE), NULL on error
+// NOTE: Result code: RGS_ERROR_INVALID_DATA if stream is corrupted (or exceeds size), RGS_ERROR_DECOMPRESS if size does not match
+static unsigned char *rgs_decompress(const unsigned char *compData, int compSize, int size, int *result)
+{
+    unsigned char *data = (unsigned char *)RGS_MALLOC(size);
+    int dataSize = rgs_inflate(data, size, compData, compSize);
+
+    if (dataSize != size)
+    {
+        *result = (dataSize < 0)? RGS_ERROR_INVALID_DATA : RGS_ERROR_DECOMPRESS;
+        RGS_FREE(data);
+        data = NULL;
+    }
+
+    return data;
+}
+
+// Read bits from DEFLATE stream (LSB first)
+static int rgs_inflate_bits(rgs_inflater *inflater, int count)
+{
+    unsigned int bits = inflater->bitBuffer;
+
+    while (inflater->bitCount < count)
+    {
+        if (inflater->compOffset >= inflater->compSize) { inflater->error = true; return 0; }
+
+        bits |= ((unsigned int)inflater->compData[inflater->compOffset] << inflater->bitCount);
+        inflater->compOffset++;
+        inflater->bitCount += 8;
+    }
+
+    inflater->bitBuffer = (count < 32)? (bits >> count) : 0;
+    inflater->bitCount -= count;
+
+    return (int)(bits & ((1u << count) - 1));
+}
+
+// Build canonical Huffman code from code lengths
+// NOTE: Returns 0 for a complete code, > 0 for an incomplete code and < 0 for an over-subscribed code (not valid)
+static int rgs_inflate_build(rgs_huffman *huffman, const unsigned char *lengths, int count)
+{
+    short offsets[16] = { 0 };
+    int left = 1;
+
+    for (int i = 0; i < 16; i++) huffman->counts[i] = 0;
+    for (int i = 0; i < count; i++) huffman->counts[lengths[i]]++;
+
+    if (huffman->counts[0] == count) return 0;      // No codes, decoding fails if used
+
+    for (int i = 1; i < 16; i++)
+    {
+        left = left*2 - huffman->counts[i];
+        if (left < 0) return left;
+    }
+
+    for (int i = 1; i < 15; i++) offsets[i + 1] = offsets[i] + huffman->counts[i];
+    for (int i = 0; i < count; i++) if (lengths[i] != 0) huffman->symbols[offsets[lengths[i]]++] = (short)i;
+
+    return left;
+}
+
+// Decode one symbol from DEFLATE stream, -1 if code not valid
+static int rgs_inflate_decode(rgs_inflater *inflater, const rgs_huffman *huffman)
+{
+    int code = 0;       // Code bits read
+    int first = 0;      // First code of current length
+    int index = 0;      // Symbols index of first code of current length
+
+    for (int length = 1; (length < 16) && !inflater->error; length++)
+    {
+        code |= rgs_inflate_bits(inflater, 1);
+
+        int count = huffman->counts[length];
+        if ((code - count) < first) return huffman->symbols[index + (code - first)];
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+// Decode Huffman compressed block data (literals and matches) until end of block
+static void rgs_inflate_codes(rgs_inflater *inflater, const rgs_huffman *lengthCode, const rgs_huffman *distCode)
+{
+    static const short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const short lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static const short distBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769,
+        1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static const short distExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    while (!inflater->error)
+    {
+        int symbol = rgs_inflate_decode(inflater, lengthCode);
+
+        if ((symbol < 0) || (symbol > 285)) inflater->error = true;
+        else if (symbol < 256)
+        {
+            // Literal
+            if (inflater->offset >= inflater->size) inflater->error = true;
+            else inflater->data[inflater->offset++] = (unsigned char)symbol;
+        }
+        else if (symbol == 256) break;      // End of block
+        else
+        {
+            // Match: length and distance back in output data
+            int length = lengthBase[symbol - 257] + rgs_inflate_bits(inflater, lengthExtra[symbol - 257]);
+            int distSymbol = rgs_inflate_decode(inflater, distCode);
+
+            if ((distSymbol < 0) || (distSymbol > 29)) { inflater->error = true; break; }
+
+            int distance = distBase[distSymbol] + rgs_inflate_bits(inflater, distExtra[distSymbol]);
+
+            if (inflater->error || (distance > inflater->offset) || (length > (inflater->size - inflater->offset))) inflater->error = true;
+            else
+            {
+                for (int i = 0; i < length; i++, inflater->offset++) inflater->data[inflater->offset] = inflater->data[inflater->offset - distance];
+            }
+        }
+    }
+}
+
+// Decompress DEFLATE stream (RFC 1951), returns data size or -1 if stream not valid
+// NOTE: Canonical Huffman codes decoded bit by bit, no lookup tables; any read out of stream,
+// write over data size, distance before data start or invalid/incomplete code fails decoding
+static int rgs_inflate(unsigned char *data, int size, const unsigned char *compData, int compSize)
+{
+    static const unsigned char lengthsOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    rgs_inflater inflater = { compData, compSize, 0, 0, 0, data, size, 0, false };
+    rgs_huffman lengthCode = { 0 };
+    rgs_huffman distCode = { 0 };
+    bool last = false;
+
+    while (!last && !inflater.error)
+    {
+        last = (rgs_inflate_bits(&inflater, 1) == 1);
+        int type = rgs_inflate_bits(&inflater, 2);
+
+        if (inflater.error) break;
+
+        if (type == 0)
+        {
+            // Stored block: byte aligned [2 bytes: length][2 bytes: ~length][data]
+            inflater.bitBuffer = 0;
+            inflater.bitCount = 0;
+
+            if ((inflater.compOffset + 4) > inflater.compSize) { inflater.error = true; break; }
+
+            const unsigned char *header = inflater.compData + inflater.compOffset;
+            int length = header[0] | (header[1] << 8);
+            inflater.compOffset += 4;
+
+            if ((header[2] != (~header[0] & 0xff)) || (header[3] != (~header[1] & 0xff)) ||
+                (length > (inflater.compSize - inflater.compOffset)) || (length > (inflater.size - inflater.offset))) { inflater.error = true; break; }
+
+            memcpy(inflater.data + inflater.offset, inflater.compData + inflater.compOffset, length);
+            inflater.offset += length;
+            inflater.compOffset += length;
+        }
+        else if (type == 1)
+        {
+            // Fixed Huffman codes block
+            unsigned char lengths[288 + 30] = { 0 };
+
+            for (int i = 0; i < 288; i++) lengths[i] = (i < 144)? 8 : ((i < 256)? 9 : ((i < 280)? 7 : 8));
+            for (int i = 0; i < 30; i++) lengths[288 + i] = 5;
+
+            rgs_inflate_build(&lengthCode, lengths, 288);
+            rgs_inflate_build(&distCode, lengths + 288, 30);
+            rgs_inflate_codes(&inflater, &lengthCode, &distCode);
+        }
+        else if (type == 2)
+        {
+            // Dynamic Huffman codes block: code lengths code, then literals/lengths and distances code lengths
+            unsigned char lengths[286 + 30] = { 0 };
+            int lengthCount = rgs_inflate_bits(&inflater, 5) + 257;
+            int distCount = rgs_inflate_bits(&inflater, 5) + 1;
+            int codeCount = rgs_inflate_bits(&inflater, 4) + 4;
+
+            if ((lengthCount > 286) || (distCount > 30)) { inflater.error = true; break; }
+
+            for (int i = 0; i < codeCount; i++) lengths[lengthsOrder[i]] = (unsigned char)rgs_inflate_bits(&inflater, 3);
+
+            // NOTE: Code lengths code must be complete
+            if (inflater.error || (rgs_inflate_build(&lengthCode, lengths, 19) != 0)) { inflater.error = true; break; }
+
+            for (int i = 0; (i < (lengthCount + distCount)) && !inflater.error; )
+            {
+                int symbol = rgs_inflate_decode(&inflater, &lengthCode);
+                int repeat = 0;
+                unsigned char length = 0;
+
+                if (symbol < 0) { inflater.error = true; break; }
+                else if (symbol < 16) { lengths[i++] = (unsigned char)symbol; continue; }
+                else if (symbol == 16)
+                {
+                    if (i == 0) { inflater.error = true; break; }
+                    length = lengths[i - 1];
+                    repeat = 3 + rgs_inflate_bits(&inflater, 2);
+                }
+                else if (symbol == 17) repeat = 3 + rgs_inflate_bits(&inflater, 3);
+                else repeat = 11 + rgs_inflate_bits(&inflater, 7);
+
+                if ((i + repeat) > (lengthCount + distCount)) { inflater.error = true; break; }
+
+                for (; repeat > 0; repeat--) lengths[i++] = length;
+            }
+
+            if (inflater.error) break;
+
+            // NOTE: End of block code required, incomplete codes only accepted for single code
+            if (lengths[256] == 0) { inflater.error = true; break; }
+
+            int lengthLeft = rgs_inflate_build(&lengthCode, lengths, lengthCount);
+            if ((lengthLeft < 0) || ((lengthLeft > 0) && ((lengthCount - lengthCode.counts[0]) != 1))) { inflater.error = true; break; }
+
+            int distLeft = rgs_inflate_build(&distCode, lengths + lengthCount, distCount);
+            if ((distLeft < 0) || ((distLeft > 0) && ((distCount - distCode.counts[0]) != 1))) { inflater.error = true; break; }
+
+            rgs_inflate_codes(&inflater, &lengthCode, &distCode);
+        }
+        else inflater.error = true;     // Reserved block type
+    }
+
+    return inflater.error? -1 : inflater.offset;
+}
+
+// Read font recs and glyphs data
+// NOTE: Every block is [int compSize][data], if compSize is 0 (or matches data size) data is not compressed
+static int rgs_read_font_data(rgs_reader *reader, int glyphCount, rgs_rectangle **recs, rgs_glyph **glyphs, bool compSizeRead)
+{
+    if ((glyphCount <= 0) || (glyphCount > RGS_MAX_GLYPHS)) return RGS_ERROR_FONT;
+
+    int dataSize = glyphCount*16;       // 16 bytes data per glyph (recs and glyphs)
+    unsigned char *blocks[2] = { 0 };
+    int result = RGS_OK;
+
+    for (int b = 0; (b < 2) && (result == RGS_OK); b++)
+    {
+        int compSize = compSizeRead? rgs_read_int(reader) : 0;
+
+        if (reader->error || (compSize < 0)) result = RGS_ERROR_FONT;
+        else if ((compSize > 0) && (compSize != dataSize))
+        {
+            const unsigned char *compData = rgs_read_bytes(reader, compSize);
+
+            if (compData == NULL) result = RGS_ERROR_FONT;
+            else
+            {
+                blocks[b] = rgs_decompress(compData, compSize, dataSize, &result);
+            }
+        }
+        else
+        {
+            const unsigned char *data = rgs_read_bytes(reader, dataSize);
+
+            if (data == NULL) result = RGS_ERROR_FONT;
+            else
+            {
+                blocks[b] = (unsigned char *)RGS_MALLOC(dataSize);
+                memcpy(blocks[b], data, dataSize);
+            }
+        }
+    }
+
+    if (result != RGS_OK)
+    {
+        RGS_FREE(blocks[0]);
+        RGS_FREE(blocks[1]);
+        return result;
+    }
+
+    // NOTE: rgs_rectangle and rgs_glyph match saved layout (4 values of 4 bytes)
+    *recs = (rgs_rectangle *)blocks[0];
+    *glyphs = (rgs_glyph *)blocks[1];
+
+    return RGS_OK;
+}
+
+// Find property index, -1 if not found
+static int rgs_find_property(const rgs_style *style, int control, int property)
+{
+    for (int i = 0; i < style->property_count; i++)
+    {
+        if ((style->properties[i].control_id == control) && (style->properties[i].property_id == property)) return i;
+    }
+
+    return -1;
+}
+
+// Load font faces chunk (FNTF)
+// NOTE: Faces are only valid over a loaded font atlas
+static int rgs_load_font_faces(rgs_style *style, rgs_reader *reader)
+{
+    if (style->font.faces[0].glyph_count <= 0) return RGS_OK;
+
+    int faceCount = rgs_read_int(reader);
+
+    for (int f = 0; (f < faceCount) && !reader->error; f++)
+    {
+        int faceId = rgs_read_int(reader);
+        int baseSize = rgs_read_int(reader);
+        int glyphCount = rgs_read_int(reader);
+
+        if (reader->error || (faceId <= 0) || (faceId >= RGS_MAX_FONT_FACES) || (style->font.faces[faceId].glyph_count > 0)) return RGS_ERROR_CHUNK;
+
+        rgs_font_face *face = &style->font.faces[faceId];
+        int result = rgs_read_font_data(reader, glyphCount, &face->recs, &face->glyphs, true);
+        if (result != RGS_OK) return result;
+
+        face->base_size = baseSize;
+        face->glyph_count = glyphCount;
+    }
+
+    return reader->error? RGS_ERROR_CHUNK : RGS_OK;
+}
+
+// Load custom icons chunk (ICNS)
+static int rgs_load_icons(rgs_style *style, rgs_reader *reader)
+{
+    short iconSize = rgs_read_short(reader);
+    short iconCount = rgs_read_short(reader);
+    const unsigned char *iconsMap = rgs_read_bytes(reader, RGS_ICON_MAX_ICONS/8);
+    int iconsDataCompSize = rgs_read_int(reader);
+
+    if (reader->error || (iconSize != RGS_ICON_SIZE) || (iconCount <= 0) || (iconCount > RGS_ICON_MAX_ICONS) || (style->icons_data != NULL)) return RGS_ERROR_CHUNK;
+
+    // Icons map must define the same number of icons provided
+    int mapCount = 0;
+    for (int i = 0; i < RGS_ICON_MAX_ICONS; i++) if (iconsMap[i/8] & (1 << (i%8))) mapCount++;
+    if (mapCount != iconCount) return RGS_ERROR_CHUNK;
+
+    int iconsDataSize = iconCount*RGS_ICON_DATA_ELEMENTS*sizeof(unsigned int);
+
+    if (iconsDataCompSize > 0)
+    {
+        const unsigned char *compData = rgs_read_bytes(reader, iconsDataCompSize);
+        if (compData == NULL) return RGS_ERROR_CHUNK;
+
+        int result = RGS_OK;
+        style->icons_data = (unsigned int *)rgs_decompress(compData, iconsDataCompSize, iconsDataSize, &result);
+        if (style->icons_data == NULL) return result;
+    }
+    else
+    {
+        const unsigned char *data = rgs_read_bytes(reader, iconsDataSize);
+        if (data == NULL) return RGS_ERROR_CHUNK;
+
+        style->icons_data = (unsigned int *)RGS_MALLOC(iconsDataSize);
+        memcpy(style->icons_data, data, iconsDataSize);
+    }
+
+    style->icon_count = iconCount;
+    memcpy(style->icons_map, iconsMap, RGS_ICON_MAX_ICONS/8);
+
+    return RGS_OK;
+}
+
+// Find PNG chunk, returns result code
+// NOTE: Chunk data offset and length returned by reference, all chunks are bounds checked up to IEND
+static int rgs_png_find_chunk(const unsigned char *png, int size, const char *type, int *offset, int *length)
+{
+    static const unsigned char pngSignature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+
+    // NOTE: Minimum valid PNG: signature + IHDR (25 bytes) + IEND (12 bytes)
+    if ((png == NULL) || (size < 45) || (memcmp(png, pngSignature, 8) != 0) || (memcmp(png + 12, "IHDR", 4) != 0)) return RGS_ERROR_INVALID_DATA;
+
+    int result = RGS_ERROR_PNG;
+    int position = 8;
+
+    while ((position + 12) <= size)
+    {
+        unsigned int chunkLength = ((unsigned int)png[position] << 24) | ((unsigned int)png[position + 1] << 16) | ((unsigned int)png[position + 2] << 8) | png[position + 3];
+
+        if (chunkLength > (unsigned int)(size - position - 12)) return RGS_ERROR_INVALID_DATA;
+
+        if ((result != RGS_OK) && (memcmp(png + position + 4, type, 4) == 0))
+        {
+            *offset = position + 8;
+            *length = (int)chunkLength;
+            result = RGS_OK;
+        }
+
+        if (memcmp(png + position + 4, "IEND", 4) == 0) return result;
+
+        position += (12 + (int)chunkLength);
+    }
+
+    return RGS_ERROR_INVALID_DATA;     // No IEND chunk found, PNG data truncated
+}
+
+// Append formatted text to buffer
+static void rgs_text_append(rgs_text_buffer *buffer, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if ((buffer->length + length + 1) > buffer->capacity)
+    {
+        int capacity = (buffer->capacity > 0)? buffer->capacity*2 : 4096;
+        while (capacity < (buffer->length + length + 1)) capacity *= 2;
+
+        buffer->text = (char *)RGS_REALLOC(buffer->text, capacity);
+        buffer->capacity = capacity;
+    }
+
+    va_start(args, format);
+    vsnprintf(buffer->text + buffer->length, length + 1, format, args);
+    va_end(args);
+
+    buffer->length += length;
+}
+
+// Convert text case: 0-lower, 1-upper, 2-pascal
+// NOTE: Pascal case uppercases first char and chars after '_', removing the '_' (same as raylib TextToPascal())
+static void rgs_text_case(char *dst, const char *src, int mode, int maxLength)
+{
+    int length = 0;
+
+    for (int i = 0; (src[i] != '\0') && (length < maxLength); i++)
+    {
+        char c = src[i];
+
+        if (mode == 0) { if ((c >= 'A') && (c <= 'Z')) c += 32; }
+        else if (mode == 1) { if ((c >= 'a') && (c <= 'z')) c -= 32; }
+        else
+        {
+            if ((i == 0) || (src[i - 1] == '_')) { if ((c >= 'a') && (c <= 'z')) c -= 32; }
+            if (c == '_') continue;
+        }
+
+        dst[length] = c;
+        length++;
+    }
+
+    dst[length] = '\0';
+}
+
+// Check if texts are equal, case insensitive
+static bool rgs_text_equal_nocase(const char *text1, const char *text2)
+{
+    for (int i = 0; ; i++)
+    {
+        char c1 = text1[i];
+        char c2 = text2[i];
+
+        if ((c1 >= 'a') && (c1 <= 'z')) c1 -= 32;
+        if ((c2 >= 'a') && (c2 <= 'z')) c2 -= 32;
+
+        if (c1 != c2) return false;
+        if (c1 == '\0') return true;
+    }
+}
+
+// Compute data hash (FNV-1a), continuing from previous hash
+// NOTE: Initial hash value (offset basis): 2166136261
+static unsigned int rgs_hash_fnv1a(unsigned int hash, const unsigned char *data, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Load index entry data from style data (.rgs or PNG)
+// NOTE: Entry file info (name, time, size, hash) is not modified
+static void rgs_index_entry_load(rgs_index_entry *entry, const unsigned char *data, int size)
+{
+    static const unsigned char pngSignature[8] = { 0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a };
+    rgs_style *style = (rgs_style *)RGS_CALLOC(1, sizeof(rgs_style));
+
+    if ((size >= 8) && (memcmp(data, pngSignature, 8) == 0)) entry->result = rgs_load_from_png_memory(style, data, size);
+    else entry->result = rgs_load_from_memory(style, data, size);
+
+    if (entry->result == RGS_OK)
+    {
+        if (style->property_count > 0)
+        {
+            entry->properties = (rgs_property *)RGS_MALLOC(style->property_count*sizeof(rgs_property));
+            memcpy(entry->properties, style->properties, style->property_count*sizeof(rgs_property));
+            entry->property_count = style->property_count;
+        }
+
+        entry->icon_count = style->icon_count;
+
+        const rgs_font_face *face = &style->font.faces[0];
+
+        if (face->glyph_count > 0)
+        {
+            // NOTE: Same font embedded with different atlas formats generates a different hash
+            unsigned int hash = rgs_hash_fnv1a(2166136261u, style->font.atlas_data, style->font.atlas_size);
+            hash = rgs_hash_fnv1a(hash, (const unsigned char *)face->recs, face->glyph_count*sizeof(rgs_rectangle));
+            hash = rgs_hash_fnv1a(hash, (const unsigned char *)face->glyphs, face->glyph_count*sizeof(rgs_glyph));
+
+            entry->font_hash = hash;
+            entry->font_base_size = face->base_size;
+            entry->glyph_count = face->glyph_count;
+            entry->codepoint_min = face->glyphs[0].value;
+            entry->codepoint_max = face->glyphs[0].value;
+
+            for (int i = 0; i < face->glyph_count; i++)
+            {
+                int codepoint = face->glyphs[i].value;
+                int block = 0;
+
+                if (codepoint < entry->codepoint_min) entry->codepoint_min = codepoint;
+                if (codepoint > entry->codepoint_max) entry->codepoint_max = codepoint;
+
+                while ((block < (RGS_CHARSET_BLOCKS - 1)) && ((codepoint < rgsCharsetBlocks[block].first) || (codepoint > rgsCharsetBlocks[block].last))) block++;
+                entry->charset_mask |= (1u << block);
+            }
+        }
+    }
+
+    rgs_unload(style);
+    RGS_FREE(style);
+}
+
+// Unload index entry allocated data
+static void rgs_index_entry_unload(rgs_index_entry *entry)
+{
+    RGS_FREE(entry->file_name);
+    RGS_FREE(entry->properties);
+
+    memset(entry, 0, sizeof(rgs_index_entry));
+}
+
+// Build index postings from entries data
+// NOTE: Only successfully loaded entries are posted, postings are sorted by key and entry
+static void rgs_index_build_postings(rgs_index *index)
+{
+    int capacity = 0;
+    for (int i = 0; i < index->entry_count; i++) capacity += (4 + 2*index->entries[i].property_count + RGS_CHARSET_BLOCKS);
+
+    RGS_FREE(index->postings);
+    index->postings = (rgs_index_posting *)RGS_MALLOC(((capacity > 0)? capacity : 1)*sizeof(rgs_index_posting));
+    index->posting_count = 0;
+
+    #define RGS_INDEX_POST(type, data) { index->postings[index->posting_count].key = ((unsigned long long)(type) << 56) | (unsigned long long)(data); \
+                                         index->postings[index->posting_count].entry = i; index->posting_count++; }
+
+    for (int i = 0; i < index->entry_count; i++)
+    {
+        const rgs_index_entry *entry = &index->entries[i];
+
+        if (entry->result != RGS_OK) continue;
+
+        for (int p = 0; p < entry->property_count; p++)
+        {
+            const rgs_property *prop = &entry->properties[p];
+
+            RGS_INDEX_POST(RGS_INDEX_KEY_PROPERTY, ((unsigned long long)prop->control_id << 48) | ((unsigned long long)prop->property_id << 40) | prop->value);
+
+            // Color properties: base colors (all controls) and DEFAULT LINE_COLOR, BACKGROUND_COLOR
+            if ((prop->property_id < 12) || ((prop->control_id == 0) && ((prop->property_id == 18) || (prop->property_id == 19)))) RGS_INDEX_POST(RGS_INDEX_KEY_COLOR, prop->value);
+        }
+
+        if (entry->glyph_count > 0)
+        {
+            RGS_INDEX_POST(RGS_INDEX_KEY_FONT, entry->font_hash);
+            RGS_INDEX_POST(RGS_INDEX_KEY_FONT_SIZE, (unsigned int)entry->font_base_size);
+
+            for (int b = 0; b < RGS_CHARSET_BLOCKS; b++) if (entry->charset_mask & (1u << b)) RGS_INDEX_POST(RGS_INDEX_KEY_CHARSET, b);
+        }
+
+        RGS_INDEX_POST(RGS_INDEX_KEY_GLYPHS, (unsigned int)entry->glyph_count);
+        RGS_INDEX_POST(RGS_INDEX_KEY_ICONS, (unsigned int)entry->icon_count);
+    }
+
+    #undef RGS_INDEX_POST
+
+    qsort(index->postings, index->posting_count, sizeof(rgs_index_posting), rgs_index_compare_postings);
+
+    // Remove duplicated postings (same color used by multiple properties)
+    int count = 0;
+    for (int i = 0; i < index->posting_count; i++)
+    {
+        if ((count == 0) || (index->postings[i].key != index->postings[count - 1].key) || (index->postings[i].entry != index->postings[count - 1].entry)) index->postings[count++] = index->postings[i];
+    }
+
+    index->posting_count = count;
+}
+
+// Compare postings by key and entry [qsort()]
+static int rgs_index_compare_postings(const void *a, const void *b)
+{
+    const rgs_index_posting *postingA = (const rgs_index_posting *)a;
+    const rgs_index_posting *postingB = (const rgs_index_posting *)b;
+
+    if (postingA->key != postingB->key) return (postingA->key < postingB->key)? -1 : 1;
+    return (postingA->entry > postingB->entry) - (postingA->entry < postingB->entry);
+}
+
+// Find first posting with key not less than provided
+static int rgs_index_lower_bound(const rgs_index *index, unsigned long long key)
+{
+    int first = 0;
+    int last = index->posting_count;
+
+    while (first < last)
+    {
+        int middle = first + (last - first)/2;
+
+        if (index->postings[middle].key < key) first = middle + 1;
+        else last = middle;
+    }
+
+    return first;
+}
+
+// Parse query term, returns result code
+static int rgs_index_parse_term(const char *text, rgs_index_term *term)
+{
+    char name[128] = { 0 };
+    int length = 0;
+
+    while ((text[length] != '\0') && (text[length] != '=') && (text[length] != '<') && (text[length] != '>')) { name[length] = text[length]; length++; }
+
+    // Read operator
+    const char *op = text + length;
+    int opLength = ((op[0] != '\0') && (op[1] == '='))? 2 : 1;
+    if ((op[0] == '\0') || (op[0] == '=' && opLength == 2)) return RGS_ERROR_QUERY;
+
+    const char *valueText = op + opLength;
+    if (valueText[0] == '\0') return RGS_ERROR_QUERY;
+
+    unsigned long long type = 0;
+    unsigned long long base = 0;    // Key data base (property ids)
+    unsigned long long value = 0;
+    unsigned long long valueMax = 0;    // Value range for '=' operator (color alpha ignored)
+    unsigned long long limit = 0xffffffffull;
+    char *end = NULL;
+
+    term->control = -1;
+    term->property = -1;
+
+    if (rgs_text_equal_nocase(name, "charset"))
+    {
+        if (op[0] != '=') return RGS_ERROR_QUERY;
+
+        int block = 0;
+        while ((block < RGS_CHARSET_BLOCKS) && !rgs_text_equal_nocase(valueText, rgsCharsetBlocks[block].name)) block++;
+        if (block >= RGS_CHARSET_BLOCKS) return RGS_ERROR_QUERY;
+
+        term->keyMin = term->keyMax = ((unsigned long long)RGS_INDEX_KEY_CHARSET << 56) | (unsigned long long)block;
+        return RGS_OK;
+    }
+
+    // Parse value: decimal, hexadecimal (0x) or color (#rrggbb[aa], #rrggbb matches any alpha)
+    if (valueText[0] == '#')
+    {
+        int digits = (int)strlen(valueText + 1);
+
+        value = strtoull(valueText + 1, &end, 16);
+        if ((*end != '\0') || ((digits != 6) && (digits != 8))) return RGS_ERROR_QUERY;
+
+        if (digits == 6)
+        {
+            value = (value << 8) | 0xff;
+            valueMax = value;
+            if (op[0] == '=') value &= ~0xffull;
+        }
+        else valueMax = value;
+    }
+    else
+    {
+        // NOTE: Font hash is always hexadecimal
+        value = (unsigned long long)strtoll(valueText, &end, rgs_text_equal_nocase(name, "font")? 16 : 0) & 0xffffffffull;
+        if (*end != '\0') return RGS_ERROR_QUERY;
+        valueMax = value;
+    }
+
+    if (rgs_text_equal_nocase(name, "color")) type = RGS_INDEX_KEY_COLOR;
+    else if (rgs_text_equal_nocase(name, "font")) type = RGS_INDEX_KEY_FONT;
+    else if (rgs_text_equal_nocase(name, "size")) type = RGS_INDEX_KEY_FONT_SIZE;
+    else if (rgs_text_equal_nocase(name, "glyphs")) type = RGS_INDEX_KEY_GLYPHS;
+    else if (rgs_text_equal_nocase(name, "icons")) type = RGS_INDEX_KEY_ICONS;
+    else
+    {
+        // Property: CONTROL.PROPERTY, names or ids
+        char *separator = strchr(name, '.');
+        if (separator == NULL) return RGS_ERROR_QUERY;
+        *separator = '\0';
+
+        const char *controlText = name;
+        const char *propertyText = separator + 1;
+
+        for (int c = 0; c < RGS_MAX_CONTROLS; c++) if (rgs_text_equal_nocase(controlText, rgsControlText[c])) term->control = c;
+        for (int p = 0; p < RGS_MAX_PROPS_BASE; p++) if (rgs_text_equal_nocase(propertyText, rgsPropsText[p])) term->property = p;
+        for (int p = 0; p < RGS_MAX_PROPS_EXTENDED; p++) if (rgs_text_equal_nocase(propertyText, rgsPropsExtText[p])) term->property = RGS_MAX_PROPS_BASE + p;
+
+        if (term->control < 0) { term->control = (int)strtol(controlText, &end, 10); if ((*end != '\0') || (controlText[0] == '\0')) term->control = -1; }
+        if (term->property < 0) { term->property = (int)strtol(propertyText, &end, 10); if ((*end != '\0') || (propertyText[0] == '\0')) term->property = -1; }
+
+        if ((term->control < 0) || (term->control >= RGS_MAX_CONTROLS) ||
+            (term->property < 0) || (term->property >= (RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED))) return RGS_ERROR_QUERY;
+
+        type = RGS_INDEX_KEY_PROPERTY;
+        base = ((unsigned long long)term->control << 48) | ((unsigned long long)term->property << 40);
+    }
+
+    if ((type != RGS_INDEX_KEY_PROPERTY) && (type != RGS_INDEX_KEY_COLOR) && (valueText[0] == '#')) return RGS_ERROR_QUERY;
+    if ((type == RGS_INDEX_KEY_FONT) && (op[0] != '=')) return RGS_ERROR_QUERY;
+
+    // Values range from operator
+    unsigned long long minValue = 0;
+    unsigned long long maxValue = limit;
+
+    if (op[0] == '=') { minValue = value; maxValue = valueMax; }
+    else if ((op[0] == '<') && (opLength == 1)) { if (value == 0) return RGS_ERROR_QUERY; maxValue = value - 1; }
+    else if (op[0] == '<') maxValue = value;
+    else if ((op[0] == '>') && (opLength == 1)) { if (value == limit) return RGS_ERROR_QUERY; minValue = value + 1; }
+    else minValue = value;
+
+    term->keyMin = (type << 56) | base | minValue;
+    term->keyMax = (type << 56) | base | maxValue;
+
+    return RGS_OK;
+}
+
+// Match query term postings
+// NOTE: Controls properties not defined by style inherit DEFAULT base property value (same as raygui loading)
+static void rgs_index_match_term(const rgs_index *index, const rgs_index_term *term, int termId, int *entryTerm, int *entryMatches)
+{
+    for (int i = rgs_index_lower_bound(index, term->keyMin); (i < index->posting_count) && (index->postings[i].key <= term->keyMax); i++)
+    {
+        int entry = index->postings[i].entry;
+        if (entryTerm[entry] != termId) { entryTerm[entry] = termId; entryMatches[entry]++; }
+    }
+
+    if ((term->control > 0) && (term->property < RGS_MAX_PROPS_BASE))
+    {
+        unsigned long long defaultMask = ~(0xffull << 48);
+
+        for (int i = rgs_index_lower_bound(index, term->keyMin & defaultMask); (i < index->posting_count) && (index->postings[i].key <= (term->keyMax & defaultMask)); i++)
+        {
+            int entry = index->postings[i].entry;
+            if (entryTerm[entry] == termId) continue;
+
+            // DEFAULT value only applies if control property is not defined
+            const rgs_index_entry *indexEntry = &index->entries[entry];
+            bool defined = false;
+
+            for (int p = 0; (p < indexEntry->property_count) && !defined; p++)
+            {
+                if ((indexEntry->properties[p].control_id == term->control) && (indexEntry->properties[p].property_id == term->property)) defined = true;
+            }
+
+            if (!defined) { entryTerm[entry] = termId; entryMatches[entry]++; }
+        }
+    }
+}
+
+// Resolve style values (raygui default style + properties)
+// NOTE: Same as raygui loading, DEFAULT base properties are propagated to all controls
+static void rgs_resolve_properties(const rgs_property *properties, int count, unsigned int *values)
+{
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+
+    memset(values, 0, RGS_MAX_PROPERTIES*sizeof(unsigned int));
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const rgs_property *props = (pass == 0)? rgsDefaultProperties : properties;
+        int propsTotal = (pass == 0)? (int)(sizeof(rgsDefaultProperties)/sizeof(rgs_property)) : count;
+
+        for (int i = 0; i < propsTotal; i++)
+        {
+            int control = props[i].control_id;
+            int property = props[i].property_id;
+
+            if ((control >= RGS_MAX_CONTROLS) || (property >= propsCount)) continue;
+
+            if ((control == 0) && (property < RGS_MAX_PROPS_BASE))
+            {
+                for (int c = 0; c < RGS_MAX_CONTROLS; c++) values[c*propsCount + property] = props[i].value;
+            }
+            else values[control*propsCount + property] = props[i].value;
+        }
+    }
+}
+
+// Compute style features vector from resolved values
+// NOTE: Colors converted to CIELAB (L: 0..255, a/b: +128) plus alpha, integer values clamped to [0..63] and scaled by 4
+static void rgs_compute_features(const unsigned int *values, const float *linearTable, unsigned char *features)
+{
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+    int offset = 0;
+
+    memset(features, 0, RGS_FEATURES_SIZE);
+
+    for (int i = 0; i < (RGS_MAX_CONTROLS*12 + 2); i++)
+    {
+        // Controls base colors and DEFAULT LINE_COLOR, BACKGROUND_COLOR
+        unsigned int color = (i < RGS_MAX_CONTROLS*12)? values[(i/12)*propsCount + (i%12)] : values[18 + (i - RGS_MAX_CONTROLS*12)];
+
+        // Most controls colors are DEFAULT colors (propagated), already converted
+        if ((i >= 12) && (i < RGS_MAX_CONTROLS*12) && (color == values[i%12]))
+        {
+            memcpy(features + offset, features + (i%12)*4, 4);
+            offset += 4;
+            continue;
+        }
+
+        float r = linearTable[(color >> 24) & 0xff];
+        float g = linearTable[(color >> 16) & 0xff];
+        float b = linearTable[(color >> 8) & 0xff];
+
+        // Linear RGB to XYZ (D65 reference white)
+        float xyz[3] = {
+            (0.4124f*r + 0.3576f*g + 0.1805f*b)/0.95047f,
+            (0.2126f*r + 0.7152f*g + 0.0722f*b),
+            (0.0193f*r + 0.1192f*g + 0.9505f*b)/1.08883f
+        };
+
+        for (int k = 0; k < 3; k++) xyz[k] = (xyz[k] > 0.008856f)? cbrtf(xyz[k]) : (7.787f*xyz[k] + 16.0f/116.0f);
+
+        float lab[3] = { (116.0f*xyz[1] - 16.0f)*2.55f, 500.0f*(xyz[0] - xyz[1]) + 128.0f, 200.0f*(xyz[1] - xyz[2]) + 128.0f };
+
+        for (int k = 0; k < 3; k++) features[offset++] = (unsigned char)((lab[k] < 0.0f)? 0 : (lab[k] > 255.0f)? 255 : (int)(lab[k] + 0.5f));
+        features[offset++] = (unsigned char)(color & 0xff);
+    }
+
+    for (int c = 0; c < RGS_MAX_CONTROLS; c++)
+    {
+        for (int p = 12; p < propsCount; p++)
+        {
+            // Skip RESERVED and DEFAULT colors, already considered
+            if ((p == 15) || ((c == 0) && ((p == 18) || (p == 19)))) continue;
+
+            int value = (int)values[c*propsCount + p];
+            features[offset++] = (unsigned char)(((value < 0)? 0 : (value > 63)? 63 : value)*4);
+        }
+    }
+}
+
+// Compute features distance (L1), early exit over limit
+// NOTE: Distance is accumulated in blocks of 64 bytes, returned distance is only exact if not over limit
+static unsigned int rgs_features_distance(const unsigned char *features1, const unsigned char *features2, unsigned int limit)
+{
+    unsigned int distance = 0;
+
+    for (int i = 0; i < RGS_FEATURES_SIZE; i += 64)
+    {
+#if defined(RGS_SIMD_SSE2)
+        __m128i sum = _mm_setzero_si128();
+
+        for (int k = 0; k < 64; k += 16)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)(features1 + i + k));
+            __m128i b = _mm_loadu_si128((const __m128i *)(features2 + i + k));
+            sum = _mm_add_epi64(sum, _mm_sad_epu8(a, b));
+        }
+
+        distance += (unsigned int)_mm_cvtsi128_si32(sum) + (unsigned int)_mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+#else
+        for (int k = 0; k < 64; k++) distance += (features1[i + k] > features2[i + k])? (features1[i + k] - features2[i + k]) : (features2[i + k] - features1[i + k]);
+#endif
+        if (distance > limit) break;
+    }
+
+    return distance;
+}
+
+// Compute index loaded entries features, returns features data
+// NOTE: Only successfully loaded entries considered, entries ids returned by features position
+static unsigned char *rgs_index_load_features(const rgs_index *index, int *entries, int *count)
+{
+    float linearTable[256] = { 0 };
+    rgs_init_linear_table(linearTable);
+
+    unsigned int *values = (unsigned int *)RGS_MALLOC(RGS_MAX_PROPERTIES*sizeof(unsigned int));
+    unsigned char *features = (unsigned char *)RGS_MALLOC(((index->entry_count > 0)? index->entry_count : 1)*RGS_FEATURES_SIZE);
+    int featuresCount = 0;
+
+    for (int i = 0; i < index->entry_count; i++)
+    {
+        if (index->entries[i].result != RGS_OK) continue;
+
+        rgs_resolve_properties(index->entries[i].properties, index->entries[i].property_count, values);
+        rgs_compute_features(values, linearTable, features + featuresCount*RGS_FEATURES_SIZE);
+
+        entries[featuresCount] = i;
+        featuresCount++;
+    }
+
+    RGS_FREE(values);
+
+    *count = featuresCount;
+    return features;
+}
+
+// Init sRGB to linear color components table (256 values)
+static void rgs_init_linear_table(float *table)
+{
+    for (int i = 0; i < 256; i++) table[i] = (i <= 10)? (i/255.0f)/12.92f : powf((i/255.0f + 0.055f)/1.055f, 2.4f);
+}
+
+// Find cluster root (union-find, path halving)
+static int rgs_cluster_find(int *parent, int id)
+{
+    while (parent[id] != id)
+    {
+        parent[id] = parent[parent[id]];
+        id = parent[id];
+    }
+
+    return id;
+}
+
+// Link styles clusters if styles distance is not over limit
+// NOTE: Distances to pivots are checked first (lower bounds), styles already linked are not compared again
+static void rgs_cluster_link(const unsigned char *features, const rgs_cluster_item *item1, const rgs_cluster_item *item2, int *parent, unsigned int limit)
+{
+    for (int p = 0; p < RGS_CLUSTER_PIVOTS; p++)
+    {
+        unsigned int distance1 = item1->distances[p];
+        unsigned int distance2 = item2->distances[p];
+
+        if (((distance1 > distance2)? (distance1 - distance2) : (distance2 - distance1)) > limit) return;
+    }
+
+    int root1 = rgs_cluster_find(parent, item1->id);
+    int root2 = rgs_cluster_find(parent, item2->id);
+
+    if ((root1 != root2) && (rgs_features_distance(features + item1->id*RGS_FEATURES_SIZE, features + item2->id*RGS_FEATURES_SIZE, limit) <= limit)) parent[root1] = root2;
+}
+
+// Compare cluster items by grid cell and id [qsort()]
+static int rgs_compare_cluster_items(const void *a, const void *b)
+{
+    const rgs_cluster_item *itemA = (const rgs_cluster_item *)a;
+    const rgs_cluster_item *itemB = (const rgs_cluster_item *)b;
+
+    if (itemA->cell != itemB->cell) return (itemA->cell < itemB->cell)? -1 : 1;
+    return itemA->id - itemB->id;
+}
+
+// Compare 64bit sorting keys [qsort()]
+static int rgs_compare_keys(const void *a, const void *b)
+{
+    unsigned long long keyA = *(const unsigned long long *)a;
+    unsigned long long keyB = *(const unsigned long long *)b;
+
+    return (keyA > keyB) - (keyA < keyB);
+}
+
+// Compare clusters by entries count [qsort()]
+// NOTE: Bigger clusters first, same size clusters sorted by representative entry
+static int rgs_compare_clusters(const void *a, const void *b)
+{
+    const rgs_index_cluster *clusterA = (const rgs_index_cluster *)a;
+    const rgs_index_cluster *clusterB = (const rgs_index_cluster *)b;
+
+    if (clusterA->entry_count != clusterB->entry_count) return clusterB->entry_count - clusterA->entry_count;
+    return clusterA->representative - clusterB->representative;
+}
+
+// Mark resolved values touched by layer property as pending
+// NOTE: DEFAULT base properties touch same property of all controls (propagation)
+static void rgs_layers_mark(rgs_layers *layers, int control, int property)
+{
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+
+    if ((control == 0) && (property < RGS_MAX_PROPS_BASE))
+    {
+        for (int c = 0; c < RGS_MAX_CONTROLS; c++) layers->dirty[(c*propsCount + property)/8] |= (1 << ((c*propsCount + property)%8));
+    }
+    else layers->dirty[(control*propsCount + property)/8] |= (1 << ((control*propsCount + property)%8));
+}
+
+// Get property value resolved from layers below provided count, raygui default value if not defined
+// NOTE: Upper layer defining the property or its DEFAULT base property wins, control property first on same layer
+static unsigned int rgs_layers_value(const rgs_layers *layers, int layerCount, int id)
+{
+    const int propsCount = RGS_MAX_PROPS_BASE + RGS_MAX_PROPS_EXTENDED;
+    int property = id%propsCount;
+    bool propagated = (id >= propsCount) && (property < RGS_MAX_PROPS_BASE);
+
+    for (int layer = layerCount - 1; layer >= 0; layer--)
+    {
+        if (layers->defined[layer][id/8] & (1 << (id%8))) return layers->values[layer][id];
+        if (propagated && (layers->defined[layer][property/8] & (1 << (property%8)))) return layers->values[layer][property];
+    }
+
+    return layers->default_values[id];
+}
+
+// Get color (RGBA) from HSV values, same as raylib ColorFromHSV()
+// NOTE: Hue in degrees [0..360], saturation and value in [0..1] range
+static unsigned int rgs_color_from_hsv(float hue, float saturation, float value)
+{
+    unsigned int color = 0xff;
+
+    for (int i = 0; i < 3; i++)
+    {
+        // Red: n = 5, Green: n = 3, Blue: n = 1
+        float k = fmodf((float)(5 - 2*i) + hue/60.0f, 6.0f);
+        float t = 4.0f - k;
+        k = (t < k)? t : k;
+        k = (k < 1.0f)? k : 1.0f;
+        k = (k > 0.0f)? k : 0.0f;
+
+        color |= (unsigned int)((value - value*saturation*k)*255.0f) << (24 - 8*i);
+    }
+
+    return color;
+}
+
+// Get color relative luminance (WCAG)
+static float rgs_color_luminance(unsigned int color, const float *linearTable)
+{
+    return 0.2126f*linearTable[(color >> 24) & 0xff] + 0.7152f*linearTable[(color >> 16) & 0xff] + 0.0722f*linearTable[(color >> 8) & 0xff];
+}
+
+// Get accent color reaching contrast target over base color
+// NOTE: Darker color over light base colors, lighter otherwise, value closest to base color reaching the target
+// is searched (luminance is monotonic with value), extreme value is used if target can not be reached
+static unsigned int rgs_params_contrast_color(float hue, float saturation, unsigned int baseColor, float contrast, const float *linearTable)
+{
+    float baseLuminance = rgs_color_luminance(baseColor, linearTable);
+    bool darker = (baseLuminance >= 0.1791f);   // Contrast to black reaches contrast to white
+    float low = 0.0f;
+    float high = 1.0f;
+
+    for (int i = 0; i < 16; i++)
+    {
+        float mid = (low + high)/2.0f;
+        float luminance = rgs_color_luminance(rgs_color_from_hsv(hue, saturation, mid), linearTable);
+        float ratio = darker? (baseLuminance + 0.05f)/(luminance + 0.05f) : (luminance + 0.05f)/(baseLuminance + 0.05f);
+
+        if (darker == (ratio >= contrast)) low = mid;
+        else high = mid;
+    }
+
+    return rgs_color_from_hsv(hue, saturation, darker? low : high);
+}
+
+#if !defined(RGS_NO_STDIO)
+// Read file data, NULL if not available
+static unsigned char *rgs_read_file(const char *fileName, int *size)
+{
+    unsigned char *data = NULL;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        fseek(file, 0, SEEK_END);
+        int fileSize = (int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (fileSize > 0)
+        {
+            data = (unsigned char *)RGS_MALLOC(fileSize);
+
+            if (fread(data, 1, fileSize, file) == (size_t)fileSize) *size = fileSize;
+            else
+            {
+                RGS_FREE(data);
+                data = NULL;
+            }
+        }
+
+        fclose(file);
+    }
+
+    return data;
+}
+
+// Compare entries by file name [qsort(), bsearch()]
+static int rgs_index_compare_names(const void *a, const void *b)
+{
+    return strcmp((*(const rgs_index_entry **)a)->file_name, (*(const rgs_index_entry **)b)->file_name);
+}
+#endif
+
+#endif  // RGS_IMPLEMENTATION
@@ -32,6 +32,10 @@
 *           NOTE: It requires to be decompressed with raylib DecompressData(),
 *           that requires compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
 *
+*       #define SUPPORT_BUILTIN_STYLE_TEMPLATES
+*           Embed style templates into executable, used when no style templates pack (.rgp) is available,
+*           templates pack could be placed next to executable (styles.rgp) or appended to it
+*
 *   VERSIONS HISTORY:
 *       5.0  (20-Sep-2023)  ADDED: Support macOS builds (x86_64 + arm64)
 *                           ADDED: New font atlas generation window
@@ -116,6 +120,9 @@
 #define TOOL_LOGO_COLOR         0x62bde3ff
 
 #define SUPPORT_COMPRESSED_FONT_ATLAS
+#define SUPPORT_BUILTIN_STYLE_TEMPLATES
+
+#define RAYGUI_FONT_ATLAS_DECODE            // Font atlas always decoded on loading, required for atlas export
 
 #include "raylib.h"
 
@@ -124,6 +131,28 @@
     #include <emscripten/emscripten.h>      // Emscripten library - LLVM to JavaScript compiler
 #endif
 
+#if defined(PLATFORM_DESKTOP)
+// Command-line trace spans, also used by raygui to trace style font decoding
+static void BeginTraceSpan(const char *name);               // Begin trace span (nested spans supported)
+static void EndTraceSpan(void);                             // End last trace span
+#define RAYGUI_TRACE_BEGIN(name)    BeginTraceSpan(name)
+#define RAYGUI_TRACE_END()          EndTraceSpan()
+#endif
+
+// NOTE: rgs library uses raylib allocators, so returned data can be freed with RL_FREE()
+#define RGS_MALLOC(sz)          RL_MALLOC(sz)
+#define RGS_CALLOC(n,sz)        RL_CALLOC(n,sz)
+#define RGS_REALLOC(ptr,sz)     RL_REALLOC(ptr,sz)
+#define RGS_FREE(ptr)           RL_FREE(ptr)
+#include "rgs.h"                            // Style core library API, required by raygui font atlas decoding (implementation below)
+
+// Block compressed font atlas decoding provided by rgs library, same encoder/decoder used by tool and raygui
+#define RAYGUI_DECODE_FONT_ATLAS(data, width, height, format)   rgs_font_atlas_decode(data, width, height, format)
+
+// Text style font loading through font atlas cache (if available)
+static Font LoadStyleFont(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load text style font
+#define RAYGUI_LOAD_FONT(fileName, fontSize, codepoints, codepointCount)    LoadStyleFont(fileName, fontSize, codepoints, codepointCount)
+
 #define RAYGUI_IMPLEMENTATION
 #include "external/raygui.h"                // Required for: IMGUI controls
 
@@ -148,7 +177,8 @@
 #include "gui_file_dialogs.h"               // GUI: File Dialogs
 
 // raygui embedded styles (used as templates)
-// NOTE: Included in the same order as selector
+// NOTE: Included in the same order as selector, only used if no templates pack is available
+#if defined(SUPPORT_BUILTIN_STYLE_TEMPLATES)
 #define MAX_GUI_STYLES_AVAILABLE   12       // NOTE: Included light style
 #include "styles/style_jungle.h"            // raygui style: jungle
 #include "styles/style_candy.h"             // raygui style: candy
@@ -161,14 +191,28 @@
 #include "styles/style_cherry.h"            // raygui style: cherry
 #include "styles/style_sunny.h"             // raygui style: sunny
 #include "styles/style_enefete.h"           // raygui style: enefete
+#else
+#define MAX_GUI_STYLES_AVAILABLE    1       // NOTE: Only light style available (raygui default)
+#endif
 
 #define RPNG_IMPLEMENTATION
 #include "external/rpng.h"                  // PNG chunks management
 
+#define RGS_IMPLEMENTATION
+#define RGS_NO_DEFLATE_IMPLEMENTATION       // sdefl/sinfl provided by raylib
+#include "rgs.h"                            // Style core library: style save/export, styles index (--index, --query)
+
+#if defined(PLATFORM_DESKTOP)
+    #define GUI_WINDOW_PARAMS_IMPLEMENTATION
+    #include "gui_window_params.h"          // GUI: Window style parameters (rgs parametric style)
+#endif
+
 // Standard C libraries
 #include <stdlib.h>                         // Required for: malloc(), free()
 #include <string.h>                         // Required for: strcmp(), memcpy()
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
+#include <time.h>                           // Required for: clock_gettime(), timespec_get() [GetTraceTime()]
+#include <math.h>                           // Required for: powf(), cbrtf(), sqrtf() [CompareImages()]
 
 #if defined(_MSC_VER) && ((defined(WIN32) || defined(_WIN32) || defined(__WIN32)) && !defined(__CYGWIN__))
     #include <direct.h>                     // Required for: _mkdir()
@@ -195,6 +239,30 @@ bool __stdcall FreeConsole(void);       // Close console from code (kernel32.lib
     #define LOG(...)
 #endif
 
+#define AUTOSAVE_JOURNAL_INTERVAL       5.0     // Autosave journal update interval (in seconds)
+
+#define MAX_STYLE_TABS                  6       // Maximum number of styles opened at once (tabs)
+#define MAX_UNDO_CHANGES               16       // Maximum number of controls properties changes to undo
+
+#define STYLE_PACK_FILE_NAME            "styles.rgp"    // Style templates pack default file name (next to executable)
+#define FONT_ATLAS_CACHE_DIR_NAME       "fontcache"     // Font atlas cache directory name (next to executable)
+#define STYLE_INDEX_FILE_NAME           "styles.rgsi"   // Styles index default file name (command-line)
+#define STYLE_DUPLICATES_THRESHOLD      0.5f            // Styles index near-duplicates default distance threshold (0..100)
+#define STYLE_NEAREST_COUNT             10              // Styles index nearest styles shown
+
+#define MAX_TRACE_EVENTS            16384       // Maximum number of trace events recorded (command-line), trace file only
+#define MAX_TRACE_DEPTH                16       // Maximum number of nested trace spans
+#define MAX_TRACE_SECTIONS             32       // Maximum number of trace sections accounted (replay summary)
+
+#define COMPARE_TILE_SIZE              32       // Images compare tile size, identical tiles are skipped (early exit), 32 max (row pixels mask)
+#define COMPARE_DELTA_E_THRESHOLD    2.3f       // Images compare color difference threshold (just noticeable difference)
+
+// TrueType font data is big-endian
+#define TTF_READ_U16(p)         ((unsigned int)(((p)[0] << 8) | (p)[1]))
+#define TTF_READ_U32(p)         (((unsigned int)(p)[0] << 24) | ((unsigned int)(p)[1] << 16) | ((unsigned int)(p)[2] << 8) | (unsigned int)(p)[3])
+#define TTF_WRITE_U16(p, v)     { (p)[0] = (unsigned char)((v) >> 8); (p)[1] = (unsigned char)(v); }
+#define TTF_WRITE_U32(p, v)     { (p)[0] = (unsigned char)((v) >> 24); (p)[1] = (unsigned char)((v) >> 16); (p)[2] = (unsigned char)((v) >> 8); (p)[3] = (unsigned char)(v); }
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -209,6 +277,122 @@ typedef enum {
     STYLE_TEXT              // Style text file (.rgs), only supported on command-line
 } GuiStyleFileType;
 
+// Style tab data
+// NOTE: Tab owns its properties, reference style and icons, font data is shared between tabs (font cache)
+typedef struct {
+    unsigned int style[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)];    // Style properties (used by raygui when tab is active)
+    unsigned int refStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)]; // Style properties reference (used to track changes)
+    char name[64];                  // Style name
+    char inFileName[512];           // Style input file name
+    char outFileName[512];          // Style output file name
+    char fontFileName[512];         // Style font file name (required for font atlas regeneration)
+    bool inputFileLoaded;           // Style input file loaded flag
+    bool outputFileCreated;         // Style output file created flag
+    bool saveChangesRequired;       // Style save changes required flag
+    bool fontLoaded;                // Style custom font loaded flag
+    int fontId;                     // Style font cache id, -1 if no cached font required (raylib default font)
+    int fontGenSize;                // Style font generation size
+    Rectangle fontWhiteRec;         // Style font white rectangle (to be exported)
+    Rectangle shapesRec;            // Shapes texture rectangle in use by style
+    int visualStyle;                // Style template selected
+    unsigned int icons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS];  // Style icons (used by raygui when tab is active)
+    int journalId;                  // Style journal id, required for untitled styles journal file name
+    char journalFileName[512];      // Style journal file name, set when journal is flushed on tab switching
+#if defined(PLATFORM_DESKTOP)
+    rgs_layers layers;              // Style layers stack (used when tab is active)
+#endif
+} GuiStyleTab;
+
+// Style templates pack entry
+// NOTE: Only pack index is loaded, entry data is loaded from file when required
+typedef struct {
+    char name[32];          // Style template name
+    int offset;             // Entry data offset (from pack start)
+    int compSize;           // Entry data compressed size
+    int dataSize;           // Entry data uncompressed size (style binary file size)
+} GuiStylePackEntry;
+
+// Trace event (complete event, Chrome trace format)
+// NOTE: File spans keep a copy of file name, other spans use static strings
+typedef struct {
+    const char *name;       // Span name (static string)
+    char *fileName;         // Span file name (only file spans)
+    double start;           // Span start time (microseconds)
+    double duration;        // Span duration (microseconds)
+} TraceEvent;
+
+// Trace section totals, spans grouped by name
+// NOTE: Accounted on every span end, not limited by trace events recorded
+typedef struct {
+    const char *name;       // Section name (span name, static string)
+    int count;              // Spans count
+    double total;           // Spans total duration (microseconds)
+    double max;             // Span max duration (microseconds)
+} TraceSection;
+
+// Input session mode
+typedef enum {
+    INPUT_SESSION_NONE = 0, // No input session, regular gui usage
+    INPUT_SESSION_RECORD,   // Input events recorded per frame, saved on closing
+    INPUT_SESSION_REPLAY    // Input events replayed per frame (hidden window), frame timings reported
+} InputSessionMode;
+
+// Input session dropped file
+// NOTE: Dropped files are not part of raylib automation events, they are recorded apart
+typedef struct {
+    int frame;              // Session frame file was dropped
+    char *filePath;         // File path dropped
+} InputSessionDrop;
+
+// Batch script command type
+typedef enum {
+    BATCH_SET = 0,          // set CONTROL.PROPERTY value
+    BATCH_HUE_ROTATE,       // hue-rotate degrees
+    BATCH_SWAP_LIGHT_DARK,  // swap-light-dark
+    BATCH_LOAD_FONT         // load-font fileName size
+} BatchCommandType;
+
+// Batch script command
+// NOTE: Script is parsed once, commands are applied to every input style
+typedef struct {
+    int type;               // Command type (BatchCommandType)
+    int controlId;          // Control id (set)
+    int propertyId;         // Property id (set)
+    int value;              // Property value (set) or font size (load-font)
+    float amount;           // Hue rotation degrees (hue-rotate)
+    char fileName[512];     // Font file name (load-font)
+} BatchCommand;
+
+// Images compare result
+typedef struct {
+    int tilesCount;         // Tiles compared
+    int tilesChanged;       // Tiles with any pixel changed
+    int pixelsCount;        // Pixels compared (largest image size)
+    int pixelsChanged;      // Pixels with color difference over threshold
+    float maxDelta;         // Max color difference (CIE76 Delta E)
+    float meanDelta;        // Mean color difference (all pixels)
+    float score;            // Similarity score: unchanged pixels percentage (100 - identical)
+} CompareResult;
+
+// Style font cache entry
+// NOTE: Fonts are shared between tabs by atlas texture, entry is unloaded when not referenced by any tab
+typedef struct {
+    Font faces[RAYGUI_MAX_FONT_FACES];      // Font faces, all faces share faces[0] atlas texture
+    int refCount;                           // Number of tabs referencing this font
+} GuiStyleFont;
+
+// Controls properties change (undo)
+// NOTE: One change covers all selected controls properties (bulk edit) or one DEFAULT property,
+// previous values and controls overrides stored (DEFAULT base properties are propagated to all controls)
+typedef struct {
+    unsigned int controls;                  // Controls changed (bit per control, DEFAULT included)
+    unsigned int properties;                // Base properties changed (bit per property)
+    unsigned int extended;                  // DEFAULT extended properties changed (bit per property)
+    unsigned int values[RAYGUI_MAX_CONTROLS*RAYGUI_MAX_PROPS_BASE];   // Previous properties values
+    unsigned int overrides[RAYGUI_MAX_PROPS_BASE];                    // Previous controls overriding DEFAULT (bit per control)
+    unsigned int extendedValues[RAYGUI_MAX_PROPS_EXTENDED];           // Previous DEFAULT extended properties values
+} GuiStyleChange;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -288,7 +472,7 @@ static const char *guiPropsDefaultExtendedText[8] = {
     "TEXT_LINE_SPACING",
     "TEXT_ALIGNMENT_VERTICAL",
     "TEXT_WRAP_MODE",
-    "EXT08"
+    "TEXT_FONT_FACE"
 };
 
 // Style template names
@@ -310,14 +494,19 @@ static const char *styleNames[12] = {
 // Default style backup to check changed properties
 static unsigned int defaultStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
 
-// Current active style template
-static unsigned int currentStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+// Current active style reference, points to active tab reference style (used to track changes)
+static unsigned int *currentStyle = NULL;
 
 static bool fontEmbeddedChecked = true;         // Select to embed font into style file
 static bool fontDataCompressedChecked = true;   // Export font data compressed (recs and glyphs)
+static bool propsCompactChecked = false;        // Export properties with compact encoding (requires updated raygui loader)
+static int fontAtlasBlockFormat = 0;            // Export font atlas format: 0-GRAY+ALPHA, 1-BC4 (DXT5), 2-EAC (ETC2)
+static bool fontSubsetChecked = false;          // Export text style with font subset (.ttf), only charset glyphs
 
 static Rectangle fontWhiteRec = { 0 };          // Font white rectangle, required to be updated from window font atlas
 
+extern Texture2D texShapes;                     // raylib shapes texture (required to restore it on style tab switching)
+
 static char currentStyleName[64] = { 0 };       // Current style name
 
 // NOTE: Max length depends on OS, in Windows MAX_PATH = 256
@@ -327,23 +516,187 @@ static char outFileName[512] = { 0 };           // Output file name (required fo
 static bool inputFileLoaded = false;            // Flag to detect an input file has been loaded (required for fast save)
 static bool outputFileCreated = false;          // Flag to detect if an output file has been created (required for fast save)
 
+// Style templates pack variables
+// NOTE: Pack could be a separate file or appended to executable, only index is kept in memory
+static char stylePackFileName[512] = { 0 };     // Style templates pack file name
+static int stylePackOffset = 0;                 // Style templates pack offset in file (appended to executable)
+static GuiStylePackEntry *stylePackEntries = NULL;  // Style templates pack index entries
+static int stylePackCount = 0;                  // Style templates pack entries count
+
+// Style tabs variables
+// NOTE: Active tab data is kept in the global editing variables, it is stored into the tab on tab switching
+static GuiStyleTab styleTabs[MAX_STYLE_TABS] = { 0 };   // Style tabs data
+static int styleTabsCount = 0;                          // Style tabs count
+static int styleTabActive = 0;                          // Style tab active (editing)
+static int styleTabsJournalCounter = 0;                 // Style tabs journal ids counter (untitled styles journals)
+
+// NOTE: One additional entry required while active tab font is replaced
+static GuiStyleFont styleFonts[MAX_STYLE_TABS + 1] = { 0 };   // Style fonts cache, shared by tabs
+
+// Default raygui icons, custom style icons are saved as changes over them
+static unsigned int defaultIcons[RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS] = { 0 };
+
+// Controls properties changes (undo), active style tab only
+static GuiStyleChange styleChanges[MAX_UNDO_CHANGES] = { 0 };
+static int styleChangesCount = 0;
+
+#if defined(PLATFORM_DESKTOP)
+// Autosave journal variables (crash recovery)
+// NOTE: Journal only appends property changes since last update, it is removed on style saving or closing
+static unsigned int journalStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 }; // Style state already journaled
+static char journalFileName[512] = { 0 };       // Journal file name, related to current style file
+static char journalFontFileName[512] = { 0 };   // Font file already journaled
+static int journalFontSize = 0;                 // Font size already journaled
+static double journalUpdateTime = 0.0;          // Last journal update time
+
+// Command-line trace variables
+// NOTE: Tracing is only enabled with --trace, spans are ignored otherwise
+static TraceEvent *traceEvents = NULL;          // Trace events recorded
+static int traceEventsCount = 0;                // Trace events count
+static int traceStack[MAX_TRACE_DEPTH] = { 0 }; // Trace open spans (event indices, -1 if not recorded)
+static const char *traceStackNames[MAX_TRACE_DEPTH] = { 0 };    // Trace open spans names
+static double traceStackStarts[MAX_TRACE_DEPTH] = { 0 };        // Trace open spans start time (microseconds)
+static int traceDepth = 0;                      // Trace open spans count
+static TraceSection traceSections[MAX_TRACE_SECTIONS] = { 0 };  // Trace sections totals
+static int traceSectionsCount = 0;              // Trace sections count
+static double traceStartTime = 0.0;             // Trace start time (microseconds)
+static int traceFilesCount = 0;                 // Trace files processed
+static long long traceBytesIn = 0;              // Trace bytes read from processed files
+static long long traceBytesOut = 0;             // Trace bytes written for processed files
+
+// Style layers variables
+// NOTE: Current style is edited as a layer over layers stack, edits are kept when layers change
+// NOTE: Layers stack is owned by active style tab, only pointer is set on tab switching
+static rgs_layers *styleLayers = NULL;          // Style layers stack (base, brand, user tweaks...)
+
+// Input session variables (record/replay)
+// NOTE: Input events are recorded as raylib automation events (.rae), dropped files and frames appended to same file
+static int inputSessionMode = INPUT_SESSION_NONE;   // Input session mode: record or replay
+static char inputSessionFileName[512] = { 0 };      // Input session file name (.rae)
+static char inputSessionTraceFileName[512] = { 0 }; // Input session replay trace file name (Chrome trace format)
+static float inputSessionMaxFrameTime = 0.0f;       // Input session replay frame time limit (95th percentile, ms), 0 for no limit
+static int inputSessionFrame = 0;                   // Input session current frame
+static int inputSessionFramesCount = 0;             // Input session frames count (replay)
+static AutomationEventList inputEvents = { 0 };     // Input session events (keys, mouse, window)
+static int inputEventsPlayed = 0;                   // Input session events already played (replay)
+static InputSessionDrop *inputDrops = NULL;         // Input session dropped files
+static int inputDropsCount = 0;                     // Input session dropped files count
+static float *inputFrameTimes = NULL;               // Input session replay frame times (ms)
+static double inputFrameStartTime = 0.0;            // Input session current frame start time (microseconds)
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 #if defined(PLATFORM_DESKTOP)
+static void InitFontAtlasCacheDir(void);                    // Init font atlas cache directory (next to executable or user cache)
+static bool IsDirectoryWritable(const char *dirPath);       // Check if directory is writable (creating it if required)
 static void ShowCommandLineInfo(void);                      // Show command line usage info
-static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static int ProcessCommandLine(int argc, char *argv[]);      // Process command line input, returns exit code
 #endif
 
 // Load/Save/Export data functions
 static unsigned char *SaveStyleToMemory(int *size);         // Save style to memory buffer
 static int SaveStyle(const char *fileName, int format);     // Save style binary file binary (.rgs)
+static void GetStyleCoreData(rgs_style *style, bool fontEmbedded); // Get current style data (properties, font, icons) into rgs style
+static void ImageFontAtlasCompress(Image *image, int format); // Compress font atlas alpha into GPU blocks (DXT5: BC4 alpha, ETC2_EAC: EAC alpha)
+static unsigned char *SubsetFontTTF(const unsigned char *fontData, int fontDataSize, const int *codepoints, int codepointCount, int *subsetSize); // Subset TrueType font, only codepoints glyphs kept
+static int GetGlyphIndexTTF(const unsigned char *cmapSubtable, const unsigned char *cmapEnd, int codepoint); // Get glyph index from cmap subtable (format 4 or 12)
+static int GetGlyphComponentsTTF(const unsigned char *glyph, int glyphSize, int *components, int maxComponents); // Get composite glyph components index offsets, returns count
 static void ExportStyleAsCode(const char *fileName, const char *styleName); // Export gui style as color palette code
 static Image GenImageStyleControlsTable(const char *styleName); // Draw controls table image
 
+// Style templates pack functions
+static int LoadStylePack(const char *fileName);             // Load style templates pack index, returns entries count
+static void UnloadStylePack(void);                          // Unload style templates pack index
+static bool LoadStylePackEntry(int index);                  // Load style templates pack entry (decompressed on loading)
+#if defined(PLATFORM_DESKTOP)
+static int SaveStylePack(const char *fileName, const char *dirPath); // Save style templates pack from directory style files (.rgs binary)
+#endif
+static int GetStyleTemplatesCount(void);                    // Get style templates count (Light style included)
+static const char *GetStyleTemplateName(int index);         // Get style template name
+
+#if defined(PLATFORM_DESKTOP)
+// Autosave journal functions
+static const char *GetJournalFileName(void);                // Get journal file name for current style file
+static void ResetJournal(void);                             // Reset journal, removing file and taking current style as base
+static void UpdateJournal(int fontSize);                    // Update journal, appending changes since last update
+static bool LoadJournal(const char *fileName, char *fontFileName, int *fontSize); // Load journal changes over current style
+
+// Command-line trace functions
+static void InitTrace(void);                                // Init trace, spans recorded from now on
+static void CloseTrace(const char *fileName);               // Close trace, saving trace events (Chrome trace format) and showing summary
+static void BeginTraceFileSpan(const char *fileName, int fileSize); // Begin trace file span, file processed accounted for summary
+static double GetTraceTime(void);                           // Get trace time (microseconds)
+static void WriteTraceString(FILE *traceFile, const char *text);    // Write JSON string to trace file (quoted and escaped)
+
+// Command-line compare functions
+static Image LoadCompareImage(const char *fileName);        // Load image to compare: .png image or .rgs style (controls table image generated)
+static CompareResult CompareImages(Image imageA, Image imageB, Image *heatmap); // Compare images (tiled, perceptual difference), heatmap generated if provided
+static unsigned int GetComparePixelsMask(const unsigned char *pixelsA, const unsigned char *pixelsB, int count); // Get RGBA pixels equality mask (bit per pixel, up to 32 pixels)
+
+// Command-line styles index functions
+static int UpdateStyleIndex(const char *fileName, const char *dirPath); // Update styles index file (.rgsi) with directory style files (.rgs/.png), returns styles loaded count
+static int QueryStyleIndex(const char *fileName, const char *query);    // Query styles index file (.rgsi) showing matching styles, returns matches count
+static int FindStyleDuplicates(const char *fileName, float threshold);  // Find styles index near-duplicate styles, showing clusters, returns clusters count
+static int FindNearestStyles(const char *fileName, const char *styleFileName); // Find styles index nearest styles to style file (.rgs/.png), returns styles count
+
+// Command-line batch script functions
+static BatchCommand *LoadBatchScript(const char *fileName, int *count);   // Load batch script commands, returns NULL if any line is not valid
+static bool ApplyBatchScript(const BatchCommand *commands, int count);     // Apply batch script commands to current style, returns false if any command failed
+static bool ParseBatchProperty(const char *text, int *controlId, int *propertyId); // Parse batch property: CONTROL.PROPERTY (names or ids)
+static bool ParseBatchValue(const char *text, int *value);  // Parse batch value: decimal, hexadecimal (0x) or color (#rrggbb[aa])
+static void TransformStyleColors(float hueRotation, bool swapLightDark); // Transform current style colors (hue rotation, lightness inversion)
+
+// Style layers functions
+static int PushStyleLayer(const char *fileName);            // Push style file as top layer (current style if no file provided), returns result code
+static int ReplaceStyleLayer(int layer, const char *fileName);  // Replace style layer with style file, returns result code
+static void PopStyleLayer(void);                            // Pop style layers top layer
+static int SaveStyleLayer(const char *fileName);            // Save current style changes over style layers as layer style file (.rgs), returns result code
+static void UpdateStyleLayers(const rgs_style *changes);    // Update current style with style layers resolved changes, current style changes applied over
+
+// Style parameters functions
+static void ApplyStyleParams(const rgs_params *params);     // Apply style parameters to current style, compiled into DEFAULT style properties
+static void GenStyleParamsRandom(rgs_params *params);       // Generate random style parameters (harmony rule and base colors)
+
+// Input session functions (record/replay)
+static bool ParseInputSession(int argc, char *argv[]);      // Parse input session command-line options, returns true if session requested
+static bool InitInputSession(void);                         // Init input session (window required), returns false if session could not be loaded
+static int CloseInputSession(void);                         // Close input session, saving recorded session or showing replay summary, returns exit code
+static bool BeginInputSessionFrame(void);                   // Begin input session frame, replaying frame events, returns false when replay is finished
+static void EndInputSessionFrame(void);                     // End input session frame, frame time registered
+static int CompareFrameTimes(const void *a, const void *b); // Compare frame times (qsort)
+#endif
+
+// Dropped files functions, input session dropped files considered
+static bool IsInputFileDropped(void);                       // Check if a file has been dropped (or replayed) this frame
+static FilePathList LoadInputDroppedFiles(void);            // Load dropped files paths, recorded on input session recording
+static void UnloadInputDroppedFiles(FilePathList files);    // Unload dropped files paths
+
+// Style tabs functions
+static void StoreStyleTab(GuiStyleTab *tab);                // Store active editing data into style tab, font moved to font cache
+static void LoadStyleTab(GuiStyleTab *tab);                 // Load style tab as active editing data, no data copied or reloaded
+static int CacheStyleFont(void);                            // Cache current gui font (shared by atlas texture), returns font cache id
+static void ReleaseStyleFont(int fontId);                   // Release font cache reference, font unloaded when not referenced
+static void UnloadStyleFont(int fontId);                    // Unload font cache entry
+static void DetachStyleFont(void);                          // Detach cached font from raygui (required before style reset)
+
+// Controls properties edition functions
+static void SetStyleBulk(unsigned int controls, unsigned int properties, int value, bool record); // Set controls properties value (bulk edit), previous values recorded as one change
+static void SetStyleDefault(int property, int value, bool record);  // Set DEFAULT property value, previous values (all controls for base properties) recorded as one change
+static void RecordStyleChange(unsigned int controls, unsigned int properties, unsigned int extended);    // Record controls properties previous values and overrides as one change
+static bool UndoStyleChange(void);                          // Undo last controls properties change, returns true if undone
+static unsigned int GetPropertyKindMask(int property);      // Get properties of same kind (colors, sizes, alignment) as bit mask
+static int UpdateListSelection(unsigned int *selection, int previous, int current); // Update list view multiple selection with clicked item, returns active item
+
 // Auxiliar functions
 static int StyleChangesCounter(unsigned int *refStyle);     // Count changed properties in current style (comparing to ref style)
+static int GetStyleControlsChanges(const unsigned int *refStyle, rgs_property *changes); // Get controls properties changed from ref style and not inherited from DEFAULT, returns changes count
+static int GetLowestBitIndex(unsigned int bits);            // Get lowest set bit index (bits must not be 0)
+static int StyleIconsChangesCounter(unsigned char *iconsMap); // Count changed icons in current icons set (comparing to default icons), id map filled if provided
+static int *LoadCodepointsByFrequency(const char *text, int *count); // Load text codepoints without duplicates, sorted by frequency
+static int CompareCodepointsValue(const void *a, const void *b);     // Compare codepoints entries by value (qsort)
+static int CompareCodepointsFrequency(const void *a, const void *b); // Compare codepoints entries by frequency (qsort)
 static Color GuiColorBox(Rectangle bounds, Color *colorPicker, Color color);    // Gui color box
 
 
@@ -355,7 +708,15 @@ int main(int argc, char *argv[])
 #if !defined(_DEBUG)
     SetTraceLogLevel(LOG_NONE);         // Disable raylib trace log messsages
 #endif
+    // Keep default icons as reference for style icons,
+    // they are restored by GuiLoadStyleDefault() after loading custom style icons
+    memcpy(defaultIcons, GuiGetIcons(), RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    GuiSaveIconsBase();
+
 #if defined(PLATFORM_DESKTOP)
+    // Init font atlas cache directory, required by command-line and gui usage modes
+    InitFontAtlasCacheDir();
+
     // Command-line usage mode
     //--------------------------------------------------------------------------------------
     if (argc > 1)
@@ -369,10 +730,9 @@ int main(int argc, char *argv[])
                 strcpy(inFileName, argv[1]);        // Read input filename to open with gui interface
             }
         }
-        else
+        else if (!ParseInputSession(argc, argv))    // Input session (record/replay) runs gui usage mode
         {
-            ProcessCommandLine(argc, argv);
-            return 0;
+            return ProcessCommandLine(argc, argv);
         }
     }
 #endif  // PLATFORM_DESKTOP
@@ -380,24 +740,45 @@ int main(int argc, char *argv[])
     // WARNING (Windows): If program is compiled as Window application (instead of console),
     // no console is available to show output info... solution is compiling a console application
     // and closing console (FreeConsole()) when changing to GUI interface
-    FreeConsole();
+    // NOTE: Console is kept on input sessions, replay summary is shown on closing
+    if (inputSessionMode == INPUT_SESSION_NONE) FreeConsole();
 #endif
 
     // GUI usage mode - Initialization
     //--------------------------------------------------------------------------------------
     const int screenWidth = 748;
-    const int screenHeight = 610;
+    const int screenHeight = 634;
 
+#if defined(PLATFORM_DESKTOP)
+    // Input session replay does not require a visible window (a display is still required)
+    if (inputSessionMode == INPUT_SESSION_REPLAY) SetConfigFlags(FLAG_WINDOW_HIDDEN);
+#endif
     InitWindow(screenWidth, screenHeight, TextFormat("%s v%s | %s", toolName, toolVersion, toolDescription));
     //EnableEventWaiting();
     SetExitKey(0);
 
+    // Load style templates pack index, placed next to executable or appended to it
+    // NOTE: Templates are only loaded from pack when selected, built-in templates used if no pack available
+    // NOTE: Executable is located from application directory, argv[0] could be a relative path or just a name (PATH)
+    if (LoadStylePack(TextFormat("%s%s", GetApplicationDirectory(), STYLE_PACK_FILE_NAME)) == 0)
+    {
+        char exeFileName[512] = { 0 };
+        strcpy(exeFileName, TextFormat("%s%s", GetApplicationDirectory(), GetFileName(argv[0])));
+#if defined(_WIN32)
+        if (!IsFileExtension(exeFileName, ".exe")) strcat(exeFileName, ".exe");
+#endif
+        LoadStylePack(exeFileName);
+    }
+
     // General pourpose variables
     Vector2 mousePos = { 0.0f, 0.0f };
     int frameCounter = 0;
 
     int changedPropCounter = 0;
     bool obtainProperty = false;
+
+    // Style properties on last redraw, any style change requires a full redraw
+    unsigned int redrawStyle[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
     bool selectingColor = false;
 
     // Load file if provided (drag & drop over executable)
@@ -415,9 +796,28 @@ int main(int argc, char *argv[])
         strcpy(currentStyleName, "Light");
     }
 
+    // Init style tabs, loaded style is moved to first tab
+    styleTabs[0].fontId = -1;
+    memcpy(styleTabs[0].style, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+    GuiSetStyleData(styleTabs[0].style);
+    memcpy(styleTabs[0].icons, GuiGetIcons(), RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+    GuiSetIcons(styleTabs[0].icons);
+    currentStyle = styleTabs[0].refStyle;
+    styleTabsCount = 1;
+
+    int styleTabSelected = 0;           // Style tab selected, tab switching happens on next frame
+    int styleTabCloseRequested = -1;    // Style tab requested to be closed (requires confirmation)
+    bool styleTabCloseConfirmed = false;
+    bool btnNewStyleTabPressed = false;
+    int styleTabsChangesCount = 0;      // Style tabs with changes not saved (active tab not included)
+
     // Default light style + current style backups (used to track changes)
-    memcpy(defaultStyle, guiStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
-    memcpy(currentStyle, guiStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+    memcpy(defaultStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+    memcpy(currentStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+#if defined(PLATFORM_DESKTOP)
+    styleLayers = &styleTabs[0].layers;
+    rgs_layers_init(styleLayers);
+#endif
 
     // Init color picker saved colors
     Color colorBoxValue[12] = { 0 };
@@ -436,15 +836,19 @@ int main(int argc, char *argv[])
 
     // GUI: Main Layout
     //-----------------------------------------------------------------------------------
-    Vector2 anchorMain = { 0, 0 };
-    Vector2 anchorWindow = { 353, 52 };
-    Vector2 anchorPropEditor = { 363, 92 };
-    Vector2 anchorFontOptions = { 363, 465 };
+    Vector2 anchorMain = { 0, 24 };
+    Vector2 anchorWindow = { 353, 76 };
+    Vector2 anchorPropEditor = { 363, 116 };
+    Vector2 anchorFontOptions = { 363, 489 };
 
     int currentSelectedControl = -1;
     int currentSelectedProperty = -1;
     int previousSelectedProperty = -1;
     int previousSelectedControl = -1;
+    unsigned int selectedControls = 0;      // Controls selected for bulk edit (bit per control), LCTRL + click
+    unsigned int selectedProperties = 0;    // Properties selected for bulk edit (bit per property), LCTRL + click
+    bool styleChangeActive = false;         // Controls properties change in progress (recorded as one change)
+    char selectedItemsText[RAYGUI_MAX_CONTROLS + RAYGUI_MAX_PROPS_BASE][64] = { 0 };  // List views selected items text
 
     bool propertyValueEditMode = false;
     int propertyValue = 0;
@@ -458,6 +862,7 @@ int main(int argc, char *argv[])
     int fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
     bool fontSampleEditMode = false;
     char fontSampleText[128] = "sample text";
+    int fontFaceActive = 0;             // Font face used to draw sample text
 
     bool screenSizeActive = false;
     bool controlsWindowActive = true;   // Show window: controls
@@ -476,6 +881,13 @@ int main(int argc, char *argv[])
     int fontDrawSizeValue = windowFontAtlasState.fontGenSizeValue;
     //-----------------------------------------------------------------------------------
 
+#if defined(PLATFORM_DESKTOP)
+    // GUI: Style Parameters Window
+    //-----------------------------------------------------------------------------------
+    GuiWindowParamsState windowParamsState = InitGuiWindowParams();
+    //-----------------------------------------------------------------------------------
+#endif
+
     // GUI: Help Window
     //-----------------------------------------------------------------------------------
     GuiWindowHelpState windowHelpState = InitGuiWindowHelp();
@@ -507,11 +919,24 @@ int main(int argc, char *argv[])
     bool windowExitActive = false;
     //-----------------------------------------------------------------------------------
 
+    // GUI: Recover Window (autosave journal)
+    //-----------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP)
+    // NOTE: Journal is disabled on input sessions, replay must not depend on previous session state
+    bool windowRecoverActive = (inputSessionMode == INPUT_SESSION_NONE) && FileExists(GetJournalFileName());   // Previous session journal available, ask for recovery
+    if (!windowRecoverActive) ResetJournal();
+#else
+    bool windowRecoverActive = false;
+#endif
+    //-----------------------------------------------------------------------------------
+
     // GUI: Custom file dialogs
     //-----------------------------------------------------------------------------------
     bool showLoadStyleDialog = false;
     bool showSaveStyleDialog = false;
     bool showExportStyleDialog = false;
+    bool showSaveLayerDialog = false;
+    bool showSaveParamsDialog = false;
 
     bool showLoadFontDialog = false;
     bool showLoadCharsetDialog = false;
@@ -540,26 +965,64 @@ int main(int argc, char *argv[])
     SetTextureFilter(screenTarget.texture, TEXTURE_FILTER_POINT);
 
     SetTargetFPS(60);       // Set our game desired framerate
+
+#if defined(PLATFORM_DESKTOP)
+    if ((inputSessionMode != INPUT_SESSION_NONE) && !InitInputSession()) closeWindow = true;
+    if (inputSessionMode == INPUT_SESSION_REPLAY) SetTargetFPS(0);  // Replay frames as fast as possible, frame times measured
+#endif
     //--------------------------------------------------------------------------------------
 
     // Main game loop
     while (!closeWindow)    // Detect window close button
     {
+#if defined(PLATFORM_DESKTOP)
+        // Input session frame, recorded input events played on replay
+        if (!BeginInputSessionFrame()) break;
+#endif
+        RAYGUI_TRACE_BEGIN("update");
+
         // WARNING: ASINCIFY requires this line,
         // it contains the call to emscripten_sleep() for PLATFORM_WEB
         if (WindowShouldClose()) windowExitActive = true;
 
         // Dropped files logic
         //----------------------------------------------------------------------------------
-        if (IsFileDropped())
+        if (IsInputFileDropped())
         {
-            FilePathList droppedFiles = LoadDroppedFiles();
+            FilePathList droppedFiles = LoadInputDroppedFiles();
+            GuiRedrawAll();     // Dropped file changes state without gui input, full redraw required
 
             // Supports loading .rgs style files (text or binary) and .png style palette images
+#if defined(PLATFORM_DESKTOP)
+            // Style file dropped as layer: LSHIFT pushes a new top layer, LALT replaces base layer
+            // NOTE: Only binary style files properties are considered, current style changes are kept over layers
+            if (IsFileExtension(droppedFiles.paths[0], ".rgs") && (IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_LEFT_ALT)))
+            {
+                if (IsKeyDown(KEY_LEFT_ALT) && (styleLayers->layer_count > 0)) ReplaceStyleLayer(0, droppedFiles.paths[0]);
+                else PushStyleLayer(droppedFiles.paths[0]);
+
+                fontDrawSizeValue = GuiGetStyle(DEFAULT, TEXT_SIZE);
+                fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
+            }
+            else if (IsFileExtension(droppedFiles.paths[0], ".rgsp"))
+            {
+                // Load style parameters, compiled into current style and shown for edition
+                int result = rgs_params_load(&windowParamsState.params, droppedFiles.paths[0]);
+                if (result != RGS_OK) LOG("WARNING: Style parameters file loaded with errors: %s\n", rgs_result_text(result));
+
+                windowParamsState.paramsChanged = true;
+                windowParamsState.windowActive = true;
+            }
+            else
+#endif
             if (IsFileExtension(droppedFiles.paths[0], ".rgs"))
             {
+                DetachStyleFont();                      // Detach font shared by style tabs (if cached)
                 GuiLoadStyleDefault();                  // Reset to base default style
                 GuiLoadStyle(droppedFiles.paths[0]);    // Load new style properties
+#if defined(PLATFORM_DESKTOP)
+                rgs_layers_init(styleLayers);           // Style layers reset, style not loaded as layer
+#endif
 
                 strcpy(inFileName, droppedFiles.paths[0]);
                 SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
@@ -575,7 +1038,7 @@ int main(int argc, char *argv[])
                 customFontLoaded = true;
 
                 // Reset style backup for changes
-                memcpy(currentStyle, guiStyle, RAYGUI_MAX_CONTROLS *(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED));
+                memcpy(currentStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
                 changedPropCounter = 0;
                 saveChangesRequired = false;
             }
@@ -584,6 +1047,13 @@ int main(int argc, char *argv[])
                 strcpy(inFontFileName, droppedFiles.paths[0]);
                 windowFontAtlasState.fontAtlasRegen = true;
             }
+            else if (IsFileExtension(droppedFiles.paths[0], ".rgi"))
+            {
+                // Load custom icons set over current icons, changed icons are embedded in style
+                // NOTE: Icons are restored to default icons on next style reset
+                GuiLoadIcons(droppedFiles.paths[0], false);
+                saveChangesRequired = true;
+            }
             else if (IsFileExtension(droppedFiles.paths[0], ".txt"))
             {
                 // Load codepoints to generate the font
@@ -592,67 +1062,36 @@ int main(int argc, char *argv[])
                 if (text != NULL)
                 {
                     int codepointsCount = 0;
-                    int *codepoints = LoadCodepoints(text, &codepointsCount);
+                    int *codepoints = LoadCodepointsByFrequency(text, &codepointsCount);
                     UnloadFileText(text);
 
                     if (codepointsCount > 0)
                     {
-                        // Clear current custom codepoints list
-                        if (windowFontAtlasState.externalCodepointList != NULL)
-                        {
-                            RL_FREE(windowFontAtlasState.externalCodepointList);
-                            windowFontAtlasState.externalCodepointListCount = 0;
-                            windowFontAtlasState.externalCodepointList = NULL;
-                        }
-
-                        // TODO: Make sure default charset is always available?
-                        //codepoints = RL_REALLOC(codepoints, (codepointsCount + 95)*sizeof(int));
-                        //for (int i = 0; i < 95; i++) codepoints[codepointsCount + i] = (int)charsetBasic[i];
-                        //codepointsCount += 95;
-
-                        // Create an array to store codepoints without duplicates
-                        int codepointsClearCount = codepointsCount;
-                        int *codepointsClear = (int *)RL_CALLOC(codepointsCount, sizeof(int));
-                        memcpy(codepointsClear, codepoints, codepointsCount*sizeof(int));
-
-                        // Remove duplicates
-                        for (int i = 0; i < codepointsClearCount; i++)
+                        // Replace current custom codepoints list, also as active charset if selected
+                        // NOTE: Codepoints sorted by frequency, most used glyphs first on atlas budget mode
+                        if (codepointList == windowFontAtlasState.externalCodepointList)
                         {
-                            for (int j = i + 1; j < codepointsClearCount; j++)
-                            {
-                                if (codepointsClear[i] == codepointsClear[j])
-                                {
-                                    for (int k = j; k < codepointsClearCount; k++) codepointsClear[k] = codepointsClear[k + 1];
-
-                                    j--;
-                                    codepointsClearCount--;
-                                }
-                            }
+                            codepointList = codepoints;
+                            codepointListCount = codepointsCount;
                         }
 
-                        // Allocate memory to fit duplicates-cleared codepoints
-                        windowFontAtlasState.externalCodepointList = (int *)RL_CALLOC(codepointsClearCount*sizeof(int), 1);
-
-                        // Copy codepoints into our custom charset
-                        for (int i = 0; (i < codepointsClearCount); i++) windowFontAtlasState.externalCodepointList[i] = codepointsClear[i];
-                        windowFontAtlasState.externalCodepointListCount = codepointsClearCount;
-
-                        RL_FREE(codepointsClear);
+                        RL_FREE(windowFontAtlasState.externalCodepointList);
+                        windowFontAtlasState.externalCodepointList = codepoints;
+                        windowFontAtlasState.externalCodepointListCount = codepointsCount;
 
-                        windowFontAtlasState.selectedCharset = 2;
                         windowFontAtlasState.selectedCharset = 2;
                         windowFontAtlasState.fontAtlasRegen = true;
                     }
-
-                    UnloadCodepoints(codepoints);
+                    else RL_FREE(codepoints);
                 }
             }
 
             for (int i = 0; i < 12; i++) colorBoxValue[i] = GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_NORMAL + i));
 
-            UnloadDroppedFiles(droppedFiles);   // Unload filepaths from memory
+            UnloadInputDroppedFiles(droppedFiles);  // Unload filepaths from memory
 
             currentSelectedControl = -1;    // Reset selected control
+            styleChangesCount = 0;          // Reset changes to undo
         }
         //----------------------------------------------------------------------------------
 
@@ -748,9 +1187,56 @@ int main(int argc, char *argv[])
             mainToolbarState.btnReloadStylePressed = true;
         }
 
+        // New style tab, default style is loaded in new tab
+        if (((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_T)) || btnNewStyleTabPressed) && (styleTabsCount < MAX_STYLE_TABS))
+        {
+            GuiStyleTab *tab = &styleTabs[styleTabsCount];
+
+            memset(tab, 0, sizeof(GuiStyleTab));
+            memcpy(tab->style, defaultStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+            memcpy(tab->refStyle, defaultStyle, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+            memcpy(tab->icons, defaultIcons, RAYGUI_ICON_MAX_ICONS*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+            strcpy(tab->name, styleNames[0]);
+            tab->fontId = -1;
+            tab->fontGenSize = (int)defaultStyle[TEXT_SIZE];
+            tab->journalId = ++styleTabsJournalCounter;
+#if defined(PLATFORM_DESKTOP)
+            rgs_layers_init(&tab->layers);
+#endif
+
+            // NOTE: Default raylib font character 95 is a white square
+            Rectangle whiteChar = GetFontDefault().recs[95];
+            tab->shapesRec = (Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 };
+
+            styleTabSelected = styleTabsCount;
+            styleTabsCount++;
+        }
+
+        // Select next style tab
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_TAB)) styleTabSelected = (styleTabActive + 1)%styleTabsCount;
+
         // Show dialog: load input file (.rgs)
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_O)) || mainToolbarState.btnLoadFilePressed) showLoadStyleDialog = true;
 
+#if defined(PLATFORM_DESKTOP)
+        // Style layers: push current style as layer (new layer edited over it) or pop top layer
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_L))
+        {
+            if (IsKeyDown(KEY_LEFT_SHIFT)) PopStyleLayer();
+            else PushStyleLayer(NULL);
+
+            fontDrawSizeValue = GuiGetStyle(DEFAULT, TEXT_SIZE);
+            fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
+        }
+
+        // Show dialog: save style layer file (.rgs), current style changes over style layers
+        if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_LEFT_SHIFT) && IsKeyPressed(KEY_S))
+        {
+            strcpy(outFileName, TextFormat("%s.layer.rgs", TextToLower(currentStyleName)));
+            showSaveLayerDialog = true;
+        }
+        else
+#endif
         // Show dialog: save style file (.rgs)
         if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_S)) || mainToolbarState.btnSaveFilePressed)
         {
@@ -771,6 +1257,7 @@ int main(int argc, char *argv[])
                 }
 
                 saveChangesRequired = false;
+                ResetJournal();         // Changes saved, journal not required any more
             }
             else
 #endif
@@ -802,6 +1289,10 @@ int main(int argc, char *argv[])
 
             // Show window: font atlas
             if (IsKeyPressed(KEY_F6) || mainToolbarState.btnFontAtlasPressed) windowFontAtlasState.windowActive = !windowFontAtlasState.windowActive;
+#if defined(PLATFORM_DESKTOP)
+            // Toggle window: style parameters
+            if (IsKeyPressed(KEY_F7)) windowParamsState.windowActive = !windowParamsState.windowActive;
+#endif
 
             // Show closing window on ESC
             if (IsKeyPressed(KEY_ESCAPE))
@@ -813,7 +1304,8 @@ int main(int argc, char *argv[])
                 else if (mainToolbarState.viewStyleTableActive) mainToolbarState.viewStyleTableActive = false;
                 else if (windowExportActive) windowExportActive = false;
             #if defined(PLATFORM_DESKTOP)
-                else if (changedPropCounter > 0) windowExitActive = !windowExitActive;
+                else if (windowParamsState.windowActive) windowParamsState.windowActive = false;
+                else if ((changedPropCounter > 0) || (styleTabsChangesCount > 0)) windowExitActive = !windowExitActive;
                 else closeWindow = true;
             #else
                 else if (showLoadStyleDialog) showLoadStyleDialog = false;
@@ -828,6 +1320,12 @@ int main(int argc, char *argv[])
             else if (IsKeyPressed(KEY_THREE)) mainToolbarState.propsStateActive = 2;
             else if (IsKeyPressed(KEY_FOUR)) mainToolbarState.propsStateActive = 3;
 
+            // Undo last controls properties change (single property or bulk edit)
+            if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z))
+            {
+                if (UndoStyleChange()) obtainProperty = true;
+            }
+
             // Reset to current style template
             if ((IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_R)) || mainToolbarState.btnReloadStylePressed)
             {
@@ -838,14 +1336,37 @@ int main(int argc, char *argv[])
             // Select visual style
             if (IsKeyPressed(KEY_LEFT)) mainToolbarState.visualStyleActive--;
             else if (IsKeyPressed(KEY_RIGHT)) mainToolbarState.visualStyleActive++;
-            if (mainToolbarState.visualStyleActive < 0) mainToolbarState.visualStyleActive = MAX_GUI_STYLES_AVAILABLE - 1;
-            else if (mainToolbarState.visualStyleActive >(MAX_GUI_STYLES_AVAILABLE - 1)) mainToolbarState.visualStyleActive = 0;
+            if (mainToolbarState.visualStyleActive < 0) mainToolbarState.visualStyleActive = GetStyleTemplatesCount() - 1;
+            else if (mainToolbarState.visualStyleActive > (GetStyleTemplatesCount() - 1)) mainToolbarState.visualStyleActive = 0;
         }
         //----------------------------------------------------------------------------------
 
         // Main toolbar logic
         //----------------------------------------------------------------------------------
         // File options logic
+#if defined(PLATFORM_DESKTOP)
+        if (windowParamsState.btnRandomPressed) mainToolbarState.btnRandomStylePressed = true;
+
+        if (mainToolbarState.btnRandomStylePressed)
+        {
+            // Generate random style parameters, compiled into style below,
+            // parameters are kept for further edition on style parameters window
+            GenStyleParamsRandom(&windowParamsState.params);
+            windowParamsState.paramsChanged = true;
+        }
+
+        if (windowParamsState.paramsChanged)
+        {
+            // Compile style parameters into DEFAULT style properties (propagated to all controls)
+            ApplyStyleParams(&windowParamsState.params);
+
+            fontDrawSizeValue = GuiGetStyle(DEFAULT, TEXT_SIZE);
+            fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
+
+            // Update color boxes palette
+            for (int i = 0; i < 12; i++) colorBoxValue[i] = GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_NORMAL + i));
+        }
+#else
         if (mainToolbarState.btnRandomStylePressed)
         {
             // Generate random style
@@ -905,6 +1426,91 @@ int main(int argc, char *argv[])
             // Update color boxes palette
             for (int i = 0; i < 12; i++) colorBoxValue[i] = GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_NORMAL + i));
         }
+#endif
+
+        // Style tabs logic
+        //----------------------------------------------------------------------------------
+        // Active tab closing requires switching to a neighbour tab first
+        if (styleTabCloseConfirmed && (styleTabCloseRequested == styleTabActive)) styleTabSelected = (styleTabActive > 0)? styleTabActive - 1 : 1;
+
+        // Switch style tab, active editing data is stored into its tab and selected tab is loaded
+        // NOTE: No style data copied and no font reloaded, style data pointer and cached font are just set
+        if (styleTabSelected != styleTabActive)
+        {
+            GuiStyleTab *tab = &styleTabs[styleTabActive];
+#if defined(PLATFORM_DESKTOP)
+            // Flush current tab changes before switching, journal is rebased over selected tab style
+            if (!windowRecoverActive) UpdateJournal(windowFontAtlasState.fontGenSizeValue);
+            strcpy(tab->journalFileName, journalFileName);
+#endif
+            tab->fontGenSize = windowFontAtlasState.fontGenSizeValue;
+            tab->fontWhiteRec = windowFontAtlasState.fontWhiteRec;
+            tab->visualStyle = mainToolbarState.visualStyleActive;
+            tab->saveChangesRequired = saveChangesRequired;
+            StoreStyleTab(tab);
+
+            styleTabActive = styleTabSelected;
+            tab = &styleTabs[styleTabActive];
+            LoadStyleTab(tab);
+
+            windowFontAtlasState.fontGenSizeValue = tab->fontGenSize;
+            prevFontGenSizeValue = tab->fontGenSize;    // Avoid font atlas regeneration (font atlas module)
+            windowFontAtlasState.fontWhiteRec = tab->fontWhiteRec;
+            mainToolbarState.visualStyleActive = tab->visualStyle;
+            mainToolbarState.prevVisualStyleActive = tab->visualStyle;
+            saveChangesRequired = tab->saveChangesRequired;
+
+            fontDrawSizeValue = GuiGetStyle(DEFAULT, TEXT_SIZE);
+            fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
+            for (int i = 0; i < 12; i++) colorBoxValue[i] = GetColor(GuiGetStyle(DEFAULT, BORDER_COLOR_NORMAL + i));
+
+            currentSelectedControl = -1;
+            currentSelectedProperty = -1;
+            styleChangesCount = 0;
+
+            if (outputFileCreated) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(outFileName)));
+            else if (inputFileLoaded) SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
+            else SetWindowTitle(TextFormat("%s v%s | %s", toolName, toolVersion, toolDescription));
+
+#if defined(PLATFORM_DESKTOP)
+            // Journal continues over selected tab style file, previous journal records are kept
+            strcpy(journalFileName, GetJournalFileName());
+            memcpy(journalStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+            strcpy(journalFontFileName, inFontFileName);
+            journalFontSize = tab->fontGenSize;
+#endif
+        }
+
+        // Close style tab (not active at this point), tab font reference is released
+        if (styleTabCloseConfirmed)
+        {
+            ReleaseStyleFont(styleTabs[styleTabCloseRequested].fontId);
+#if defined(PLATFORM_DESKTOP)
+            // Closed tab journal not required any more
+            if ((styleTabs[styleTabCloseRequested].journalFileName[0] != '\0') && FileExists(styleTabs[styleTabCloseRequested].journalFileName)) remove(styleTabs[styleTabCloseRequested].journalFileName);
+#endif
+
+            for (int i = styleTabCloseRequested; i < (styleTabsCount - 1); i++) styleTabs[i] = styleTabs[i + 1];
+            styleTabsCount--;
+
+            if (styleTabActive > styleTabCloseRequested) styleTabActive--;
+            styleTabSelected = styleTabActive;
+
+            // Active tab data could be moved, style data and icons must be set again
+            GuiSetStyleData(styleTabs[styleTabActive].style);
+            GuiSetIcons(styleTabs[styleTabActive].icons);
+#if defined(PLATFORM_DESKTOP)
+            styleLayers = &styleTabs[styleTabActive].layers;
+#endif
+            currentStyle = styleTabs[styleTabActive].refStyle;
+
+            styleTabCloseRequested = -1;
+            styleTabCloseConfirmed = false;
+        }
+
+        styleTabsChangesCount = 0;
+        for (int i = 0; i < styleTabsCount; i++) if ((i != styleTabActive) && styleTabs[i].saveChangesRequired) styleTabsChangesCount++;
+        //----------------------------------------------------------------------------------
 
         //styleFrameCounter++;
         //if ((styleFrameCounter%120) == 0) mainToolbarState.visualStyleActive++;
@@ -916,29 +1522,44 @@ int main(int argc, char *argv[])
             // When a new template style is selected, everything is reseted
             currentSelectedControl = -1;
             currentSelectedProperty = -1;
+            styleChangesCount = 0;
 
             // Reset to default internal style
-            // NOTE: Required to unload any previously loaded font texture
+            // NOTE: Required to unload any previously loaded font texture, font shared by style tabs is just detached
+            DetachStyleFont();
             GuiLoadStyleDefault();
+#if defined(PLATFORM_DESKTOP)
+            rgs_layers_init(styleLayers);   // Style layers reset, template is not a layers style
+#endif
 
-            switch (mainToolbarState.visualStyleActive)
-            {
-                case 1: GuiLoadStyleJungle(); break;
-                case 2: GuiLoadStyleCandy(); break;
-                case 3: GuiLoadStyleLavanda(); break;
-                case 4: GuiLoadStyleCyber(); break;
-                case 5: GuiLoadStyleTerminal(); break;
-                case 6: GuiLoadStyleAshes(); break;
-                case 7: GuiLoadStyleBluish(); break;
-                case 8: GuiLoadStyleDark(); break;
-                case 9: GuiLoadStyleCherry(); break;
-                case 10: GuiLoadStyleSunny(); break;
-                case 11: GuiLoadStyleEnefete(); break;
-                default: break;
+            // Load selected template, from templates pack if available (entry loaded on selection)
+            if (stylePackCount > 0)
+            {
+                if (mainToolbarState.visualStyleActive > 0) LoadStylePackEntry(mainToolbarState.visualStyleActive - 1);
+            }
+#if defined(SUPPORT_BUILTIN_STYLE_TEMPLATES)
+            else
+            {
+                switch (mainToolbarState.visualStyleActive)
+                {
+                    case 1: GuiLoadStyleJungle(); break;
+                    case 2: GuiLoadStyleCandy(); break;
+                    case 3: GuiLoadStyleLavanda(); break;
+                    case 4: GuiLoadStyleCyber(); break;
+                    case 5: GuiLoadStyleTerminal(); break;
+                    case 6: GuiLoadStyleAshes(); break;
+                    case 7: GuiLoadStyleBluish(); break;
+                    case 8: GuiLoadStyleDark(); break;
+                    case 9: GuiLoadStyleCherry(); break;
+                    case 10: GuiLoadStyleSunny(); break;
+                    case 11: GuiLoadStyleEnefete(); break;
+                    default: break;
+                }
             }
+#endif
 
             // Current style backup (used to track changes)
-            memcpy(currentStyle, guiStyle, RAYGUI_MAX_CONTROLS *(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+            memcpy(currentStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS *(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
 
             customFont = GuiGetFont();
             customFontLoaded = true;
@@ -956,7 +1577,7 @@ int main(int argc, char *argv[])
             windowFontAtlasState.fontWhiteRec = texShapesRec;
 
             memset(currentStyleName, 0, 64);
-            strcpy(currentStyleName, styleNames[mainToolbarState.visualStyleActive]);
+            strcpy(currentStyleName, GetStyleTemplateName(mainToolbarState.visualStyleActive));
         }
 
         fontWhiteRec = windowFontAtlasState.fontWhiteRec;   // Register fontWhiteRec from fontAtlas window
@@ -976,6 +1597,11 @@ int main(int argc, char *argv[])
         changedPropCounter = StyleChangesCounter(currentStyle);
         if (changedPropCounter > 0) saveChangesRequired = true;
 
+#if defined(PLATFORM_DESKTOP)
+        // Autosave journal update, only changes are appended (every few seconds)
+        if (!windowRecoverActive && ((GetTime() - journalUpdateTime) > AUTOSAVE_JOURNAL_INTERVAL)) UpdateJournal(windowFontAtlasState.fontGenSizeValue);
+#endif
+
         // NOTE: Font reloading inside windowFontAtlas
 
         GuiSetStyle(DEFAULT, TEXT_SIZE, fontDrawSizeValue);
@@ -984,7 +1610,13 @@ int main(int argc, char *argv[])
 
         // Controls selection on list view logic
         //----------------------------------------------------------------------------------
-        if ((previousSelectedControl != currentSelectedControl)) currentSelectedProperty = -1;
+        // NOTE: Bulk edit selections (LCTRL + click) are managed on list views drawing
+        if ((previousSelectedControl != currentSelectedControl))
+        {
+            currentSelectedProperty = -1;
+            selectedControls = 0;
+        }
+        if (previousSelectedProperty != currentSelectedProperty) selectedProperties = 0;
 
         if ((currentSelectedControl >= 0) && (currentSelectedProperty >= 0))
         {
@@ -1013,18 +1645,41 @@ int main(int argc, char *argv[])
             if (currentSelectedControl == DEFAULT)
             {
                 // Update special default extended properties: BACKGROUND_COLOR and LINE_COLOR
-                if (currentSelectedProperty <= TEXT_COLOR_DISABLED) GuiSetStyle(currentSelectedControl, currentSelectedProperty, ColorToInt(colorPickerValue));
-                else if (currentSelectedProperty == 13) GuiSetStyle(currentSelectedControl, LINE_COLOR, ColorToInt(colorPickerValue));
-                else if (currentSelectedProperty == 12) GuiSetStyle(currentSelectedControl, BACKGROUND_COLOR, ColorToInt(colorPickerValue));
+                int property = -1;
+                if (currentSelectedProperty <= TEXT_COLOR_DISABLED) property = currentSelectedProperty;
+                else if (currentSelectedProperty == 13) property = LINE_COLOR;
+                else if (currentSelectedProperty == 12) property = BACKGROUND_COLOR;
+
+                // NOTE: Only set on value change, DEFAULT base value set discards controls overrides
+                if ((property >= 0) && (ColorToInt(colorPickerValue) != GuiGetStyle(DEFAULT, property)))
+                {
+                    SetStyleDefault(property, ColorToInt(colorPickerValue), !styleChangeActive);
+                    styleChangeActive = true;
+                }
+                else if (!IsMouseButtonDown(MOUSE_BUTTON_LEFT)) styleChangeActive = false;
             }
             else
             {
-                // Update control property
-                if (currentSelectedProperty <= TEXT_COLOR_DISABLED) GuiSetStyle(currentSelectedControl, currentSelectedProperty, ColorToInt(colorPickerValue));
-                else if ((currentSelectedProperty == BORDER_WIDTH) || (currentSelectedProperty == TEXT_PADDING)) GuiSetStyle(currentSelectedControl, currentSelectedProperty, propertyValue);
-                else if (currentSelectedProperty == TEXT_ALIGNMENT) GuiSetStyle(currentSelectedControl, currentSelectedProperty, textAlignmentActive);
+                // Update control property, only set on value change (control becomes overriding DEFAULT)
+                int value = GuiGetStyle(currentSelectedControl, currentSelectedProperty);
+                if (currentSelectedProperty <= TEXT_COLOR_DISABLED) value = ColorToInt(colorPickerValue);
+                else if ((currentSelectedProperty == BORDER_WIDTH) || (currentSelectedProperty == TEXT_PADDING)) value = propertyValue;
+                else if (currentSelectedProperty == TEXT_ALIGNMENT) value = textAlignmentActive;
+
+                if (value != GuiGetStyle(currentSelectedControl, currentSelectedProperty))
+                {
+                    // Value set to all selected controls properties of same kind (bulk edit) at once,
+                    // continuous edition (i.e. color picker dragging) is recorded as one change
+                    unsigned int controls = selectedControls | (1u << currentSelectedControl);
+                    unsigned int properties = (selectedProperties | (1u << currentSelectedProperty)) & GetPropertyKindMask(currentSelectedProperty);
+
+                    SetStyleBulk(controls, properties, value, !styleChangeActive);
+                    styleChangeActive = true;
+                }
+                else if (!IsMouseButtonDown(MOUSE_BUTTON_LEFT)) styleChangeActive = false;
             }
         }
+        else styleChangeActive = false;
 
         previousSelectedProperty = currentSelectedProperty;
         previousSelectedControl = currentSelectedControl;
@@ -1118,16 +1773,47 @@ int main(int argc, char *argv[])
             mainToolbarState.viewStyleTableActive ||
             mainToolbarState.propsStateEditMode ||
             windowExitActive ||
+            windowRecoverActive ||
+            (styleTabCloseRequested >= 0) ||
             windowExportActive ||
             showLoadStyleDialog ||
             showSaveStyleDialog ||
+            showSaveLayerDialog ||
+            showSaveParamsDialog ||
             showExportStyleDialog) GuiLock();
+
+        // NOTE: Style parameters window does not lock main screen (style preview required while editing),
+        // main screen controls are only locked while mouse is over the window
+        bool mainScreenLocked = GuiIsLocked();
+#if defined(PLATFORM_DESKTOP)
+        if (windowParamsState.windowActive && (windowParamsState.dragMode || CheckCollisionPointRec(GetMousePosition(), windowParamsState.windowBounds))) GuiLock();
+#endif
         //----------------------------------------------------------------------------------
 
         // Draw
         //----------------------------------------------------------------------------------
-        // Render all screen to texture (for scaling)
+        // Render screen to texture (for scaling), only damaged region is redrawn,
+        // screen target keeps previous frame content, so no redraw required if nothing changed
+        // NOTE: Windows using their own scissor mode are always fully redrawn
+        if (windowHelpState.windowActive || windowFontAtlasState.windowActive) GuiRedrawAll();
+
+        // Style changes (edited properties, loaded styles) affect all controls, full redraw required
+        if (memcmp(redrawStyle, GuiGetStyleData(), sizeof(redrawStyle)) != 0)
+        {
+            memcpy(redrawStyle, GuiGetStyleData(), sizeof(redrawStyle));
+            GuiRedrawAll();
+        }
+#if defined(PLATFORM_DESKTOP)
+        if (windowParamsState.windowActive) GuiRedrawAll();
+#endif
+
+        RAYGUI_TRACE_END();
+        RAYGUI_TRACE_BEGIN("gui");
+
+        Rectangle redrawRec = GuiBeginRedraw();
+
         BeginTextureMode(screenTarget);
+            BeginScissorMode((int)redrawRec.x, (int)redrawRec.y, (int)redrawRec.width, (int)redrawRec.height);
             ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
 
             // GUI: Main screen controls
@@ -1138,11 +1824,37 @@ int main(int argc, char *argv[])
             // In case a custom gui state is selected for review, we reset the selected property
             if (mainToolbarState.propsStateActive != STATE_NORMAL) currentSelectedProperty = -1;
 
-            // List views
-            GuiListView((Rectangle){ anchorMain.x + 10, anchorMain.y + 52, 148, 520 }, TextJoin(guiControlText, RAYGUI_MAX_CONTROLS, ";"), NULL, &currentSelectedControl);
-            if (currentSelectedControl != DEFAULT) GuiListViewEx((Rectangle){ anchorMain.x + 163, anchorMain.y + 52, 180, 520 }, guiPropsText, RAYGUI_MAX_PROPS_BASE - 1, NULL, &currentSelectedProperty, NULL);
+            // List views, items selected for bulk edit are marked
+            const char *controlsListText[RAYGUI_MAX_CONTROLS] = { 0 };
+            const char *propsListText[RAYGUI_MAX_PROPS_BASE] = { 0 };
+            for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++) controlsListText[i] = (selectedControls & (1u << i))? strcpy(selectedItemsText[i], TextFormat("#112#%s", guiControlText[i])) : guiControlText[i];
+            for (int i = 0; i < RAYGUI_MAX_PROPS_BASE; i++) propsListText[i] = (selectedProperties & (1u << i))? strcpy(selectedItemsText[RAYGUI_MAX_CONTROLS + i], TextFormat("#112#%s", guiPropsText[i])) : guiPropsText[i];
+
+            int listSelectedControl = currentSelectedControl;
+            int listSelectedProperty = currentSelectedProperty;
+
+            GuiListView((Rectangle){ anchorMain.x + 10, anchorMain.y + 52, 148, 520 }, TextJoin(controlsListText, RAYGUI_MAX_CONTROLS, ";"), NULL, &currentSelectedControl);
+            if (currentSelectedControl != DEFAULT) GuiListViewEx((Rectangle){ anchorMain.x + 163, anchorMain.y + 52, 180, 520 }, propsListText, RAYGUI_MAX_PROPS_BASE - 1, NULL, &currentSelectedProperty, NULL);
             else GuiListViewEx((Rectangle){ anchorMain.x + 163, anchorMain.y + 52, 180, 520 }, guiPropsDefaultText, 14, NULL, &currentSelectedProperty, NULL);
 
+            // Bulk edit selection: LCTRL + click adds/removes list item, DEFAULT control not supported
+            // NOTE: Selection changes are not considered a new selection, active item value obtained
+            if (IsKeyDown(KEY_LEFT_CONTROL))
+            {
+                if ((currentSelectedControl != listSelectedControl) && (listSelectedControl > DEFAULT) && (currentSelectedControl != DEFAULT))
+                {
+                    currentSelectedControl = UpdateListSelection(&selectedControls, listSelectedControl, currentSelectedControl);
+                    previousSelectedControl = currentSelectedControl;
+                    obtainProperty = true;
+                }
+                else if ((currentSelectedProperty != listSelectedProperty) && (listSelectedProperty >= 0) && (currentSelectedControl > DEFAULT))
+                {
+                    currentSelectedProperty = UpdateListSelection(&selectedProperties, listSelectedProperty, currentSelectedProperty);
+                    previousSelectedProperty = currentSelectedProperty;
+                    obtainProperty = true;
+                }
+            }
+
             // Controls window
             if (controlsWindowActive)
             {
@@ -1159,7 +1871,9 @@ int main(int argc, char *argv[])
                 if (mainToolbarState.propsStateActive != STATE_DISABLED) GuiEnable();
 
                 GuiLine((Rectangle){ anchorPropEditor.x + 0, anchorPropEditor.y + 35, 365, 15 }, NULL);
+                RAYGUI_TRACE_BEGIN("color picker");
                 GuiColorPicker((Rectangle){ anchorPropEditor.x + 10, anchorPropEditor.y + 55, 240, 240 }, NULL, &colorPickerValue);
+                RAYGUI_TRACE_END();
 
                 GuiGroupBox((Rectangle){ anchorPropEditor.x + 295, anchorPropEditor.y + 60, 60, 55 }, "RGBA");
                 GuiLabel((Rectangle){ anchorPropEditor.x + 300, anchorPropEditor.y + 65, 80, 20 }, TextFormat("R:  %03i", colorPickerValue.r));
@@ -1196,7 +1910,21 @@ int main(int argc, char *argv[])
                 if (GuiSpinner((Rectangle){ anchorFontOptions.x + 110, anchorFontOptions.y + 16, 92, 24 }, "Size: ", &fontDrawSizeValue, 8, 32, genFontSizeEditMode)) genFontSizeEditMode = !genFontSizeEditMode;
                 if (GuiSpinner((Rectangle){ anchorFontOptions.x + 262, anchorFontOptions.y + 16, 92, 24 }, "Spacing: ", &fontSpacingValue, -4, 8, fontSpacingEditMode)) fontSpacingEditMode = !fontSpacingEditMode;
 
-                if (GuiTextBox((Rectangle){ anchorFontOptions.x + 10, anchorFontOptions.y + 52, 345, 28 }, fontSampleText, 128, fontSampleEditMode)) fontSampleEditMode = !fontSampleEditMode;
+                // Sample text drawn with selected font face (at face size)
+                // NOTE: Font faces share the same font atlas, they are selected by TEXT_FONT_FACE property
+                int fontFaceCount = 1;
+                for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++) if (GuiGetFontFace(i).texture.id > 0) fontFaceCount++;
+                if (fontFaceActive >= fontFaceCount) fontFaceActive = 0;
+
+                GuiSetStyle(DEFAULT, TEXT_FONT_FACE, fontFaceActive);
+                if (fontFaceActive > 0) GuiSetStyle(DEFAULT, TEXT_SIZE, GuiGetFontFace(fontFaceActive).baseSize);
+                if (GuiTextBox((Rectangle){ anchorFontOptions.x + 10, anchorFontOptions.y + 52, 285, 28 }, fontSampleText, 128, fontSampleEditMode)) fontSampleEditMode = !fontSampleEditMode;
+                GuiSetStyle(DEFAULT, TEXT_SIZE, fontDrawSizeValue);
+                GuiSetStyle(DEFAULT, TEXT_FONT_FACE, 0);
+
+                if (fontFaceCount == 1) GuiDisable();
+                GuiComboBox((Rectangle){ anchorFontOptions.x + 299, anchorFontOptions.y + 52, 56, 28 }, TextSubtext("0;1;2;3;4;5;6;7", 0, fontFaceCount*2 - 1), &fontFaceActive);
+                if (mainToolbarState.propsStateActive != STATE_DISABLED) GuiEnable();
             }
             else
             {
@@ -1210,21 +1938,45 @@ int main(int argc, char *argv[])
             // GUI: Status bar
             //----------------------------------------------------------------------------------------
             GuiStatusBar((Rectangle){ 0, GetScreenHeight() - 24, 60, 24 }, "Name:"); //(changedPropCounter > 0)? currentStyleName : styleNames[mainToolbarState.visualStyleActive]));
+#if defined(PLATFORM_DESKTOP)
+            if (styleLayers->layer_count > 0) GuiStatusBar((Rectangle){159, GetScreenHeight() - 24, 190, 24 }, TextFormat("LAYERS: %i | CHANGED: %i", styleLayers->layer_count, changedPropCounter));
+            else
+#endif
             GuiStatusBar((Rectangle){159, GetScreenHeight() - 24, 190, 24 }, TextFormat("CHANGED PROPERTIES: %i", changedPropCounter));
 
             if (GuiTextBox((Rectangle){ 60 - 1, GetScreenHeight() - 24, 101, 24 }, currentStyleName, 128, styleNameEditMode)) styleNameEditMode = !styleNameEditMode;
 
-            GuiStatusBar((Rectangle){ 348, GetScreenHeight() - 24, 400, 24 }, TextFormat("FONT: %i codepoints | %ix%i pixels", GuiGetFont().glyphCount, GuiGetFont().texture.width, GuiGetFont().texture.height));
+            GuiStatusBar((Rectangle){ 348, GetScreenHeight() - 24, 400, 24 }, TextFormat("FONT: %i codepoints | %ix%i pixels | ICONS: %i custom", GuiGetFont().glyphCount, GuiGetFont().texture.width, GuiGetFont().texture.height, StyleIconsChangesCounter(NULL)));
+            //----------------------------------------------------------------------------------------
+
+            // GUI: Style tabs
+            //----------------------------------------------------------------------------------------
+            GuiSetState(STATE_NORMAL);
+
+            const char *styleTabNames[MAX_STYLE_TABS] = { 0 };
+            for (int i = 0; i < styleTabsCount; i++) styleTabNames[i] = (i == styleTabActive)? currentStyleName : styleTabs[i].name;
+
+            int styleTabClose = GuiTabBar((Rectangle){ 0, 44, (float)screenWidth, 24 }, styleTabNames, styleTabsCount, &styleTabSelected);
+            if ((styleTabClose >= 0) && (styleTabsCount > 1)) styleTabCloseRequested = styleTabClose;
+
+            // NOTE: New tab button only drawn if there is space available after tabs
+            btnNewStyleTabPressed = false;
+            if ((styleTabsCount < MAX_STYLE_TABS) && ((styleTabsCount*(160 + 4) + 24) < screenWidth))
+            {
+                btnNewStyleTabPressed = GuiButton((Rectangle){ (float)styleTabsCount*(160 + 4), 44, 24, 24 }, "#8#");
+            }
             //----------------------------------------------------------------------------------------
 
             // NOTE: If some overlap window is open and main window is locked, we draw a background rectangle
-            if (GuiIsLocked()) DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
+            if (mainScreenLocked) DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Fade(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)), 0.85f));
 
             // WARNING: Before drawing the windows, we unlock them
             GuiUnlock();
 
             // GUI: Main toolbar panel
             //----------------------------------------------------------------------------------
+            mainToolbarState.visualStyleName = GetStyleTemplateName(mainToolbarState.visualStyleActive);
+            mainToolbarState.visualStylesCount = GetStyleTemplatesCount();
             GuiMainToolbar(&mainToolbarState);
             //----------------------------------------------------------------------------------
 
@@ -1233,13 +1985,28 @@ int main(int argc, char *argv[])
 
             // GUI: Font Atlas Window
             //----------------------------------------------------------------------------------------
+            RAYGUI_TRACE_BEGIN("font atlas");
             GuiWindowFontAtlas(&windowFontAtlasState);
+            RAYGUI_TRACE_END();
 
             if (windowFontAtlasState.btnLoadFontPressed) showLoadFontDialog = true;
             if (windowFontAtlasState.btnLoadCharsetPressed) showLoadCharsetDialog = true;
             if (windowFontAtlasState.btnSaveFontAtlasPressed) showSaveFontAtlasDialog = true;
             //----------------------------------------------------------------------------------------
 
+#if defined(PLATFORM_DESKTOP)
+            // GUI: Style Parameters Window
+            //----------------------------------------------------------------------------------------
+            GuiWindowParams(&windowParamsState);
+
+            if (windowParamsState.btnSavePressed)
+            {
+                strcpy(outFileName, TextFormat("%s.rgsp", TextToLower(currentStyleName)));
+                showSaveParamsDialog = true;
+            }
+            //----------------------------------------------------------------------------------------
+#endif
+
             // GUI: Show style table image (if active and reloaded)
             //----------------------------------------------------------------------------------------
             if (mainToolbarState.viewStyleTableActive && (mainToolbarState.prevViewStyleTableActive == mainToolbarState.viewStyleTableActive))
@@ -1256,6 +2023,8 @@ int main(int argc, char *argv[])
                 }
                 if (styleTablePanningMode)
                 {
+                    GuiRedrawAll();     // Style table moved, full redraw required
+
                     if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) styleTablePositionX = prevStyleTablePositionX - (GetMouseX() - styleTableOffsetX);
 
                     if (styleTablePositionX < 0) styleTablePositionX = 0;
@@ -1297,7 +2066,7 @@ int main(int argc, char *argv[])
             //----------------------------------------------------------------------------------------
             if (windowExportActive)
             {
-                Rectangle messageBox = { (float)screenWidth/2 - 248/2, (float)screenHeight/2 - 150, 248, 220 };
+                Rectangle messageBox = { (float)screenWidth/2 - 248/2, (float)screenHeight/2 - 150, 248, 300 };
                 int result = GuiMessageBox(messageBox, "#7#Export Style File", " ", "#7# Export Style");
 
                 GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 24 + 12, 106, 24 }, "Style Name:");
@@ -1314,6 +2083,16 @@ int main(int argc, char *argv[])
                 if (exportFormatActive != 2) GuiDisable();
                 GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 72 + 32 + 24 + 24, 16, 16 }, "Style embedded as rGSf chunk", &styleChunkChecked);
                 GuiEnable();
+                if (exportFormatActive == 1) GuiDisable();
+                GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 72 + 32 + 24 + 48, 16, 16 }, "Properties compact encoding", &propsCompactChecked);
+                GuiEnable();
+                if (!fontEmbeddedChecked) GuiDisable();
+                GuiLabel((Rectangle){ messageBox.x + 12, messageBox.y + 72 + 32 + 24 + 72 + 4, 106, 24 }, "Atlas Format:");
+                GuiComboBox((Rectangle){ messageBox.x + 12 + 92, messageBox.y + 72 + 32 + 24 + 72 + 4, 132, 24 }, "GRAY+ALPHA;BC4 (DXT5);EAC (ETC2)", &fontAtlasBlockFormat);
+                GuiEnable();
+                if (!customFontLoaded) GuiDisable();
+                GuiCheckBox((Rectangle){ messageBox.x + 20, messageBox.y + 72 + 32 + 24 + 104 + 4, 16, 16 }, "Font subset with text style (.ttf)", &fontSubsetChecked);
+                GuiEnable();
 
                 if (result == 1)    // Export button pressed
                 {
@@ -1335,23 +2114,84 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------------
 
-            // GUI: Load File Dialog (and loading logic)
+            // GUI: Close Style Tab Window
             //----------------------------------------------------------------------------------------
-            if (showLoadStyleDialog)
+            if ((styleTabCloseRequested >= 0) && !styleTabCloseConfirmed)
             {
-#if defined(CUSTOM_MODAL_DIALOGS)
-                int result = GuiFileDialog(DIALOG_MESSAGE, "Load raygui style file ...", inFileName, "Ok", "Just drag and drop your .rgs style file!");
-#else
-                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load raygui style file", inFileName, "*.rgs", "raygui Style Files (*.rgs)");
-#endif
+                const char *tabName = (styleTabCloseRequested == styleTabActive)? currentStyleName : styleTabs[styleTabCloseRequested].name;
+                int result = GuiMessageBox((Rectangle){ (float)screenWidth/2 - 150, (float)screenHeight/2 - 50, 300, 100 }, "#9#Closing style tab", TextFormat("Do you really want to close %s?", tabName), "Yes;No");
+
+                if ((result == 0) || (result == 2)) styleTabCloseRequested = -1;
+                else if (result == 1) styleTabCloseConfirmed = true;
+            }
+            //----------------------------------------------------------------------------------------
+
+            // GUI: Recover Window (autosave journal)
+            //----------------------------------------------------------------------------------------
+#if defined(PLATFORM_DESKTOP)
+            if (windowRecoverActive)
+            {
+                int result = GuiMessageBox((Rectangle){ (float)screenWidth/2 - 150, (float)screenHeight/2 - 50, 300, 100 }, "#6#Recover unsaved changes", "Unsaved changes found, recover them?", "Yes;No");
+
                 if (result == 1)
                 {
-                    // Load style
+                    // Replay journal over loaded style, it is kept until style is saved
+                    char fontFileName[512] = { 0 };
+                    int fontSize = 0;
+
+                    strcpy(journalFileName, GetJournalFileName());
+
+                    if (LoadJournal(journalFileName, fontFileName, &fontSize))
+                    {
+                        if ((fontFileName[0] != '\0') && FileExists(fontFileName))
+                        {
+                            strcpy(inFontFileName, fontFileName);
+                            windowFontAtlasState.fontGenSizeValue = fontSize;
+                            windowFontAtlasState.fontAtlasRegen = true;
+                        }
+
+                        fontDrawSizeValue = GuiGetStyle(DEFAULT, TEXT_SIZE);
+                        fontSpacingValue = GuiGetStyle(DEFAULT, TEXT_SPACING);
+                    }
+
+                    memcpy(journalStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+                    strcpy(journalFontFileName, inFontFileName);
+                    journalFontSize = fontSize;
+                    windowRecoverActive = false;
+                }
+                else if ((result == 0) || (result == 2))
+                {
+                    strcpy(journalFileName, GetJournalFileName());
+                    ResetJournal();     // Changes discarded, remove journal
+                    windowRecoverActive = false;
+                }
+            }
+#endif
+            //----------------------------------------------------------------------------------------
+
+            // GUI: Load File Dialog (and loading logic)
+            //----------------------------------------------------------------------------------------
+            if (showLoadStyleDialog)
+            {
+#if defined(CUSTOM_MODAL_DIALOGS)
+                int result = GuiFileDialog(DIALOG_MESSAGE, "Load raygui style file ...", inFileName, "Ok", "Just drag and drop your .rgs style file!");
+#else
+                int result = GuiFileDialog(DIALOG_OPEN_FILE, "Load raygui style file", inFileName, "*.rgs", "raygui Style Files (*.rgs)");
+#endif
+                if (result == 1)
+                {
+                    // Load style
+                    DetachStyleFont();      // Detach font shared by style tabs (if cached), faces could be replaced
                     GuiLoadStyle(inFileName);
+#if defined(PLATFORM_DESKTOP)
+                    rgs_layers_init(styleLayers);   // Style layers reset, style not loaded as layer
+#endif
                     SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(inFileName)));
                     inputFileLoaded = true;
 
                     // Load .rgs custom font in font
+                    // NOTE: Font shared by style tabs is kept in cache, new loaded font is owned by current tab
+                    if (GuiGetFont().texture.id != customFont.texture.id) customFontCached = false;
                     customFont = GuiGetFont();
                     memset(inFontFileName, 0, 512);
                     customFontLoaded = true;
@@ -1401,53 +2241,27 @@ int main(int argc, char *argv[])
                     if (text != NULL)
                     {
                         int codepointsCount = 0;
-                        int *codepoints = LoadCodepoints(text, &codepointsCount);
+                        int *codepoints = LoadCodepointsByFrequency(text, &codepointsCount);
                         UnloadFileText(text);
 
                         if (codepointsCount > 0)
                         {
-                            // Clear current custom codepoints list
-                            if (windowFontAtlasState.externalCodepointList != NULL)
-                            {
-                                RL_FREE(windowFontAtlasState.externalCodepointList);
-                                windowFontAtlasState.externalCodepointListCount = 0;
-                                windowFontAtlasState.externalCodepointList = NULL;
-                            }
-
-                            // Create an array to store codepoints without duplicates
-                            int codepointsClearCount = codepointsCount;
-                            int *codepointsClear = (int *)RL_CALLOC(codepointsCount, sizeof(int));
-                            memcpy(codepointsClear, codepoints, codepointsCount*sizeof(int));
-
-                            // Remove duplicates
-                            for (int i = 0; i < codepointsClearCount; i++)
+                            // Replace current custom codepoints list, also as active charset if selected
+                            // NOTE: Codepoints sorted by frequency, most used glyphs first on atlas budget mode
+                            if (codepointList == windowFontAtlasState.externalCodepointList)
                             {
-                                for (int j = i + 1; j < codepointsClearCount; j++)
-                                {
-                                    if (codepointsClear[i] == codepointsClear[j])
-                                    {
-                                        for (int k = j; k < codepointsClearCount; k++) codepointsClear[k] = codepointsClear[k + 1];
-
-                                        j--;
-                                        codepointsClearCount--;
-                                    }
-                                }
+                                codepointList = codepoints;
+                                codepointListCount = codepointsCount;
                             }
 
-                            // Allocate memory to fit duplicates-cleared codepoints
-                            windowFontAtlasState.externalCodepointList = (int *)RL_CALLOC(codepointsClearCount*sizeof(int), 1);
-
-                            // Copy codepoints into our custom charset
-                            for (int i = 0; (i < codepointsClearCount); i++) windowFontAtlasState.externalCodepointList[i] = codepointsClear[i];
-                            windowFontAtlasState.externalCodepointListCount = codepointsClearCount;
-
-                            RL_FREE(codepointsClear);
+                            RL_FREE(windowFontAtlasState.externalCodepointList);
+                            windowFontAtlasState.externalCodepointList = codepoints;
+                            windowFontAtlasState.externalCodepointListCount = codepointsCount;
 
                             windowFontAtlasState.selectedCharset = 2;
                             windowFontAtlasState.fontAtlasRegen = true;
                         }
-
-                        UnloadCodepoints(codepoints);
+                        else RL_FREE(codepoints);
                     }
                 }
 
@@ -1477,6 +2291,9 @@ int main(int argc, char *argv[])
                     // Save style file (text or binary)
                     SaveStyle(outFileName, STYLE_BINARY);
                     outputFileCreated = true;
+                #if defined(PLATFORM_DESKTOP)
+                    ResetJournal();     // Changes saved, journal not required any more
+                #endif
 
                     // Set window title for future savings
                     SetWindowTitle(TextFormat("%s v%s - %s", toolName, toolVersion, GetFileName(outFileName)));
@@ -1493,6 +2310,53 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------------
 
+#if defined(PLATFORM_DESKTOP)
+            // GUI: Save Style Layer File Dialog (and saving logic)
+            //----------------------------------------------------------------------------------------
+            if (showSaveLayerDialog)
+            {
+#if defined(CUSTOM_MODAL_DIALOGS)
+                int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 30, 280, 112 }, "#2#Save raygui style layer file...", NULL, "#2#Save", outFileName, 512, NULL);
+#else
+                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Save raygui style layer file...", outFileName, "*.rgs", "raygui Style Files (*.rgs)");
+#endif
+                if (result == 1)
+                {
+                    if (outFileName[0] == '\0') strcpy(outFileName, "style.layer.rgs");   // Check for empty name
+                    if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgs")) strcat(outFileName, ".rgs\0");
+
+                    // Save layer style file, only properties changed over style layers
+                    // NOTE: Layer file is not registered for fast-save, it does not contain full style
+                    SaveStyleLayer(outFileName);
+                }
+
+                if (result >= 0) showSaveLayerDialog = false;
+            }
+            //----------------------------------------------------------------------------------------
+
+            // GUI: Save Style Parameters File Dialog (and saving logic)
+            //----------------------------------------------------------------------------------------
+            if (showSaveParamsDialog)
+            {
+#if defined(CUSTOM_MODAL_DIALOGS)
+                int result = GuiTextInputBox((Rectangle){ screenWidth/2 - 280/2, screenHeight/2 - 112/2 - 30, 280, 112 }, "#2#Save raygui style parameters file...", NULL, "#2#Save", outFileName, 512, NULL);
+#else
+                int result = GuiFileDialog(DIALOG_SAVE_FILE, "Save raygui style parameters file...", outFileName, "*.rgsp", "raygui Style Parameters (*.rgsp)");
+#endif
+                if (result == 1)
+                {
+                    if (outFileName[0] == '\0') strcpy(outFileName, "style.rgsp");   // Check for empty name
+                    if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgsp")) strcat(outFileName, ".rgsp\0");
+
+                    int saveResult = rgs_params_save(&windowParamsState.params, outFileName);
+                    if (saveResult != RGS_OK) LOG("WARNING: Style parameters could not be saved: %s\n", rgs_result_text(saveResult));
+                }
+
+                if (result >= 0) showSaveParamsDialog = false;
+            }
+            //----------------------------------------------------------------------------------------
+#endif
+
             // GUI: Export File Dialog (and saving logic)
             //----------------------------------------------------------------------------------------
             if (showExportStyleDialog)
@@ -1537,6 +2401,9 @@ int main(int argc, char *argv[])
                             if ((GetFileExtension(outFileName) == NULL) || !IsFileExtension(outFileName, ".rgs")) strcat(outFileName, ".rgs\0");
                             SaveStyle(outFileName, STYLE_BINARY);
                             outputFileCreated = true;
+                        #if defined(PLATFORM_DESKTOP)
+                            ResetJournal();     // Changes saved, journal not required any more
+                        #endif
 
                         } break;
                         case STYLE_AS_CODE:
@@ -1612,8 +2479,14 @@ int main(int argc, char *argv[])
             }
             //----------------------------------------------------------------------------------------
 
+            EndScissorMode();
         EndTextureMode();
 
+        GuiEndRedraw();
+
+        RAYGUI_TRACE_END();
+        RAYGUI_TRACE_BEGIN("present");
+
         BeginDrawing();
             ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
 
@@ -1622,22 +2495,110 @@ int main(int argc, char *argv[])
             else DrawTextureRec(screenTarget.texture, (Rectangle){ 0, 0, (float)screenTarget.texture.width, -(float)screenTarget.texture.height }, (Vector2){ 0, 0 }, WHITE);
 
         EndDrawing();
+
+        RAYGUI_TRACE_END();
+#if defined(PLATFORM_DESKTOP)
+        EndInputSessionFrame();
+#endif
         //----------------------------------------------------------------------------------
     }
     // De-Initialization
     //--------------------------------------------------------------------------------------
-    UnloadFont(customFont);     // Unload font data
+    int exitCode = 0;
+#if defined(PLATFORM_DESKTOP)
+    if (!windowRecoverActive)
+    {
+        // Closed properly, style tabs journals not required any more
+        ResetJournal();
+
+        for (int i = 0; i < styleTabsCount; i++)
+        {
+            if ((i != styleTabActive) && (styleTabs[i].journalFileName[0] != '\0') && FileExists(styleTabs[i].journalFileName)) remove(styleTabs[i].journalFileName);
+        }
+    }
+    if (inputSessionMode != INPUT_SESSION_NONE) exitCode = CloseInputSession();
+#endif
+    if (!customFontCached) UnloadFont(customFont);     // Unload font data (if not shared by style tabs)
+    for (int i = 0; i < styleTabsCount; i++) ReleaseStyleFont(styleTabs[i].fontId);  // Unload style tabs shared fonts
+    UnloadStylePack();          // Unload style templates pack index
 
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
-    return 0;
+    return exitCode;
 }
 
 //--------------------------------------------------------------------------------------------
 // Module functions definition
 //--------------------------------------------------------------------------------------------
 #if defined(PLATFORM_DESKTOP)
+// Init font atlas cache directory, placed next to executable if writable, user cache directory otherwise
+// NOTE: Cache is only disabled if no directory can be written
+static void InitFontAtlasCacheDir(void)
+{
+    strcpy(fontAtlasCacheDir, TextFormat("%s%s", GetApplicationDirectory(), FONT_ATLAS_CACHE_DIR_NAME));
+
+    if (!IsDirectoryWritable(fontAtlasCacheDir))
+    {
+        // User cache directory: %LOCALAPPDATA% (Windows), ~/Library/Caches (macOS), $XDG_CACHE_HOME or ~/.cache (Linux)
+        char userCacheDir[512] = { 0 };
+#if defined(_WIN32)
+        const char *localAppData = getenv("LOCALAPPDATA");
+        if (localAppData != NULL) strncpy(userCacheDir, localAppData, 400);
+#else
+        const char *xdgCache = getenv("XDG_CACHE_HOME");
+        const char *home = getenv("HOME");
+    #if defined(__APPLE__)
+        if (home != NULL) strncpy(userCacheDir, TextFormat("%s/Library/Caches", home), 400);
+    #else
+        if ((xdgCache != NULL) && (xdgCache[0] != '\0')) strncpy(userCacheDir, xdgCache, 400);
+        else if (home != NULL) strncpy(userCacheDir, TextFormat("%s/.cache", home), 400);
+    #endif
+#endif
+        fontAtlasCacheDir[0] = '\0';
+
+        if (userCacheDir[0] != '\0')
+        {
+            if (!DirectoryExists(userCacheDir)) MKDIR(userCacheDir);
+            strcat(userCacheDir, "/rguistyler");
+
+            if (IsDirectoryWritable(userCacheDir))
+            {
+                strcat(userCacheDir, "/" FONT_ATLAS_CACHE_DIR_NAME);
+                if (IsDirectoryWritable(userCacheDir)) strcpy(fontAtlasCacheDir, userCacheDir);
+            }
+        }
+
+        if (fontAtlasCacheDir[0] == '\0') LOG("WARNING: Font atlas cache disabled, no writable cache directory\n");
+    }
+}
+
+// Check if directory is writable, directory created if not available
+// NOTE: Writing is checked with a temporary file, directory could exist but be read-only
+static bool IsDirectoryWritable(const char *dirPath)
+{
+    bool writable = false;
+
+    if (!DirectoryExists(dirPath)) MKDIR(dirPath);
+
+    if (DirectoryExists(dirPath))
+    {
+        char testFileName[512] = { 0 };
+        strcpy(testFileName, TextFormat("%s/.rgs_write_test", dirPath));
+
+        FILE *testFile = fopen(testFileName, "wb");
+
+        if (testFile != NULL)
+        {
+            writable = (fputc(0, testFile) != EOF);
+            fclose(testFile);
+            remove(testFileName);
+        }
+    }
+
+    return writable;
+}
+
 // Show command line usage info
 static void ShowCommandLineInfo(void)
 {
@@ -1655,33 +2616,107 @@ static void ShowCommandLineInfo(void)
     printf("USAGE:\n\n");
     printf("    > rguistyler [--help] --input <filename.ext> [--output <filename.ext>]\n");
     printf("                 [--format <styleformat>] [--edit-prop <property> <value>]\n");
+    printf("                 [--atlas <atlasformat>] [--font-subset] [--pack <directory>] [--pack-info <filename>]\n");
+    printf("                 [--trace <filename.json>] [--batch <filename.txt>]\n");
+    printf("                 [--compare <filename.ext> <filename.ext>]\n");
+    printf("                 [--index <directory>] [--query <filename.rgsi> <query>]\n");
+    printf("                 [--duplicates <filename.rgsi> [threshold]] [--nearest <filename.rgsi> <filename.ext>]\n");
+    printf("                 [--record <filename.rae>] [--replay <filename.rae> [--max-frame-time <ms>]]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                      : Show tool version and command line usage help\n");
-    printf("    -i, --input <filename.ext>      : Define input file.\n");
-    printf("                                      Supported extensions: .rgs (text or binary)\n");
+    printf("    -i, --input <filename.ext>      : Define input file, multiple files supported.\n");
+    printf("                                      Supported extensions: .rgs (text or binary), .rgsp (style parameters)\n");
     printf("    -o, --output <filename.ext>     : Define output file.\n");
     printf("                                      Supported extensions: .rgs, .png, .h\n");
-    printf("                                      NOTE: Extension could be modified depending on format\n\n");
+    printf("                                      NOTE: Extension could be modified depending on format\n");
+    printf("                                      NOTE: Output directory for multiple input files\n\n");
     printf("    -f, --format <type_value>       : Define output file format to export style data.\n");
     printf("                                      Supported values:\n");
     printf("                                          0 - Style text format (.rgs)  \n");
     printf("                                          1 - Style binary format (.rgs)\n");
     printf("                                          2 - Style as code (.h)\n");
     printf("                                          3 - Controls table image (.png)\n\n");
+    printf("    -a, --atlas <type_value>        : Define font atlas format for styles with embedded font.\n");
+    printf("                                      Supported values:\n");
+    printf("                                          0 - GRAY+ALPHA (default)\n");
+    printf("                                          1 - BC4 blocks, uploaded as DXT5 (desktop GPUs)\n");
+    printf("                                          2 - EAC blocks, uploaded as ETC2_EAC (mobile GPUs)\n");
+    printf("                                      NOTE: Decoded on loading if format not supported by GPU\n\n");
+    printf("    -s, --font-subset               : Save text style font subset (.ttf), only charset glyphs included.\n");
+    printf("                                      NOTE: Only TrueType outlines fonts supported, original font used otherwise\n\n");
+    printf("    -p, --pack <directory>          : Pack directory style binary files (.rgs) as style templates.\n");
+    printf("                                      Output file: --output or styles.rgp by default\n");
+    printf("                                      NOTE: Pack could be placed next to executable or appended to it\n\n");
+    printf("    -k, --pack-info <filename>      : Show style templates pack entries, pack file or executable with pack appended.\n\n");
+    printf("    -c, --compare <file.ext> <file.ext> : Compare style controls tables, showing changes and score.\n");
+    printf("                                      Supported extensions: .png (table image), .rgs (table generated)\n");
+    printf("                                      NOTE: Heatmap saved if different (--output or compare.png), exit code 1\n");
+    printf("                                      NOTE: Exit code 2 if any of the files could not be loaded\n\n");
+    printf("    -b, --batch <filename.txt>      : Apply batch script to every input style before exporting.\n");
+    printf("                                      Supported commands (one per line, '#' starts a comment line):\n");
+    printf("                                          set CONTROL.PROPERTY value - Property (names, EXTnn or ids), value: 12, 0xff0055ff, #ff0055\n");
+    printf("                                          hue-rotate degrees - Rotate all colors hue\n");
+    printf("                                          swap-light-dark    - Invert all colors lightness (HSV value)\n");
+    printf("                                          load-font file.ttf size - Load font (path relative to script)\n\n");
+    printf("    -x, --index <directory>         : Index directory styles (.rgs, .png with rGSf chunk), subdirectories included.\n");
+    printf("                                      Output file: --output or styles.rgsi by default\n");
+    printf("                                      NOTE: Existing index is updated, only new or changed files loaded\n\n");
+    printf("    -q, --query <file.rgsi> <query> : Query styles index, showing matching styles (all query terms required).\n");
+    printf("                                      Supported terms:\n");
+    printf("                                          CONTROL.PROPERTY<op>value - Style property (i.e. BUTTON.BORDER_WIDTH>2)\n");
+    printf("                                          color=#rrggbb[aa]  - Any control color\n");
+    printf("                                          font=<hash>        - Embedded font hash\n");
+    printf("                                          size<op>value, glyphs<op>value, icons<op>value\n");
+    printf("                                          charset=<block>    - Font Unicode block (latin1, cyrillic, cjk...)\n");
+    printf("                                      NOTE: Supported operators: = < > <= >=\n\n");
+    printf("    -d, --duplicates <file.rgsi> [threshold] : Find near-duplicate styles in index, showing clusters.\n");
+    printf("                                      Threshold: styles distance [0..100], 0.5 by default\n");
+    printf("                                      NOTE: Distance computed over resolved style, colors compared in CIELAB space\n\n");
+    printf("    -n, --nearest <file.rgsi> <file.ext> : Find nearest styles in index to provided style.\n");
+    printf("                                      Supported extensions: .rgs (binary), .png (rGSf chunk)\n\n");
+    printf("    -t, --trace <filename.json>     : Save processing trace (Chrome trace format) and show throughput.\n");
+    printf("                                      NOTE: Trace can be opened with chrome://tracing or ui.perfetto.dev\n");
+    printf("                                      NOTE: Frames and sections traced on --replay\n\n");
+    printf("    -r, --record <filename.rae>     : Record gui input session (keys, mouse, dropped files) per frame.\n");
+    printf("                                      NOTE: Native file dialogs are not recorded, drop files instead\n\n");
+    printf("    -y, --replay <filename.rae>     : Replay gui input session (hidden window), showing frame and sections times.\n");
+    printf("    -m, --max-frame-time <ms>       : Replay frame time limit (95th percentile), exit code 1 if exceeded.\n\n");
     //printf("    -e, --edit-prop <controlId>,<propertyId>,<propertyValue>\n");
     //printf("                                    : Edit specific property from input to output.\n");
 
     printf("\nEXAMPLES:\n\n");
     printf("    > rguistyler --input tools.rgs --output tools.png\n");
+    printf("    > rguistyler --pack styles --output styles.rgp\n");
+    printf("    > rguistyler --input dark.rgs cyber.rgs --output code --format 2 --trace trace.json\n");
+    printf("    > rguistyler --compare style_dark.png dark.rgs --output diff.png\n");
+    printf("    > rguistyler --input dark.rgs cyber.rgs --output variants --batch warm.txt\n");
+    printf("    > rguistyler --index themes --output themes.rgsi\n");
+    printf("    > rguistyler --query themes.rgsi \"color=#ff0055 BUTTON.BORDER_WIDTH>2\"\n");
+    printf("    > rguistyler --duplicates themes.rgsi 1.0\n");
+    printf("    > rguistyler --replay atlas_drag.rae --trace atlas_drag.json --max-frame-time 8\n");
 }
 
 // Process command line input
-static void ProcessCommandLine(int argc, char *argv[])
+// NOTE: Exit code is 1 if compared images are different, 0 otherwise
+static int ProcessCommandLine(int argc, char *argv[])
 {
     // CLI required variables
     bool showUsageInfo = false;         // Toggle command line usage info
     int outputFormat = STYLE_BINARY;    // Formats: STYLE_BINARY, STYLE_AS_CODE, STYLE_TABLE_IMAGE
+    char packDirPath[512] = { 0 };      // Style templates directory to pack
+    char packInfoFileName[512] = { 0 }; // Style templates pack to show entries
+    char traceFileName[512] = { 0 };    // Trace output file name (Chrome trace format)
+    char indexDirPath[512] = { 0 };     // Styles directory to index
+    const char *queryArgs[2] = { NULL, NULL };  // Styles index file and query
+    const char *duplicatesFileName = NULL;      // Styles index file to find near-duplicates
+    float duplicatesThreshold = STYLE_DUPLICATES_THRESHOLD;
+    const char *nearestArgs[2] = { NULL, NULL };    // Styles index file and style file to find nearest styles
+    const char **inFileNames = (const char **)RL_CALLOC(argc, sizeof(const char *));  // Input files (pointing to arguments)
+    int inFileCount = 0;
+    const char *compareFileNames[2] = { NULL, NULL };   // Files to compare: .png images or .rgs styles
+    const char *batchFileName = NULL;   // Batch script applied to input styles
+    int result = 0;
 
     // Process command line arguments
     for (int i = 1; i < argc; i++)
@@ -1693,15 +2728,20 @@ static void ProcessCommandLine(int argc, char *argv[])
         else if ((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0))
         {
             // Check for valid argument and valid file extension
+            // NOTE: Multiple input files supported, all arguments up to next option
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                if (IsFileExtension(argv[i + 1], ".rgs"))
+                while (((i + 1) < argc) && (argv[i + 1][0] != '-'))
                 {
-                    strcpy(inFileName, argv[i + 1]);    // Read input filename
-                }
-                else LOG("WARNING: Input file extension not recognized\n");
+                    if (IsFileExtension(argv[i + 1], ".rgs") || IsFileExtension(argv[i + 1], ".rgsp"))
+                    {
+                        inFileNames[inFileCount] = argv[i + 1];     // Read input filename
+                        inFileCount++;
+                    }
+                    else LOG("WARNING: Input file extension not recognized\n");
 
-                i++;
+                    i++;
+                }
             }
             else LOG("WARNING: No input file provided\n");
         }
@@ -1711,7 +2751,9 @@ static void ProcessCommandLine(int argc, char *argv[])
             {
                 if (IsFileExtension(argv[i + 1], ".rgs") ||
                     IsFileExtension(argv[i + 1], ".h") ||
-                    IsFileExtension(argv[i + 1], ".png"))
+                    IsFileExtension(argv[i + 1], ".png") ||
+                    IsFileExtension(argv[i + 1], ".rgp") ||
+                    IsFileExtension(argv[i + 1], ".rgsi"))
                 {
                     strcpy(outFileName, argv[i + 1]);   // Read output filename
                 }
@@ -1734,847 +2776,3383 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: Format parameters provided not valid\n");
         }
-    }
+        else if ((strcmp(argv[i], "-a") == 0) || (strcmp(argv[i], "--atlas") == 0))
+        {
+            // Check for valid argumment and valid parameters
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                int format = TextToInteger(argv[i + 1]);
 
-    if (inFileName[0] != '\0')
-    {
-        // Set a default name for output in case not provided
-        if (outFileName[0] == '\0') strcpy(outFileName, "output");
+                if ((format >= 0) && (format <= 2)) fontAtlasBlockFormat = format;
 
-        LOG("\nInput file:       %s", inFileName);
-        LOG("\nOutput file:      %s", outFileName);
+                i++;
+            }
+            else LOG("WARNING: Atlas format parameters provided not valid\n");
+        }
+        else if ((strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "--font-subset") == 0))
+        {
+            fontSubsetChecked = true;
+        }
+        else if ((strcmp(argv[i], "-p") == 0) || (strcmp(argv[i], "--pack") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (DirectoryExists(argv[i + 1])) strcpy(packDirPath, argv[i + 1]);
+                else LOG("WARNING: Pack directory not found\n");
 
-        // Process input .rgs file
-        GuiLoadStyle(inFileName);
+                i++;
+            }
+            else LOG("WARNING: No pack directory provided\n");
+        }
+        else if ((strcmp(argv[i], "-k") == 0) || (strcmp(argv[i], "--pack-info") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (FileExists(argv[i + 1])) strcpy(packInfoFileName, argv[i + 1]);
+                else LOG("WARNING: Pack file not found\n");
 
-        // Export style files with different formats
-        switch (outputFormat)
+                i++;
+            }
+            else LOG("WARNING: No pack file provided\n");
+        }
+        else if ((strcmp(argv[i], "-b") == 0) || (strcmp(argv[i], "--batch") == 0))
         {
-            case STYLE_TEXT: SaveStyle(TextFormat("%s%s", outFileName, ".rgs"), outputFormat); break;
-            case STYLE_BINARY: SaveStyle(TextFormat("%s%s", outFileName, ".rgs"), outputFormat); break;
-            case STYLE_AS_CODE: ExportStyleAsCode(TextFormat("%s%s", outFileName, ".h"), GetFileNameWithoutExt(outFileName)); break;
-            case STYLE_TABLE_IMAGE:
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                Image imStyleTable = GenImageStyleControlsTable(GetFileNameWithoutExt(outFileName));
-                ExportImage(imStyleTable, TextFormat("%s%s", outFileName, ".png"));
-                UnloadImage(imStyleTable);
-            } break;
-            default: break;
+                batchFileName = argv[i + 1];    // Read batch script filename
+                i++;
+            }
+            else LOG("WARNING: No batch script file provided\n");
         }
-    }
-
-    if (showUsageInfo) ShowCommandLineInfo();
-}
-#endif      // PLATFORM_DESKTOP
-
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export data functions
-//--------------------------------------------------------------------------------------------
-// Save current style to memory data array
-// WARNING: Using globals: fontEmbeddedChecked, fontDataCompressed
-static unsigned char *SaveStyleToMemory(int *size)
-{
-    #define GUI_STYLE_RGS_VERSION   400
-
-    unsigned char *buffer = (unsigned char *)RL_CALLOC(1024*1024, 1);  // 1MB should be enough to save the style
-    int dataSize = 0;
-
-    char signature[5] = "rGS ";
-    short version = GUI_STYLE_RGS_VERSION;
-    short reserved = 0;
-    int changedPropCounter = StyleChangesCounter(defaultStyle);
+        else if ((strcmp(argv[i], "-x") == 0) || (strcmp(argv[i], "--index") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (DirectoryExists(argv[i + 1])) strcpy(indexDirPath, argv[i + 1]);
+                else LOG("WARNING: Index directory not found\n");
 
-    memcpy(buffer, signature, 4);
-    memcpy(buffer + 4, &version, sizeof(short));
-    memcpy(buffer + 6, &reserved, sizeof(short));
-    memcpy(buffer + 8, &changedPropCounter, sizeof(int));
-    dataSize += 12;
+                i++;
+            }
+            else LOG("WARNING: No index directory provided\n");
+        }
+        else if ((strcmp(argv[i], "-q") == 0) || (strcmp(argv[i], "--query") == 0))
+        {
+            // NOTE: Query could be empty (all styles listed) but it must be provided
+            if (((i + 2) < argc) && (argv[i + 1][0] != '-'))
+            {
+                queryArgs[0] = argv[i + 1];
+                queryArgs[1] = argv[i + 2];
 
-    short controlId = 0;
-    short propertyId = 0;
-    int propertyValue = 0;
+                i += 2;
+            }
+            else LOG("WARNING: Index file and query required\n");
+        }
+        else if ((strcmp(argv[i], "-d") == 0) || (strcmp(argv[i], "--duplicates") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                duplicatesFileName = argv[i + 1];
+                i++;
 
-    // Save first all properties that have changed in DEFAULT style
-    for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
-    {
-        if (defaultStyle[i] != GuiGetStyle(0, i))
+                // Optional distance threshold
+                if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+                {
+                    duplicatesThreshold = (float)atof(argv[i + 1]);
+                    i++;
+                }
+            }
+            else LOG("WARNING: No index file provided\n");
+        }
+        else if ((strcmp(argv[i], "-n") == 0) || (strcmp(argv[i], "--nearest") == 0))
         {
-            propertyId = (short)i;
-            propertyValue = GuiGetStyle(0, i);
+            if (((i + 2) < argc) && (argv[i + 1][0] != '-') && (argv[i + 2][0] != '-'))
+            {
+                if (IsFileExtension(argv[i + 2], ".rgs") || IsFileExtension(argv[i + 2], ".png"))
+                {
+                    nearestArgs[0] = argv[i + 1];
+                    nearestArgs[1] = argv[i + 2];
+                }
+                else LOG("WARNING: Style file extension not recognized\n");
 
-            memcpy(buffer + dataSize, &controlId, sizeof(short));
-            memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
-            memcpy(buffer + dataSize + 4, &propertyValue, sizeof(int));
-            dataSize += 8;
+                i += 2;
+            }
+            else LOG("WARNING: Index file and style file required\n");
         }
-    }
+        else if ((strcmp(argv[i], "-c") == 0) || (strcmp(argv[i], "--compare") == 0))
+        {
+            if (((i + 2) < argc) && (argv[i + 1][0] != '-') && (argv[i + 2][0] != '-'))
+            {
+                if ((IsFileExtension(argv[i + 1], ".png") || IsFileExtension(argv[i + 1], ".rgs")) &&
+                    (IsFileExtension(argv[i + 2], ".png") || IsFileExtension(argv[i + 2], ".rgs")))
+                {
+                    compareFileNames[0] = argv[i + 1];
+                    compareFileNames[1] = argv[i + 2];
+                }
+                else LOG("WARNING: Compare files extension not recognized\n");
 
-    // Save all properties that have changed in comparison to DEFAULT style
-    for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
-    {
-        for (int j = 0; j < RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED; j++)
+                i += 2;
+            }
+            else LOG("WARNING: Two files required to compare\n");
+        }
+        else if ((strcmp(argv[i], "-t") == 0) || (strcmp(argv[i], "--trace") == 0))
         {
-            if ((defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j)) && (GuiGetStyle(i, j) !=  GuiGetStyle(0, j)))
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
-                controlId = (short)i;
-                propertyId = (short)j;
-                propertyValue = GuiGetStyle(i, j);
+                strcpy(traceFileName, argv[i + 1]);     // Read trace filename
 
-                memcpy(buffer + dataSize, &controlId, sizeof(short));
-                memcpy(buffer + dataSize + 2, &propertyId, sizeof(short));
-                memcpy(buffer + dataSize + 4, &propertyValue, sizeof(int));
-                dataSize += 8;
+                i++;
             }
+            else LOG("WARNING: No trace file provided\n");
         }
     }
 
-    int fontSize = 0;
+    if (traceFileName[0] != '\0') InitTrace();
 
-    // Embed font data if required
-    if (fontEmbeddedChecked && customFontLoaded)
+    if (packDirPath[0] != '\0')
     {
-        Image imFont = LoadImageFromTexture(customFont.texture);
-
-        // Write font parameters
-        int fontParamsSize = 32;
-        int fontImageUncompSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
-        int fontImageCompSize = fontImageUncompSize;
-        int fontGlyphDataSize = customFont.glyphCount*32;       // 32 bytes by char
-        int fontDataSize = fontParamsSize + fontImageUncompSize + fontGlyphDataSize;
-        int fontType = 0;       // 0-NORMAL, 1-SDF
-
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-        // NOTE: If data is compressed using raylib CompressData() DEFLATE,
-        // it requires to be decompressed with raylib DecompressData(), that requires
-        // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
+        // Pack all directory styles as style templates, no style processing required
+        const char *packFileName = (outFileName[0] != '\0')? outFileName : STYLE_PACK_FILE_NAME;
+        if (SaveStylePack(packFileName, packDirPath) > 0) LOG("\nOutput file:      %s\n", packFileName);
+        else LOG("WARNING: No style binary files found to pack\n");
+    }
 
-        // Make sure font atlas image data is GRAY + ALPHA for better compression
-        if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    if (packInfoFileName[0] != '\0')
+    {
+        // Show pack entries, pack is located same way as tool does (pack file or appended to executable)
+        if (LoadStylePack(packInfoFileName) > 0)
         {
-            ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
-            fontImageUncompSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+            printf("Pack offset: %i\n", stylePackOffset);
+            for (int i = 0; i < stylePackCount; i++) printf("%-32s %8i %8i\n", stylePackEntries[i].name, stylePackEntries[i].compSize, stylePackEntries[i].dataSize);
+            printf("Pack entries: %i\n", stylePackCount);
         }
-
-        // Compress font atlas image data
-        unsigned char *compData = CompressData(imFont.data, fontImageUncompSize, &fontImageCompSize);
-
-        // NOTE: Actually, fontDataSize is only used to check that there is font data included in the file
-        fontDataSize = fontParamsSize + fontImageCompSize + fontGlyphDataSize;
-#endif
-        memcpy(buffer + dataSize, &fontDataSize, sizeof(int));
-        memcpy(buffer + dataSize + 4, &customFont.baseSize, sizeof(int));
-        memcpy(buffer + dataSize + 8, &customFont.glyphCount, sizeof(int));
-        memcpy(buffer + dataSize + 12, &fontType, sizeof(int));
-
-        // Save font white rectangle
-        memcpy(buffer + dataSize + 16, &fontWhiteRec, sizeof(Rectangle));
-        dataSize += (16 + sizeof(Rectangle));
-
-        // Write font image parameters
-        memcpy(buffer + dataSize, &fontImageUncompSize, sizeof(int));
-        memcpy(buffer + dataSize + 4, &fontImageCompSize, sizeof(int));
-        memcpy(buffer + dataSize + 8, &imFont.width, sizeof(int));
-        memcpy(buffer + dataSize + 12, &imFont.height, sizeof(int));
-        memcpy(buffer + dataSize + 16, &imFont.format, sizeof(int));
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-        memcpy(buffer + dataSize + 20, compData, fontImageCompSize);
-        dataSize += (20 + fontImageCompSize);
-        MemFree(compData);
-#else
-        memcpy(buffer + dataSize, imFont.data, fontImageUncompSize);
-        dataSize += (20 + fontImageUncompSize);
-#endif
-        UnloadImage(imFont);
-
-        // Write font recs data
-        // NOTE: Version 400 always adds the compression size parameter
-        if (version >= 400)
+        else
         {
-            int recsDataCompSize = 0;
+            LOG("ERROR: No valid style templates pack found: %s\n", packInfoFileName);
+            result = 1;
+        }
 
-            if (fontDataCompressedChecked)
-            {
-                unsigned char *recsDataCompressed = CompressData((unsigned char *)customFont.recs, customFont.glyphCount*sizeof(Rectangle), &recsDataCompSize);
+        UnloadStylePack();
+    }
+
+    if (indexDirPath[0] != '\0')
+    {
+        // Index directory styles, previous index file updated if available
+        UpdateStyleIndex(IsFileExtension(outFileName, ".rgsi")? outFileName : STYLE_INDEX_FILE_NAME, indexDirPath);
+    }
 
-                memcpy(buffer + dataSize, &recsDataCompSize, sizeof(int));
-                dataSize += 4;
+    if (queryArgs[0] != NULL) QueryStyleIndex(queryArgs[0], queryArgs[1]);
+    if (duplicatesFileName != NULL) FindStyleDuplicates(duplicatesFileName, duplicatesThreshold);
+    if (nearestArgs[0] != NULL) FindNearestStyles(nearestArgs[0], nearestArgs[1]);
 
-                memcpy(buffer + dataSize, recsDataCompressed, recsDataCompSize);
-                dataSize += recsDataCompSize;
+    // Batch script parsed once, no style processed if not valid
+    BatchCommand *batchCommands = NULL;
+    int batchCommandCount = 0;
 
-                RL_FREE(recsDataCompressed);
-            }
-            else
-            {
-                memcpy(buffer + dataSize, &recsDataCompSize, sizeof(int));
-                dataSize += 4;
+    if (batchFileName != NULL)
+    {
+        batchCommands = LoadBatchScript(batchFileName, &batchCommandCount);
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    memcpy(buffer + dataSize, &customFont.recs[i], sizeof(Rectangle));
-                    dataSize += sizeof(Rectangle);
-                }
-            }
+        if (batchCommands == NULL)
+        {
+            printf("WARNING: Batch script could not be loaded: %s\n", batchFileName);
+            inFileCount = 0;
+            result = 1;
         }
         else
         {
-            // Fallback for older versions, no compression and no compression size stored
-            for (int i = 0; i < customFont.glyphCount; i++)
+            // Batch script font loading requires a graphics device (font atlas texture), a hidden window is created
+            // NOTE: If graphics device is not available (no display), load-font commands fail on styles processing
+            bool fontRequired = false;
+            for (int i = 0; i < batchCommandCount; i++) if (batchCommands[i].type == BATCH_LOAD_FONT) fontRequired = true;
+
+            if (fontRequired)
             {
-                memcpy(buffer + dataSize, &customFont.recs[i], sizeof(Rectangle));
-                dataSize += sizeof(Rectangle);
+                SetConfigFlags(FLAG_WINDOW_HIDDEN);
+                InitWindow(64, 64, TextFormat("%s v%s", toolName, toolVersion));
             }
         }
+    }
 
-        // Write font chars info data
-        // NOTE: Version 400 always adds the compression size parameter
-        if (version >= 400)
-        {
-            int glyphsDataCompSize = 0;
+    // Multiple input files use input file names for output, --output defines output directory
+    if ((inFileCount > 1) && (outFileName[0] != '\0') && !DirectoryExists(outFileName)) MKDIR(outFileName);
 
-            if (fontDataCompressedChecked)
-            {
-                // NOTE: We only want to save some fields from GlyphInfo struct
-                int *glyphsData = (int *)RL_MALLOC(customFont.glyphCount*4*sizeof(int));
+    for (int f = 0; f < inFileCount; f++)
+    {
+        char outBaseName[512] = { 0 };      // Output file name, extension added depending on format
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    glyphsData[4*i + 0] = customFont.glyphs[i].value;
-                    glyphsData[4*i + 1] = customFont.glyphs[i].offsetX;
-                    glyphsData[4*i + 2] = customFont.glyphs[i].offsetY;
-                    glyphsData[4*i + 3] = customFont.glyphs[i].advanceX;
-                }
+        strcpy(inFileName, inFileNames[f]);
 
-                unsigned char *glyphsDataCompressed = CompressData((unsigned char *)glyphsData, customFont.glyphCount*4*sizeof(int), &glyphsDataCompSize);
+        // Set a default name for output in case not provided
+        if (inFileCount == 1) strcpy(outBaseName, (outFileName[0] != '\0')? outFileName : "output");
+        else strcpy(outBaseName, TextFormat("%s/%s", (outFileName[0] != '\0')? outFileName : GetDirectoryPath(inFileName), GetFileNameWithoutExt(inFileName)));
 
-                memcpy(buffer + dataSize, &glyphsDataCompSize, sizeof(int));
-                dataSize += 4;
+        LOG("\nInput file:       %s", inFileName);
+        LOG("\nOutput file:      %s", outBaseName);
 
-                memcpy(buffer + dataSize, glyphsDataCompressed, glyphsDataCompSize);
-                dataSize += glyphsDataCompSize;
+        // Read input .rgs file
+        int fileDataSize = GetFileLength(inFileName);
+        BeginTraceFileSpan(inFileName, fileDataSize);
 
-                RL_FREE(glyphsDataCompressed);
-                RL_FREE(glyphsData);
-            }
-            else
-            {
-                memcpy(buffer + dataSize, &glyphsDataCompSize, sizeof(int));
-                dataSize += 4;
+        BeginTraceSpan("read");
+        unsigned char *fileData = LoadFileData(inFileName, &fileDataSize);
+        EndTraceSpan();
 
-                for (int i = 0; i < customFont.glyphCount; i++)
-                {
-                    memcpy(buffer + dataSize, &customFont.glyphs[i].value, sizeof(int));
-                    memcpy(buffer + dataSize + 4, &customFont.glyphs[i].offsetX, sizeof(int));
-                    memcpy(buffer + dataSize + 8, &customFont.glyphs[i].offsetY, sizeof(int));
-                    memcpy(buffer + dataSize + 12, &customFont.glyphs[i].advanceX, sizeof(int));
-                    dataSize += 16;
-                }
-            }
+        // Process input .rgs file, reset to default style to avoid mixing styles
+        // NOTE: Text style files could require external files, they are loaded by GuiLoadStyle()
+        BeginTraceSpan("parse");
+        GuiLoadStyleDefault();          // NOTE: Previous font unloaded (batch script font included)
+        customFontLoaded = false;
+        memset(inFontFileName, 0, 512);
+
+        if (IsFileExtension(inFileName, ".rgsp"))
+        {
+            // Style parameters compiled over default style
+            rgs_params params = { 0 };
+            int result = rgs_params_load(&params, inFileName);
+            if (result != RGS_OK) LOG("WARNING: Style parameters file loaded with errors: %s\n", rgs_result_text(result));
+            ApplyStyleParams(&params);
         }
-        else
+        else if ((fileData != NULL) && (fileDataSize > 12) && (fileData[0] == 'r') && (fileData[1] == 'G') && (fileData[2] == 'S') && (fileData[3] == ' ')) GuiLoadStyleFromMemory(fileData, fileDataSize);
+        else GuiLoadStyle(inFileName);
+        EndTraceSpan();
+
+        UnloadFileData(fileData);
+
+        if (batchCommands != NULL)
         {
-            // Fallback for older versions, no compression and no compression size stored
-            for (int i = 0; i < customFont.glyphCount; i++)
+            BeginTraceSpan("batch");
+            bool batchApplied = ApplyBatchScript(batchCommands, batchCommandCount);
+            EndTraceSpan();
+
+            if (!batchApplied)
             {
-                memcpy(buffer + dataSize, &customFont.glyphs[i].value, sizeof(int));
-                memcpy(buffer + dataSize + 4, &customFont.glyphs[i].offsetX, sizeof(int));
-                memcpy(buffer + dataSize + 8, &customFont.glyphs[i].offsetY, sizeof(int));
-                memcpy(buffer + dataSize + 12, &customFont.glyphs[i].advanceX, sizeof(int));
-                dataSize += 16;
+                printf("WARNING: Batch script could not be applied, output skipped: %s\n", inFileName);
+                result = 1;
+
+                EndTraceSpan();     // File span
+                continue;
             }
         }
-    }
-    else
-    {
-        memcpy(buffer + dataSize, &fontSize, sizeof(int));
-        dataSize += 4;
-    }
 
-    *size = dataSize;
-    return buffer;
-}
+        // Export style files with different formats
+        // NOTE: Output file name copied, TextFormat() internal buffers are reused by rendering and export functions
+        char outputFileName[512] = { 0 };
 
-// Save raygui style binary file (.rgs)
-// NOTE: By default style is saved as binary file but
-// a text style mode is also available for debug (no font embedding)
-static int SaveStyle(const char *fileName, int format)
-{
-    #define GUI_STYLE_RGS_VERSION   400
+        switch (outputFormat)
+        {
+            case STYLE_TEXT:
+            {
+                strcpy(outputFileName, TextFormat("%s%s", outBaseName, ".rgs"));
 
-    int result = 0;
+                BeginTraceSpan("write");
+                SaveStyle(outputFileName, outputFormat);
+                EndTraceSpan();
+            } break;
+            case STYLE_BINARY:
+            {
+                // NOTE: Same as SaveStyle(), split to trace encoding and writing
+                int rgsFileDataSize = 0;
+                strcpy(outputFileName, TextFormat("%s%s", outBaseName, ".rgs"));
 
-    if (format == STYLE_BINARY)
-    {
-        // Style File Structure (.rgs)
-        // ------------------------------------------------------
-        // Offset  | Size    | Type       | Description
-        // ------------------------------------------------------
-        // 0       | 4       | char       | Signature: "rGS "
-        // 4       | 2       | short      | Version: 200, 400
-        // 6       | 2       | short      | reserved
-        // 8       | 4       | int        | Num properties (only changed ones from default style)
+                BeginTraceSpan("encode");
+                unsigned char *rgsFileData = SaveStyleToMemory(&rgsFileDataSize);
+                EndTraceSpan();
 
-        // Properties Data: (controlId (2 byte) +  propertyId (2 byte) + propertyValue (4 bytes))*N
-        // foreach (property)
-        // {
-        //   8+8*i  | 2       | short      | ControlId
-        //   8+8*i  | 2       | short      | PropertyId
-        //   8+8*i  | 4       | int        | PropertyValue
-        // }
+                BeginTraceSpan("write");
+                SaveFileData(outputFileName, rgsFileData, rgsFileDataSize);
+                EndTraceSpan();
 
-        // Custom Font Data : Parameters (32 bytes)
-        // 16+4*N  | 4       | int        | Font data size (0 - no font, no more fields added!)
-        // 20+4*N  | 4       | int        | Font base size
-        // 24+4*N  | 4       | int        | Font glyph count [glyphCount]
-        // 28+4*N  | 4       | int        | Font type (0-NORMAL, 1-SDF)
-        // 32+4*N  | 16      | Rectangle  | Font white rectangle
+                RL_FREE(rgsFileData);
+            } break;
+            case STYLE_AS_CODE:
+            {
+                strcpy(outputFileName, TextFormat("%s%s", outBaseName, ".h"));
 
-        // Custom Font Data : Image (20 bytes + imData)
-        // NOTE: Font image atlas is always converted to GRAY+ALPHA
-        // and atlas image data can be compressed (DEFLATE)
-        // 48+4*N  | 4       | int        | Image data size (uncompressed)
-        // 52+4*N  | 4       | int        | Image data size (compressed)
-        // 56+4*N  | 4       | int        | Image width
-        // 60+4*N  | 4       | int        | Image height
-        // 64+4*N  | 4       | int        | Image format
-        // 68+4*N  | imSize  | *          | Image data (comp or uncomp)
+                BeginTraceSpan("export code");
+                ExportStyleAsCode(outputFileName, GetFileNameWithoutExt(outBaseName));
+                EndTraceSpan();
+            } break;
+            case STYLE_TABLE_IMAGE:
+            {
+                int pngDataSize = 0;
+                strcpy(outputFileName, TextFormat("%s%s", outBaseName, ".png"));
 
-        // Custom Font Data : Recs (32 bytes*glyphCount)
-        // NOTE: Font recs data can be compressed (DEFLATE)
-        // if (version >= 400)
-        // {
-        //    ...  | 4       | int       | Recs data compressed size (0 - not compressed)
-        // }
-        // NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-        // foreach (glyph)
-        // {
-        //    ...  | 16      | Rectangle  | Glyph rectangle (in image)
-        // }
+                BeginTraceSpan("render table");
+                Image imStyleTable = GenImageStyleControlsTable(GetFileNameWithoutExt(outBaseName));
+                EndTraceSpan();
 
-        // Custom Font Data : Glyph Info (32 bytes*glyphCount)
-        // NOTE: Font glyphs info data can be compressed (DEFLATE)
-        // if (version >= 400)
-        // {
-        //    ...  | 4       | int       | Glyphs data compressed size (0 - not compressed)
-        // }
-        // NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
-        // foreach (glyph)
-        // {
-        //   ...   | 4       | int        | Glyph value
-        //   ...   | 4       | int        | Glyph offset X
-        //   ...   | 4       | int        | Glyph offset Y
-        //   ...   | 4       | int        | Glyph advance X
-        // }
-        // ------------------------------------------------------
+                BeginTraceSpan("png encode");
+                unsigned char *pngData = ExportImageToMemory(imStyleTable, ".png", &pngDataSize);
+                EndTraceSpan();
 
-        int rgsFileDataSize = 0;
-        unsigned char *rgsFileData = SaveStyleToMemory(&rgsFileDataSize);
+                BeginTraceSpan("write");
+                SaveFileData(outputFileName, pngData, pngDataSize);
+                EndTraceSpan();
 
-        result = SaveFileData(fileName, rgsFileData, rgsFileDataSize);
+                MemFree(pngData);
+                UnloadImage(imStyleTable);
+            } break;
+            default: break;
+        }
 
-        RL_FREE(rgsFileData);
+        if (outputFileName[0] != '\0') traceBytesOut += GetFileLength(outputFileName);
+
+        EndTraceSpan();     // File span
     }
-    else if (format == STYLE_TEXT)
+
+    if (compareFileNames[0] != NULL)
     {
-        FILE *rgsFile = fopen(fileName, "wt");
+        // Compare style tables, heatmap only saved if images are different
+        // NOTE: --output defines heatmap file name, compare.png by default
+        // NOTE: Style controls table generation requires a graphics device (render texture), a hidden window is created
+        if ((IsFileExtension(compareFileNames[0], ".rgs") || IsFileExtension(compareFileNames[1], ".rgs")) && !IsWindowReady())
+        {
+            SetConfigFlags(FLAG_WINDOW_HIDDEN);
+            InitWindow(64, 64, TextFormat("%s v%s", toolName, toolVersion));
+        }
 
-        if (rgsFile != NULL)
+        BeginTraceSpan("load");
+        Image imageA = LoadCompareImage(compareFileNames[0]);
+        Image imageB = LoadCompareImage(compareFileNames[1]);
+        EndTraceSpan();
+
+        if ((imageA.data != NULL) && (imageB.data != NULL))
         {
-            #define RGS_FILE_VERSION_TEXT  "4.0"
+            Image heatmap = { 0 };
 
-            // Write some description comments
-            fprintf(rgsFile, "#\n# rgs style text file (v%s) - raygui style file generated using rGuiStyler\n#\n", RGS_FILE_VERSION_TEXT);
-            fprintf(rgsFile, "# Provided info:\n");
-            fprintf(rgsFile, "#    f fontGenSize charsetFileName fontFileName\n");
-            fprintf(rgsFile, "#    p <controlId> <propertyId> <propertyValue>  Property description\n#\n");
+            BeginTraceSpan("compare");
+            CompareResult compare = CompareImages(imageA, imageB, &heatmap);
+            EndTraceSpan();
 
-            if (customFontLoaded)
+            printf("\nCompare files:    %s | %s\n", compareFileNames[0], compareFileNames[1]);
+            printf("Tiles changed:    %i/%i\n", compare.tilesChanged, compare.tilesCount);
+            printf("Pixels changed:   %i/%i\n", compare.pixelsChanged, compare.pixelsCount);
+            printf("Delta E:          %.2f max, %.4f mean\n", compare.maxDelta, compare.meanDelta);
+            printf("Score:            %.3f\n", compare.score);
+
+            if (compare.pixelsChanged > 0)
             {
-                // Save charset into an external file
-                // NOTE: Only saving charset if not basic one (95 codepoints)
-                // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
-                if (codepointListCount > 95)
-                {
-                    char *textData = (char *)RL_CALLOC(1024*1024, 1);    // Allocate 1MB for text data
+                const char *heatmapFileName = IsFileExtension(outFileName, ".png")? outFileName : "compare.png";
 
-                    const char *value = NULL;
-                    int valueSize = 0;
+                BeginTraceSpan("png encode");
+                ExportImage(heatmap, heatmapFileName);
+                EndTraceSpan();
 
-                    for (int i = 0, k = 0; i < codepointListCount; i++, k += valueSize)
-                    {
-                        value = CodepointToUTF8(codepointList[i], &valueSize);
+                printf("Heatmap file:     %s\n", heatmapFileName);
+                result = 1;
+            }
 
-                        for (int c = 0; c < valueSize; c++) textData[k + c] = value[c];
-                    }
+            UnloadImage(heatmap);
+        }
+        else
+        {
+            // NOTE: Distinct exit code, a missing or corrupted input must not pass as an identical table
+            printf("ERROR: Compare files could not be loaded: %s | %s\n", compareFileNames[0], compareFileNames[1]);
+            result = 2;
+        }
 
-                    // Save charset data
-                    SaveFileText(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)), textData);
+        UnloadImage(imageA);
+        UnloadImage(imageB);
+    }
 
-                    RL_FREE(textData);
-                }
+    if (traceFileName[0] != '\0') CloseTrace(traceFileName);
 
-                fprintf(rgsFile, "# WARNING: This style uses a custom font, must be provided with style file\n#\n");
+    RL_FREE(batchCommands);
+    RL_FREE(inFileNames);
 
-                if (FileExists(TextFormat("%s/charset.txt", GetDirectoryPath(fileName))))   // Check charset.txt saved successfully
-                {
-                    fprintf(rgsFile, "f %i %s %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), "charset.txt", GetFileName(inFontFileName));
-                }
-                else fprintf(rgsFile, "f %i 0 %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), GetFileName(inFontFileName));
-            }
+    if (IsWindowReady()) CloseWindow();     // Close hidden window, created for batch script font loading or styles compare
 
-            // Save DEFAULT properties that changed
-            for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
-            {
-                if (defaultStyle[j] != GuiGetStyle(0, j))
-                {
-                    // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
-                    if (j < RAYGUI_MAX_PROPS_BASE) fprintf(rgsFile, "p 00 %02i 0x%08x    DEFAULT_%s \n", j, GuiGetStyle(0, j), guiPropsText[j]);
-                    else  fprintf(rgsFile, "p 00 %02i 0x%08x    %s \n", j, GuiGetStyle(0, j), guiPropsDefaultExtendedText[j - RAYGUI_MAX_PROPS_BASE]);
-                }
-            }
+    if (showUsageInfo) ShowCommandLineInfo();
 
-            // Save other controls properties that changed
-            for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
-            {
-                for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
-                {
-                    // Check all properties that have changed in comparison to default style and add custom style sets for those properties
-                    if ((defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j)) && (GuiGetStyle(i, j) !=  GuiGetStyle(0, j)))
-                    {
-                        // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
-                        fprintf(rgsFile, "p %02i %02i 0x%08x    %s_%s \n", i, j, GuiGetStyle(i, j), guiControlText[i], (j < RAYGUI_MAX_PROPS_BASE)? guiPropsText[j] : TextFormat("EXT%02i", (j - RAYGUI_MAX_PROPS_BASE)));
-                    }
-                }
-            }
+    return result;
+}
+#endif      // PLATFORM_DESKTOP
 
-            fclose(rgsFile);
-            result = 1;
-        }
-    }
+//--------------------------------------------------------------------------------------------
+// Load/Save/Export data functions
+//--------------------------------------------------------------------------------------------
+// Save current style to memory data array
+// NOTE: Style data is written by rgs library, only font atlas image is retrieved/encoded by raylib
+// WARNING: Using globals: fontEmbeddedChecked, fontDataCompressedChecked, propsCompactChecked
+static unsigned char *SaveStyleToMemory(int *size)
+{
+    int flags = 0;
+    if (propsCompactChecked) flags |= RGS_SAVE_PROPS_COMPACT;
+    if (fontDataCompressedChecked) flags |= RGS_SAVE_FONT_DATA_COMPRESSED;
+#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
+    // NOTE: If data is compressed using DEFLATE, it requires to be decompressed with
+    // raylib DecompressData(), that requires compiling raylib with SUPPORT_COMPRESSION_API
+    flags |= RGS_SAVE_FONT_ATLAS_COMPRESSED;
+#endif
 
-    return result;
+    rgs_style style = { 0 };
+    GetStyleCoreData(&style, (fontEmbeddedChecked && customFontLoaded));
+
+    unsigned char *buffer = rgs_save_to_memory(&style, flags, size);
+
+    rgs_unload(&style);
+
+    return buffer;
 }
 
-// Export gui style as (ready-to-use) code file
-// NOTE: Code file already implements a function to load style
-static void ExportStyleAsCode(const char *fileName, const char *styleName)
+// Get current style data (properties changed, font and icons) into rgs style
+// NOTE: Font atlas image is retrieved from GPU and encoded into GPU blocks if required
+// WARNING: Using globals: defaultStyle, customFont, fontWhiteRec, fontAtlasBlockFormat
+static void GetStyleCoreData(rgs_style *style, bool fontEmbedded)
 {
-    // DEFAULT extended properties
-    static const char *guiPropsExtText[RAYGUI_MAX_PROPS_EXTENDED] = {
-        "TEXT_SIZE",
-        "TEXT_SPACING",
-        "LINE_COLOR",
-        "BACKGROUND_COLOR",
-        "TEXT_LINE_SPACING",
-        "TEXT_ALIGNMENT_VERTICAL",
-        "TEXT_WRAP_MODE",
-        "EXTENDED08",
-    };
+    // Get all properties changed
+    // NOTE: First all properties that have changed in DEFAULT style, then
+    // all properties that have changed in comparison to DEFAULT style
+    for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+    {
+        if (defaultStyle[i] != GuiGetStyle(0, i)) rgs_set_property(style, 0, i, (unsigned int)GuiGetStyle(0, i));
+    }
+
+    rgs_property changes[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+    int changesCount = GetStyleControlsChanges(defaultStyle, changes);
 
-    FILE *txtFile = fopen(fileName, "wt");
+    for (int i = 0; i < changesCount; i++) rgs_set_property(style, changes[i].control_id, changes[i].property_id, changes[i].value);
 
-    if (txtFile != NULL)
+    if (fontEmbedded)
     {
-        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// StyleAsCode exporter v2.0 - Style data exported as a values array            //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// USAGE: On init call: GuiLoadStyle%s();                                   //\n", TextToPascal(styleName));
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// more info and bugs-report:  github.com/raysan5/raygui                        //\n");
-        fprintf(txtFile, "// feedback and support:       ray[at]raylibtech.com                            //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "// Copyright (c) 2020-2023 raylib technologies (@raylibtech)                    //\n");
-        fprintf(txtFile, "//                                                                              //\n");
-        fprintf(txtFile, "//////////////////////////////////////////////////////////////////////////////////\n\n");
+        Image imFont = LoadImageFromTexture(customFont.texture);
 
-        char styleNameLower[64] = { 0 };
-        strcpy(styleNameLower, TextToLower(styleName));
+        // Encode font atlas into GPU blocks if required, loaded directly by GPU (if supported)
+        if (fontAtlasBlockFormat == 1) ImageFontAtlasCompress(&imFont, PIXELFORMAT_COMPRESSED_DXT5_RGBA);
+        else if (fontAtlasBlockFormat == 2) ImageFontAtlasCompress(&imFont, PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA);
 
-        // Export only properties that change from default style
-        fprintf(txtFile, "#define %s_STYLE_PROPS_COUNT  %i\n\n", TextToUpper(styleName), StyleChangesCounter(defaultStyle));
+        // Make sure font atlas image data is GRAY + ALPHA for better compression (if not block compressed)
+        if ((imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) && (imFont.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)) ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
 
-        // Write byte data as hexadecimal text
-        fprintf(txtFile, "// Custom style name: %s\n", styleName);
-        fprintf(txtFile, "static const GuiStyleProp %sStyleProps[%s_STYLE_PROPS_COUNT] = {\n", styleNameLower, TextToUpper(styleName));
+        // NOTE: Image data ownership moved to style, unloaded by rgs_unload()
+        style->font.type = 0;       // 0-NORMAL, 1-SDF
+        style->font.white_rec = (rgs_rectangle){ fontWhiteRec.x, fontWhiteRec.y, fontWhiteRec.width, fontWhiteRec.height };
+        style->font.atlas_width = imFont.width;
+        style->font.atlas_height = imFont.height;
+        style->font.atlas_format = imFont.format;
+        style->font.atlas_size = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+        style->font.atlas_data = (unsigned char *)imFont.data;
 
-        // Write all properties that have changed in default style
-        for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+        // Get font faces data, main font and faces packed into main font atlas
+        for (int f = 0; f < RAYGUI_MAX_FONT_FACES; f++)
         {
-            if (defaultStyle[i] != GuiGetStyle(0, i))
+            Font face = (f == 0)? customFont : GuiGetFontFace(f);
+
+            if ((face.glyphCount <= 0) || (face.texture.id != customFont.texture.id)) continue;
+
+            rgs_font_face *styleFace = &style->font.faces[f];
+            styleFace->base_size = face.baseSize;
+            styleFace->glyph_count = face.glyphCount;
+            styleFace->recs = (rgs_rectangle *)RL_MALLOC(face.glyphCount*sizeof(rgs_rectangle));
+            styleFace->glyphs = (rgs_glyph *)RL_MALLOC(face.glyphCount*sizeof(rgs_glyph));
+
+            for (int i = 0; i < face.glyphCount; i++)
             {
-                if (i < RAYGUI_MAX_PROPS_BASE) fprintf(txtFile, "    { 0, %i, 0x%08x },    // DEFAULT_%s \n", i, GuiGetStyle(DEFAULT, i), guiPropsText[i]);
-                else fprintf(txtFile, "    { 0, %i, 0x%08x },    // DEFAULT_%s \n", i, GuiGetStyle(DEFAULT, i), guiPropsExtText[i - RAYGUI_MAX_PROPS_BASE]);
+                styleFace->recs[i] = (rgs_rectangle){ face.recs[i].x, face.recs[i].y, face.recs[i].width, face.recs[i].height };
+                styleFace->glyphs[i] = (rgs_glyph){ face.glyphs[i].value, face.glyphs[i].offsetX, face.glyphs[i].offsetY, face.glyphs[i].advanceX };
             }
         }
+    }
 
-        // Add to count all properties that have changed in comparison to default style
-        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
+    // Get custom icons, only icons changed from default icons
+    style->icon_count = StyleIconsChangesCounter(style->icons_map);
+
+    if (style->icon_count > 0)
+    {
+        style->icons_data = (unsigned int *)RL_MALLOC(style->icon_count*RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+
+        for (int i = 0, k = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
         {
-            for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+            if (style->icons_map[i/8] & (1 << (i%8)))
             {
-                if ((defaultStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j)) && (GuiGetStyle(i, j) !=  GuiGetStyle(0, j)))
-                {
-                    if (j < RAYGUI_MAX_PROPS_BASE) fprintf(txtFile, "    { %i, %i, 0x%08x },    // %s_%s \n", i, j, GuiGetStyle(i, j), guiControlText[i], guiPropsText[j]);
-                    else fprintf(txtFile, "    { %i, %i, 0x%08x },    // %s_%s \n", i, j, GuiGetStyle(i, j), guiControlText[i], TextFormat("EXTENDED%02i", j - RAYGUI_MAX_PROPS_BASE + 1));
-                }
+                memcpy(style->icons_data + k*RAYGUI_ICON_DATA_ELEMENTS, GuiGetIcons() + i*RAYGUI_ICON_DATA_ELEMENTS, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int));
+                k++;
             }
         }
+    }
+}
+
+// Compress font atlas image into GPU blocks: DXT5 (BC4 alpha) or ETC2_EAC (EAC alpha)
+// NOTE: Font atlas color is white, only alpha is encoded (rgs library), color blocks are constant white
+static void ImageFontAtlasCompress(Image *image, int format)
+{
+    if ((image->data == NULL) || ((format != PIXELFORMAT_COMPRESSED_DXT5_RGBA) && (format != PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA))) return;
 
-        fprintf(txtFile, "};\n\n");
+    if (((image->width%4) != 0) || ((image->height%4) != 0))
+    {
+        LOG("WARNING: Font atlas size not multiple of 4, block compression not possible\n");
+        return;
+    }
+
+    Color *pixels = LoadImageColors(*image);
+    unsigned char *alpha = (unsigned char *)RL_MALLOC(image->width*image->height);
+
+    for (int i = 0; i < image->width*image->height; i++) alpha[i] = pixels[i].a;
+
+    unsigned char *data = rgs_font_atlas_encode(alpha, image->width, image->height, format);
+
+    RL_FREE(alpha);
+    UnloadImageColors(pixels);
+
+    if (data != NULL)
+    {
+        RL_FREE(image->data);
+
+        image->data = data;
+        image->mipmaps = 1;
+        image->format = format;
+    }
+}
+
+// Subset TrueType font, keeping only the glyphs required by provided codepoints
+// NOTE: Glyphs are renumbered (composite glyphs components kept), cmap rebuilt as format 12,
+// glyph-indexed layout tables (kern, GPOS, GSUB...) are dropped, CFF outlines (.otf) not supported
+static unsigned char *SubsetFontTTF(const unsigned char *fontData, int fontDataSize, const int *codepoints, int codepointCount, int *subsetSize)
+{
+    // Tables kept, sorted by tag as required by tables directory
+    enum { TTF_OS2 = 0, TTF_CMAP, TTF_CVT, TTF_FPGM, TTF_GASP, TTF_GLYF, TTF_HEAD, TTF_HHEA, TTF_HMTX, TTF_LOCA, TTF_MAXP, TTF_NAME, TTF_POST, TTF_PREP, TTF_TABLES_COUNT };
+    static const char *tableTags[TTF_TABLES_COUNT] = { "OS/2", "cmap", "cvt ", "fpgm", "gasp", "glyf", "head", "hhea", "hmtx", "loca", "maxp", "name", "post", "prep" };
+
+    const unsigned char *tables[TTF_TABLES_COUNT] = { 0 };
+    unsigned int tablesSize[TTF_TABLES_COUNT] = { 0 };
+
+    *subsetSize = 0;
+
+    // Check TrueType outlines font (CFF fonts start with 'OTTO' and collections with 'ttcf')
+    if ((fontData == NULL) || (fontDataSize < 12) || ((TTF_READ_U32(fontData) != 0x00010000) && (TTF_READ_U32(fontData) != 0x74727565))) return NULL;
 
-        if (customFontLoaded)
+    int numTables = TTF_READ_U16(fontData + 4);
+
+    for (int i = 0; (i < numTables) && ((12 + i*16 + 16) <= fontDataSize); i++)
+    {
+        const unsigned char *record = fontData + 12 + i*16;
+        unsigned int offset = TTF_READ_U32(record + 8);
+        unsigned int length = TTF_READ_U32(record + 12);
+
+        if ((offset > (unsigned int)fontDataSize) || (length > ((unsigned int)fontDataSize - offset))) continue;
+
+        for (int t = 0; t < TTF_TABLES_COUNT; t++)
         {
-            fprintf(txtFile, "// WARNING: This style uses a custom font: \"%s\" (size: %i, spacing: %i)\n\n",
-                    GetFileName(inFontFileName), GuiGetStyle(DEFAULT, TEXT_SIZE), GuiGetStyle(DEFAULT, TEXT_SPACING));
+            if (memcmp(record, tableTags[t], 4) == 0) { tables[t] = fontData + offset; tablesSize[t] = length; }
         }
+    }
 
-        Image imFont = { 0 };
+    // Check required tables
+    if ((tables[TTF_CMAP] == NULL) || (tables[TTF_GLYF] == NULL) || (tables[TTF_LOCA] == NULL) || (tables[TTF_HMTX] == NULL) ||
+        (tables[TTF_HEAD] == NULL) || (tablesSize[TTF_HEAD] < 54) || (tables[TTF_HHEA] == NULL) || (tablesSize[TTF_HHEA] < 36) ||
+        (tables[TTF_MAXP] == NULL) || (tablesSize[TTF_MAXP] < 6)) return NULL;
 
-        if (customFontLoaded)
-        {
-            // Support font export and initialization
-            // NOTE: This mechanism is highly coupled to raylib
-            imFont = LoadImageFromTexture(customFont.texture);
-            if (imFont.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) LOG("WARNING: Font image format is not GRAY+ALPHA!");
-            int imFontSize = GetPixelDataSize(imFont.width, imFont.height, imFont.format);
+    int numGlyphs = TTF_READ_U16(tables[TTF_MAXP] + 4);
+    int numHMetrics = TTF_READ_U16(tables[TTF_HHEA] + 34);
+    int locaFormat = TTF_READ_U16(tables[TTF_HEAD] + 50);   // 0-Short offsets (x2), 1-Long offsets
 
-            #define BYTES_TEXT_PER_LINE     20
+    if ((numGlyphs == 0) || (numHMetrics == 0) || (numHMetrics > numGlyphs) ||
+        (tablesSize[TTF_HMTX] < (unsigned int)(numHMetrics*4 + (numGlyphs - numHMetrics)*2)) ||
+        (tablesSize[TTF_LOCA] < (unsigned int)((numGlyphs + 1)*((locaFormat == 0)? 2 : 4)))) return NULL;
 
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            // NOTE: If data is compressed using raylib CompressData() DEFLATE,
-            // it requires to be decompressed with raylib DecompressData(), that requires
-            // compiling raylib with SUPPORT_COMPRESSION_API config flag enabled
-
-            // Font image data is usually GRAYSCALE + ALPHA
-
-            // Compress font image data
-            int compDataSize = 0;
-            unsigned char *compData = CompressData(imFont.data, imFontSize, &compDataSize);
-
-            // Save font image data (compressed)
-            fprintf(txtFile, "#define %s_STYLE_FONT_ATLAS_COMP_SIZE %i\n\n", TextToUpper(styleName), compDataSize);
-            fprintf(txtFile, "// Font atlas image pixels data: DEFLATE compressed\n");
-            fprintf(txtFile, "static unsigned char %sFontData[%s_STYLE_FONT_ATLAS_COMP_SIZE] = { ", styleNameLower, TextToUpper(styleName));
-            for (int i = 0; i < compDataSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%02x,\n    " : "0x%02x, "), compData[i]);
-            fprintf(txtFile, "0x%02x };\n\n", compData[compDataSize - 1]);
-            MemFree(compData);
-#else
-            // Save font image data (uncompressed)
-            fprintf(txtFile, "// Font image pixels data\n");
-            fprintf(txtFile, "static unsigned char %sFontImageData[%i] = { ", styleNameLower, imFontSize);
-            for (int i = 0; i < imFontSize - 1; i++) fprintf(txtFile, ((i%BYTES_TEXT_PER_LINE == 0)? "0x%02x,\n    " : "0x%02x, "), ((unsigned char *)imFont.data)[i]);
-            fprintf(txtFile, "0x%02x };\n\n", ((unsigned char *)imFont.data)[imFontSize - 1]);
-#endif
-            // Save font recs data
-            fprintf(txtFile, "// Font glyphs rectangles data (on atlas)\n");
-            fprintf(txtFile, "static const Rectangle %sFontRecs[%i] = {\n", styleNameLower, customFont.glyphCount);
-            for (int i = 0; i < customFont.glyphCount; i++)
-            {
-                fprintf(txtFile, "    { %1.0f, %1.0f, %1.0f , %1.0f },\n", customFont.recs[i].x, customFont.recs[i].y, customFont.recs[i].width, customFont.recs[i].height);
-            }
-            fprintf(txtFile, "};\n\n");
+    // Select cmap Unicode subtable, format 12 (full Unicode) preferred over format 4 (BMP only)
+    const unsigned char *cmap = tables[TTF_CMAP];
+    const unsigned char *cmapEnd = cmap + tablesSize[TTF_CMAP];
+    const unsigned char *cmapSubtable = NULL;
 
-            // Save font glyphs data
-            // NOTE: Individual glyphs image data not saved, it could be generated from atlas and recs
-            fprintf(txtFile, "// Font glyphs info data\n");
-            fprintf(txtFile, "// NOTE: No glyphs.image data provided\n");
-            fprintf(txtFile, "static const GlyphInfo %sFontGlyphs[%i] = {\n", styleNameLower, customFont.glyphCount);
-            for (int i = 0; i < customFont.glyphCount; i++)
-            {
-                fprintf(txtFile, "    { %i, %i, %i, %i, { 0 }},\n", customFont.glyphs[i].value, customFont.glyphs[i].offsetX, customFont.glyphs[i].offsetY, customFont.glyphs[i].advanceX);
-            }
-            fprintf(txtFile, "};\n\n");
+    for (int i = 0; (i < (int)TTF_READ_U16(cmap + 2)) && ((cmap + 4 + i*8 + 8) <= cmapEnd); i++)
+    {
+        int platformId = TTF_READ_U16(cmap + 4 + i*8);
+        int encodingId = TTF_READ_U16(cmap + 4 + i*8 + 2);
+        unsigned int offset = TTF_READ_U32(cmap + 4 + i*8 + 4);
+
+        if ((offset + 16) > tablesSize[TTF_CMAP]) continue;
+        if ((platformId != 0) && !((platformId == 3) && ((encodingId == 1) || (encodingId == 10)))) continue;
+
+        int format = TTF_READ_U16(cmap + offset);
 
-            UnloadImage(imFont);
+        if (format == 12) { cmapSubtable = cmap + offset; break; }
+        else if ((format == 4) && (cmapSubtable == NULL)) cmapSubtable = cmap + offset;
+    }
+
+    if (cmapSubtable == NULL) return NULL;
+
+    // Load glyphs offsets from loca
+    unsigned int *glyphOffsets = (unsigned int *)RL_MALLOC((numGlyphs + 1)*sizeof(unsigned int));
+
+    for (int i = 0; i <= numGlyphs; i++)
+    {
+        glyphOffsets[i] = (locaFormat == 0)? TTF_READ_U16(tables[TTF_LOCA] + i*2)*2 : TTF_READ_U32(tables[TTF_LOCA] + i*4);
+        if (glyphOffsets[i] > tablesSize[TTF_GLYF]) glyphOffsets[i] = tablesSize[TTF_GLYF];
+    }
+
+    // Select glyphs to keep: .notdef, codepoints glyphs (codepoint sorted) and composite glyphs components
+    // NOTE: glyphMap maps source glyph index to subset glyph index + 1 (0 if not kept)
+    int *glyphMap = (int *)RL_CALLOC(numGlyphs, sizeof(int));
+    int *glyphIds = (int *)RL_MALLOC(numGlyphs*sizeof(int));
+    int *sortedCodepoints = (int *)RL_MALLOC((codepointCount + 1)*sizeof(int));
+    int glyphCount = 1;
+
+    glyphIds[0] = 0;
+    glyphMap[0] = 1;
+
+    // Insertion sort, codepoints lists are usually already sorted
+    for (int i = 0; i < codepointCount; i++)
+    {
+        int k = i;
+        while ((k > 0) && (sortedCodepoints[k - 1] > codepoints[i])) { sortedCodepoints[k] = sortedCodepoints[k - 1]; k--; }
+        sortedCodepoints[k] = codepoints[i];
+    }
+
+    for (int i = 0; i < codepointCount; i++)
+    {
+        int glyphId = GetGlyphIndexTTF(cmapSubtable, cmapEnd, sortedCodepoints[i]);
+
+        if ((glyphId > 0) && (glyphId < numGlyphs) && (glyphMap[glyphId] == 0))
+        {
+            glyphIds[glyphCount] = glyphId;
+            glyphMap[glyphId] = ++glyphCount;
         }
+    }
 
-        fprintf(txtFile, "// Style loading function: %s\n", styleName);
-        fprintf(txtFile, "static void GuiLoadStyle%s(void)\n{\n", TextToPascal(styleName));
-        fprintf(txtFile, "    // Load style properties provided\n");
-        fprintf(txtFile, "    // NOTE: Default properties are propagated\n");
-        fprintf(txtFile, "    for (int i = 0; i < %s_STYLE_PROPS_COUNT; i++)\n    {\n", TextToUpper(styleName));
-        fprintf(txtFile, "        GuiSetStyle(%sStyleProps[i].controlId, %sStyleProps[i].propertyId, %sStyleProps[i].propertyValue);\n    }\n\n", styleNameLower, styleNameLower, styleNameLower);
+    // NOTE: Components added are also checked, nested composite glyphs are supported
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int components[64] = { 0 };
+        const unsigned char *glyph = tables[TTF_GLYF] + glyphOffsets[glyphIds[i]];
+        int glyphSize = (glyphOffsets[glyphIds[i] + 1] > glyphOffsets[glyphIds[i]])? (int)(glyphOffsets[glyphIds[i] + 1] - glyphOffsets[glyphIds[i]]) : 0;
+        int componentCount = GetGlyphComponentsTTF(glyph, glyphSize, components, 64);
 
-        if (customFontLoaded)
+        for (int c = 0; c < componentCount; c++)
         {
-            fprintf(txtFile, "    // Custom font loading\n");
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            fprintf(txtFile, "    // NOTE: Compressed font image data (DEFLATE), it requires DecompressData() function\n");
-            fprintf(txtFile, "    int %sFontDataSize = 0;\n", styleNameLower);
-            fprintf(txtFile, "    unsigned char *data = DecompressData(%sFontData, %s_STYLE_FONT_ATLAS_COMP_SIZE, &%sFontDataSize);\n", styleNameLower, TextToUpper(styleName), styleNameLower);
-            fprintf(txtFile, "    Image imFont = { data, %i, %i, 1, %i };\n\n", imFont.width, imFont.height, imFont.format);
-            //fprintf(txtFile, "    ImageFormat(&imFont, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
-#else
-            fprintf(txtFile, "    Image imFont = { %sFontImageData, %i, %i, 1, %i };\n\n", styleNameLower, imFont.width, imFont.height, imFont.format);
-#endif
-            fprintf(txtFile, "    Font font = { 0 };\n");
-            fprintf(txtFile, "    font.baseSize = %i;\n", GuiGetStyle(DEFAULT, TEXT_SIZE));
-            fprintf(txtFile, "    font.glyphCount = %i;\n\n", customFont.glyphCount);
+            int glyphId = TTF_READ_U16(glyph + components[c]);
 
-            fprintf(txtFile, "    // Load texture from image\n");
-            fprintf(txtFile, "    font.texture = LoadTextureFromImage(imFont);\n");
-#if defined(SUPPORT_COMPRESSED_FONT_ATLAS)
-            fprintf(txtFile, "    UnloadImage(imFont);  // Uncompressed image data can be unloaded from memory\n\n");
-#else
-            fprintf(txtFile, "    // WARNING: Uncompressed global image data can not be freed\n\n");
-#endif
-            /*
-            // Assign global recs/glyphs data to loaded font
-            // NOTE: DO NOT DO THAT! GuiLoadStyleDefault() frees memory for styles loaded (other than default)
-            // it can be used to reset/free any previous loaded style to default before loading a new one
-            fprintf(txtFile, "    // Assign char recs data to global fontRecs\n");
-            fprintf(txtFile, "    // WARNING: Font char rec data can not be freed\n");
-            fprintf(txtFile, "    font.recs = %sFontRecs;\n\n", styleName);
-
-            fprintf(txtFile, "    // Assign font char info data to global fontChars\n");
-            fprintf(txtFile, "    // WARNING: Font char info data can not be freed\n");
-            fprintf(txtFile, "    font.glyphs = %sFontChars;\n\n", styleName);
-            */
-            fprintf(txtFile, "    // Copy char recs data from global fontRecs\n");
-            fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
-            fprintf(txtFile, "    font.recs = (Rectangle *)RAYGUI_MALLOC(font.glyphCount*sizeof(Rectangle));\n");
-            fprintf(txtFile, "    memcpy(font.recs, %sFontRecs, font.glyphCount*sizeof(Rectangle));\n\n", styleNameLower);
-
-            fprintf(txtFile, "    // Copy font char info data from global fontChars\n");
-            fprintf(txtFile, "    // NOTE: Required to avoid issues if trying to free font\n");
-            fprintf(txtFile, "    font.glyphs = (GlyphInfo *)RAYGUI_MALLOC(font.glyphCount*sizeof(GlyphInfo));\n");
-            fprintf(txtFile, "    memcpy(font.glyphs, %sFontGlyphs, font.glyphCount*sizeof(GlyphInfo));\n\n", styleNameLower);
-
-            fprintf(txtFile, "    GuiSetFont(font);\n\n");
-
-            if ((fontWhiteRec.x > 0) && (fontWhiteRec.y > 0) && (fontWhiteRec.width > 0) && (fontWhiteRec.height > 0))
-            {
-                fprintf(txtFile, "    // Setup a white rectangle on the font to be used on shapes drawing,\n");
-                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
-                fprintf(txtFile, "    Rectangle fontWhiteRec = { %.0f, %.0f, %.0f, %.0f };\n", fontWhiteRec.x, fontWhiteRec.y, fontWhiteRec.width, fontWhiteRec.height);
-                fprintf(txtFile, "    SetShapesTexture(font.texture, fontWhiteRec);\n\n");
-            }
-            else
+            if ((glyphId < numGlyphs) && (glyphMap[glyphId] == 0))
             {
-                fprintf(txtFile, "    // TODO: Setup a white rectangle on the font to be used on shapes drawing,\n");
-                fprintf(txtFile, "    // it makes possible to draw shapes and text (full UI) in a single draw call\n");
-                fprintf(txtFile, "    // NOTE: rGuiStyler provides a visual tool to define this rectangle on loaded font\n");
-                fprintf(txtFile, "    //Rectangle fontWhiteRec = { 0, 0, 0, 0 };\n");
-                fprintf(txtFile, "    //SetShapesTexture(font.texture, fontWhiteRec);\n\n");
+                glyphIds[glyphCount] = glyphId;
+                glyphMap[glyphId] = ++glyphCount;
             }
         }
+    }
+
+    // Generate subset tables
+    unsigned char *subsetTables[TTF_TABLES_COUNT] = { 0 };
+    unsigned int subsetTablesSize[TTF_TABLES_COUNT] = { 0 };
+
+    // Tables not referencing glyph indices are copied as is
+    int copiedTables[] = { TTF_OS2, TTF_CVT, TTF_FPGM, TTF_GASP, TTF_NAME, TTF_PREP, TTF_HEAD, TTF_HHEA, TTF_MAXP };
+
+    for (int i = 0; i < (int)(sizeof(copiedTables)/sizeof(int)); i++)
+    {
+        int t = copiedTables[i];
+        if (tables[t] == NULL) continue;
+
+        subsetTablesSize[t] = tablesSize[t];
+        subsetTables[t] = (unsigned char *)RL_MALLOC(tablesSize[t]);
+        memcpy(subsetTables[t], tables[t], tablesSize[t]);
+    }
 
-        fprintf(txtFile, "    //-----------------------------------------------------------------\n\n");
-        fprintf(txtFile, "    // TODO: Custom user style setup: Set specific properties here (if required)\n");
-        fprintf(txtFile, "    // i.e. Controls specific BORDER_WIDTH, TEXT_PADDING, TEXT_ALIGNMENT\n");
+    TTF_WRITE_U32(subsetTables[TTF_HEAD] + 8, 0);           // Checksum adjustment, computed once font data generated
+    TTF_WRITE_U16(subsetTables[TTF_HEAD] + 50, 1);          // Long loca offsets
+    TTF_WRITE_U16(subsetTables[TTF_HHEA] + 34, glyphCount); // Horizontal metrics provided for all glyphs
+    TTF_WRITE_U16(subsetTables[TTF_MAXP] + 4, glyphCount);
 
-        fprintf(txtFile, "}\n");
+    // Glyph names (post version 2.0) reference glyph indices, version 3.0 provides no names
+    if ((tables[TTF_POST] != NULL) && (tablesSize[TTF_POST] >= 32))
+    {
+        subsetTablesSize[TTF_POST] = 32;
+        subsetTables[TTF_POST] = (unsigned char *)RL_MALLOC(32);
+        memcpy(subsetTables[TTF_POST], tables[TTF_POST], 32);
+        TTF_WRITE_U32(subsetTables[TTF_POST], 0x00030000);
+    }
+
+    // Generate glyf, loca and hmtx tables
+    unsigned int glyfSize = 0;
+    for (int i = 0; i < glyphCount; i++) glyfSize += (((glyphOffsets[glyphIds[i] + 1] > glyphOffsets[glyphIds[i]])? (glyphOffsets[glyphIds[i] + 1] - glyphOffsets[glyphIds[i]]) : 0) + 3) & ~3u;
+
+    subsetTablesSize[TTF_GLYF] = glyfSize;
+    subsetTables[TTF_GLYF] = (unsigned char *)RL_CALLOC(glyfSize + 4, 1);
+    subsetTablesSize[TTF_LOCA] = (glyphCount + 1)*4;
+    subsetTables[TTF_LOCA] = (unsigned char *)RL_MALLOC(subsetTablesSize[TTF_LOCA]);
+    subsetTablesSize[TTF_HMTX] = glyphCount*4;
+    subsetTables[TTF_HMTX] = (unsigned char *)RL_MALLOC(subsetTablesSize[TTF_HMTX]);
+
+    for (int i = 0, offset = 0; i < glyphCount; i++)
+    {
+        int glyphId = glyphIds[i];
+        int glyphSize = (glyphOffsets[glyphId + 1] > glyphOffsets[glyphId])? (int)(glyphOffsets[glyphId + 1] - glyphOffsets[glyphId]) : 0;
+        unsigned char *glyph = subsetTables[TTF_GLYF] + offset;
+
+        memcpy(glyph, tables[TTF_GLYF] + glyphOffsets[glyphId], glyphSize);
+
+        // Remap composite glyph components to subset glyph indices
+        int components[64] = { 0 };
+        int componentCount = GetGlyphComponentsTTF(glyph, glyphSize, components, 64);
+
+        for (int c = 0; c < componentCount; c++)
+        {
+            int componentId = TTF_READ_U16(glyph + components[c]);
+            int subsetId = (componentId < numGlyphs)? (glyphMap[componentId] - 1) : 0;
+            TTF_WRITE_U16(glyph + components[c], subsetId);
+        }
+
+        TTF_WRITE_U32(subsetTables[TTF_LOCA] + i*4, offset);
+        offset += ((glyphSize + 3) & ~3);
+        if (i == (glyphCount - 1)) TTF_WRITE_U32(subsetTables[TTF_LOCA] + glyphCount*4, offset);
+
+        // NOTE: Glyphs over numHMetrics share last advance width, left side bearing provided separately
+        const unsigned char *hmtx = tables[TTF_HMTX];
+        unsigned int advanceWidth = (glyphId < numHMetrics)? TTF_READ_U16(hmtx + glyphId*4) : TTF_READ_U16(hmtx + (numHMetrics - 1)*4);
+        unsigned int leftSideBearing = (glyphId < numHMetrics)? TTF_READ_U16(hmtx + glyphId*4 + 2) : TTF_READ_U16(hmtx + numHMetrics*4 + (glyphId - numHMetrics)*2);
+
+        TTF_WRITE_U16(subsetTables[TTF_HMTX] + i*4, advanceWidth);
+        TTF_WRITE_U16(subsetTables[TTF_HMTX] + i*4 + 2, leftSideBearing);
+    }
+
+    // Generate cmap table: Unicode (0, 4) and Windows (3, 10) records, sharing one format 12 subtable
+    // NOTE: Codepoints are mapped to sequential glyphs on selection, so they are grouped in ranges
+    int groupCount = 0;
+    int *groups = (int *)RL_MALLOC((codepointCount + 1)*3*sizeof(int));     // Group: startCodepoint, endCodepoint, startGlyphId
+
+    for (int i = 0; i < codepointCount; i++)
+    {
+        if ((i > 0) && (sortedCodepoints[i] == sortedCodepoints[i - 1])) continue;
+
+        int glyphId = GetGlyphIndexTTF(cmapSubtable, cmapEnd, sortedCodepoints[i]);
+        if ((glyphId <= 0) || (glyphId >= numGlyphs)) continue;
+
+        int subsetId = glyphMap[glyphId] - 1;
+
+        if ((groupCount > 0) && (groups[(groupCount - 1)*3 + 1] == (sortedCodepoints[i] - 1)) &&
+            ((groups[(groupCount - 1)*3 + 2] + sortedCodepoints[i] - groups[(groupCount - 1)*3]) == subsetId))
+        {
+            groups[(groupCount - 1)*3 + 1] = sortedCodepoints[i];
+        }
+        else
+        {
+            groups[groupCount*3] = sortedCodepoints[i];
+            groups[groupCount*3 + 1] = sortedCodepoints[i];
+            groups[groupCount*3 + 2] = subsetId;
+            groupCount++;
+        }
+    }
+
+    subsetTablesSize[TTF_CMAP] = 20 + 16 + groupCount*12;
+    subsetTables[TTF_CMAP] = (unsigned char *)RL_CALLOC(subsetTablesSize[TTF_CMAP], 1);
+
+    unsigned char *cmapData = subsetTables[TTF_CMAP];
+    TTF_WRITE_U16(cmapData + 2, 2);             // Encoding records count
+    TTF_WRITE_U16(cmapData + 4, 0);             // Platform: Unicode
+    TTF_WRITE_U16(cmapData + 6, 4);             // Encoding: Unicode full repertoire
+    TTF_WRITE_U32(cmapData + 8, 20);
+    TTF_WRITE_U16(cmapData + 12, 3);            // Platform: Windows
+    TTF_WRITE_U16(cmapData + 14, 10);           // Encoding: Unicode full repertoire
+    TTF_WRITE_U32(cmapData + 16, 20);
+    TTF_WRITE_U16(cmapData + 20, 12);           // Subtable format
+    TTF_WRITE_U32(cmapData + 24, 16 + groupCount*12);
+    TTF_WRITE_U32(cmapData + 32, groupCount);
+
+    for (int i = 0; i < groupCount; i++)
+    {
+        TTF_WRITE_U32(cmapData + 36 + i*12, groups[i*3]);
+        TTF_WRITE_U32(cmapData + 36 + i*12 + 4, groups[i*3 + 1]);
+        TTF_WRITE_U32(cmapData + 36 + i*12 + 8, groups[i*3 + 2]);
+    }
+
+    RL_FREE(groups);
+    RL_FREE(sortedCodepoints);
+    RL_FREE(glyphIds);
+    RL_FREE(glyphMap);
+    RL_FREE(glyphOffsets);
+
+    // Generate font data: offset table, tables directory and tables data (4-byte aligned)
+    int tableCount = 0;
+    unsigned int dataSize = 0;
+
+    for (int t = 0; t < TTF_TABLES_COUNT; t++)
+    {
+        if (subsetTables[t] == NULL) continue;
+
+        tableCount++;
+        dataSize += ((subsetTablesSize[t] + 3) & ~3u);
+    }
+
+    int entrySelector = 0;
+    while ((2 << entrySelector) <= tableCount) entrySelector++;
+
+    dataSize += (12 + tableCount*16);
+    unsigned char *subset = (unsigned char *)RL_CALLOC(dataSize, 1);
+
+    TTF_WRITE_U32(subset, 0x00010000);
+    TTF_WRITE_U16(subset + 4, tableCount);
+    TTF_WRITE_U16(subset + 6, (1 << entrySelector)*16);                 // Search range
+    TTF_WRITE_U16(subset + 8, entrySelector);
+    TTF_WRITE_U16(subset + 10, tableCount*16 - (1 << entrySelector)*16); // Range shift
+
+    unsigned int headOffset = 0;
+
+    for (int t = 0, k = 0, offset = 12 + tableCount*16; t < TTF_TABLES_COUNT; t++)
+    {
+        if (subsetTables[t] == NULL) continue;
+
+        memcpy(subset + offset, subsetTables[t], subsetTablesSize[t]);
+
+        unsigned int checksum = 0;
+        for (unsigned int i = 0; i < subsetTablesSize[t]; i += 4) checksum += TTF_READ_U32(subset + offset + i);
+
+        unsigned char *record = subset + 12 + k*16;
+        memcpy(record, tableTags[t], 4);
+        TTF_WRITE_U32(record + 4, checksum);
+        TTF_WRITE_U32(record + 8, offset);
+        TTF_WRITE_U32(record + 12, subsetTablesSize[t]);
+
+        if (t == TTF_HEAD) headOffset = offset;
+
+        offset += ((subsetTablesSize[t] + 3) & ~3u);
+        k++;
+
+        RL_FREE(subsetTables[t]);
+    }
+
+    // Font checksum adjustment (head), whole font checksum must be 0xb1b0afba
+    unsigned int fontChecksum = 0;
+    for (unsigned int i = 0; i < dataSize; i += 4) fontChecksum += TTF_READ_U32(subset + i);
+    TTF_WRITE_U32(subset + headOffset + 8, 0xb1b0afba - fontChecksum);
+
+    *subsetSize = (int)dataSize;
+
+    return subset;
+}
+
+// Get glyph index from cmap subtable (format 4 or 12)
+static int GetGlyphIndexTTF(const unsigned char *cmapSubtable, const unsigned char *cmapEnd, int codepoint)
+{
+    int glyphId = 0;
+    int format = TTF_READ_U16(cmapSubtable);
+
+    if (format == 4)
+    {
+        // Segments mapping to delta values (BMP only)
+        if ((codepoint < 0) || (codepoint > 0xffff)) return 0;
+
+        int segCount = TTF_READ_U16(cmapSubtable + 6)/2;
+        const unsigned char *endCodes = cmapSubtable + 14;
+        const unsigned char *startCodes = endCodes + segCount*2 + 2;
+        const unsigned char *idDeltas = startCodes + segCount*2;
+        const unsigned char *idRangeOffsets = idDeltas + segCount*2;
+
+        if ((idRangeOffsets + segCount*2) > cmapEnd) return 0;
+
+        for (int i = 0; i < segCount; i++)
+        {
+            if ((int)TTF_READ_U16(endCodes + i*2) < codepoint) continue;
+
+            int startCode = TTF_READ_U16(startCodes + i*2);
+            int idDelta = TTF_READ_U16(idDeltas + i*2);
+            int idRangeOffset = TTF_READ_U16(idRangeOffsets + i*2);
+
+            if (startCode > codepoint) break;
+
+            if (idRangeOffset == 0) glyphId = (codepoint + idDelta) & 0xffff;
+            else
+            {
+                // NOTE: Glyph index address is relative to idRangeOffset entry
+                const unsigned char *glyphIdPtr = idRangeOffsets + i*2 + idRangeOffset + (codepoint - startCode)*2;
+
+                if ((glyphIdPtr + 2) <= cmapEnd)
+                {
+                    glyphId = TTF_READ_U16(glyphIdPtr);
+                    if (glyphId != 0) glyphId = (glyphId + idDelta) & 0xffff;
+                }
+            }
+            break;
+        }
+    }
+    else if (format == 12)
+    {
+        // Segmented coverage, groups sorted by start codepoint (binary search)
+        int groupCount = (int)TTF_READ_U32(cmapSubtable + 12);
+        const unsigned char *groups = cmapSubtable + 16;
+
+        if ((groupCount < 0) || ((cmapEnd - groups)/12 < groupCount)) return 0;
+
+        int low = 0, high = groupCount - 1;
+
+        while (low <= high)
+        {
+            int mid = (low + high)/2;
+            unsigned int startCode = TTF_READ_U32(groups + mid*12);
+            unsigned int endCode = TTF_READ_U32(groups + mid*12 + 4);
+
+            if ((unsigned int)codepoint < startCode) high = mid - 1;
+            else if ((unsigned int)codepoint > endCode) low = mid + 1;
+            else
+            {
+                glyphId = (int)(TTF_READ_U32(groups + mid*12 + 8) + (codepoint - startCode));
+                break;
+            }
+        }
+    }
+
+    return glyphId;
+}
+
+// Get composite glyph components, offsets (from glyph start) to components glyph index
+// NOTE: Simple glyphs (numberOfContours >= 0) have no components
+static int GetGlyphComponentsTTF(const unsigned char *glyph, int glyphSize, int *components, int maxComponents)
+{
+    int count = 0;
+
+    if ((glyphSize < 10) || ((short)TTF_READ_U16(glyph) >= 0)) return 0;
+
+    int offset = 10;
+    unsigned int flags = 0;
+
+    do
+    {
+        if ((offset + 4) > glyphSize) break;
+
+        flags = TTF_READ_U16(glyph + offset);
+        components[count] = offset + 2;
+        count++;
+
+        offset += 4;
+        offset += (flags & 0x0001)? 4 : 2;          // ARG_1_AND_2_ARE_WORDS
+        if (flags & 0x0008) offset += 2;            // WE_HAVE_A_SCALE
+        else if (flags & 0x0040) offset += 4;       // WE_HAVE_AN_X_AND_Y_SCALE
+        else if (flags & 0x0080) offset += 8;       // WE_HAVE_A_TWO_BY_TWO
+
+    } while ((flags & 0x0020) && (count < maxComponents));     // MORE_COMPONENTS
+
+    return count;
+}
+
+// Load text style font (.rgs text 'f' line), called by raygui GuiLoadStyle()
+// NOTE: Font atlas loaded from font atlas cache if available, same as tool loaded fonts
+static Font LoadStyleFont(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+    if (LoadFontFaces(fileName, &fontSize, 1, codepoints, codepointCount, &font) != 1) font = (Font){ 0 };
+
+    return font;
+}
+
+// Save raygui style binary file (.rgs)
+// NOTE: By default style is saved as binary file but
+// a text style mode is also available for debug (no font embedding)
+static int SaveStyle(const char *fileName, int format)
+{
+    #define GUI_STYLE_RGS_VERSION   400
+
+    int result = 0;
+
+    if (format == STYLE_BINARY)
+    {
+        // Style File Structure (.rgs)
+        // ------------------------------------------------------
+        // Offset  | Size    | Type       | Description
+        // ------------------------------------------------------
+        // 0       | 4       | char       | Signature: "rGS "
+        // 4       | 2       | short      | Version: 200, 400, 410 (properties compact encoding)
+        // 6       | 2       | short      | Flags: 0x01-Properties compact encoding (version 410)
+        // 8       | 4       | int        | Num properties (only changed ones from default style)
+
+        // Properties Data: (controlId (2 byte) +  propertyId (2 byte) + propertyValue (4 bytes))*N
+        // foreach (property)
+        // {
+        //   8+8*i  | 2       | short      | ControlId
+        //   8+8*i  | 2       | short      | PropertyId
+        //   8+8*i  | 4       | int        | PropertyValue
+        // }
+
+        // Properties Data (compact encoding, version 410 and flag 0x01 set)
+        // NOTE: Values repeated across properties (usually colors) are referenced from a dictionary
+        //   12     | 1-5     | varint     | Num colors in dictionary (C)
+        //   ...    | 4*C     | int        | Dictionary colors, sorted by usage
+        // foreach (property)
+        // {
+        //   ...    | 1       | byte       | ControlId << 4 | (PropertyId & 0x0f)
+        //   ...    | 1-10    | varint     | Payload << 2 | (PropertyId >= 16) << 1 | Dictionary reference
+        // }
+        // NOTE: Payload is a dictionary index or the zigzag-encoded property value
+
+        // Custom Font Data : Parameters (32 bytes)
+        // 16+4*N  | 4       | int        | Font data size (0 - no font, no more fields added!)
+        // 20+4*N  | 4       | int        | Font base size
+        // 24+4*N  | 4       | int        | Font glyph count [glyphCount]
+        // 28+4*N  | 4       | int        | Font type (0-NORMAL, 1-SDF)
+        // 32+4*N  | 16      | Rectangle  | Font white rectangle
+
+        // Custom Font Data : Image (20 bytes + imData)
+        // NOTE: Font image atlas is always converted to GRAY+ALPHA
+        // and atlas image data can be compressed (DEFLATE)
+        // 48+4*N  | 4       | int        | Image data size (uncompressed)
+        // 52+4*N  | 4       | int        | Image data size (compressed)
+        // 56+4*N  | 4       | int        | Image width
+        // 60+4*N  | 4       | int        | Image height
+        // 64+4*N  | 4       | int        | Image format
+        // 68+4*N  | imSize  | *          | Image data (comp or uncomp)
+
+        // Custom Font Data : Recs (32 bytes*glyphCount)
+        // NOTE: Font recs data can be compressed (DEFLATE)
+        // if (version >= 400)
+        // {
+        //    ...  | 4       | int       | Recs data compressed size (0 - not compressed)
+        // }
+        // NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
+        // foreach (glyph)
+        // {
+        //    ...  | 16      | Rectangle  | Glyph rectangle (in image)
+        // }
+
+        // Custom Font Data : Glyph Info (32 bytes*glyphCount)
+        // NOTE: Font glyphs info data can be compressed (DEFLATE)
+        // if (version >= 400)
+        // {
+        //    ...  | 4       | int       | Glyphs data compressed size (0 - not compressed)
+        // }
+        // NOTE: Uncompressed size can be calculated: (glyphCount*16 byte)
+        // foreach (glyph)
+        // {
+        //   ...   | 4       | int        | Glyph value
+        //   ...   | 4       | int        | Glyph offset X
+        //   ...   | 4       | int        | Glyph offset Y
+        //   ...   | 4       | int        | Glyph advance X
+        // }
+
+        // Extension Chunks (optional, after font data)
+        // NOTE: Unknown chunks are skipped by loaders
+        // foreach (chunk)
+        // {
+        //   ...   | 4       | char       | Chunk id: "FNTF" (font faces), "ICNS" (icons)
+        //   ...   | 4       | int        | Chunk data size (S)
+        //   ...   | S       | *          | Chunk data
+        // }
+
+        // Chunk Data: Font Faces ("FNTF")
+        // NOTE: Additional font faces glyphs are packed into custom font atlas
+        //   ...   | 4       | int        | Faces count (F)
+        // foreach (face)
+        // {
+        //   ...   | 4       | int        | Face id (TEXT_FONT_FACE value)
+        //   ...   | 4       | int        | Face base size
+        //   ...   | 4       | int        | Face glyph count
+        //   ...   | 4       | int        | Recs data compressed size (0 - not compressed)
+        //   ...   | *       | Rectangle  | Recs data (same as font recs)
+        //   ...   | 4       | int        | Glyphs data compressed size (0 - not compressed)
+        //   ...   | *       | int        | Glyphs data (same as font glyphs info)
+        // }
+        // ------------------------------------------------------
+
+        int rgsFileDataSize = 0;
+        unsigned char *rgsFileData = SaveStyleToMemory(&rgsFileDataSize);
+
+        result = SaveFileData(fileName, rgsFileData, rgsFileDataSize);
+
+        RL_FREE(rgsFileData);
+    }
+    else if (format == STYLE_TEXT)
+    {
+        FILE *rgsFile = fopen(fileName, "wt");
+
+        if (rgsFile != NULL)
+        {
+            #define RGS_FILE_VERSION_TEXT  "4.0"
+
+            // Write some description comments
+            fprintf(rgsFile, "#\n# rgs style text file (v%s) - raygui style file generated using rGuiStyler\n#\n", RGS_FILE_VERSION_TEXT);
+            fprintf(rgsFile, "# Provided info:\n");
+            fprintf(rgsFile, "#    f fontGenSize charsetFileName fontFileName\n");
+            fprintf(rgsFile, "#    p <controlId> <propertyId> <propertyValue>  Property description\n#\n");
+
+            if (customFontLoaded)
+            {
+                // Save charset into an external file
+                // NOTE: Only saving charset if not basic one (95 codepoints)
+                // WARNING: codepointList and codepointListCount are global variables in gui_window_font_atlas module
+                if (codepointListCount > 95)
+                {
+                    char *textData = (char *)RL_CALLOC(1024*1024, 1);    // Allocate 1MB for text data
+
+                    const char *value = NULL;
+                    int valueSize = 0;
+
+                    for (int i = 0, k = 0; i < codepointListCount; i++, k += valueSize)
+                    {
+                        value = CodepointToUTF8(codepointList[i], &valueSize);
+
+                        for (int c = 0; c < valueSize; c++) textData[k + c] = value[c];
+                    }
+
+                    // Save charset data
+                    SaveFileText(TextFormat("%s/charset.txt", GetDirectoryPath(fileName)), textData);
+
+                    RL_FREE(textData);
+                }
+
+                // Save font subset into an external file, only charset glyphs included
+                // NOTE: Font loading time scales with charset size instead of full font size
+                char fontFileName[256] = { 0 };
+                strcpy(fontFileName, GetFileName(inFontFileName));
+
+                if (fontSubsetChecked)
+                {
+                    int fontDataSize = 0;
+                    unsigned char *fontData = LoadFileData(inFontFileName, &fontDataSize);
+                    int subsetDataSize = 0;
+                    unsigned char *subsetData = NULL;
+
+                    if ((codepointList != NULL) && (codepointListCount > 0)) subsetData = SubsetFontTTF(fontData, fontDataSize, codepointList, codepointListCount, &subsetDataSize);
+                    else
+                    {
+                        // No charset available (i.e. command-line usage), use loaded font glyphs codepoints,
+                        // basic charset (95 codepoints) used as fallback if font glyphs not available
+                        Font font = GuiGetFont();
+                        bool fontGlyphsAvailable = ((font.glyphs != NULL) && (font.glyphCount > 0));
+                        int subsetCodepointCount = fontGlyphsAvailable? font.glyphCount : 95;
+                        int *subsetCodepoints = (int *)RL_CALLOC(subsetCodepointCount, sizeof(int));
+
+                        for (int i = 0; i < subsetCodepointCount; i++) subsetCodepoints[i] = fontGlyphsAvailable? font.glyphs[i].value : (32 + i);
+
+                        subsetData = SubsetFontTTF(fontData, fontDataSize, subsetCodepoints, subsetCodepointCount, &subsetDataSize);
+
+                        RL_FREE(subsetCodepoints);
+                    }
+
+                    if (subsetData != NULL)
+                    {
+                        const char *subsetFileName = TextFormat("%s_subset.ttf", GetFileNameWithoutExt(inFontFileName));
+                        if (SaveFileData(TextFormat("%s/%s", GetDirectoryPath(fileName), subsetFileName), subsetData, subsetDataSize)) strcpy(fontFileName, subsetFileName);
+
+                        RL_FREE(subsetData);
+                    }
+                    else LOG("WARNING: Font subset not supported, TrueType outlines font required\n");
+
+                    UnloadFileData(fontData);
+                }
+
+                fprintf(rgsFile, "# WARNING: This style uses a custom font, must be provided with style file\n#\n");
+
+                if (FileExists(TextFormat("%s/charset.txt", GetDirectoryPath(fileName))))   // Check charset.txt saved successfully
+                {
+                    fprintf(rgsFile, "f %i %s %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), "charset.txt", fontFileName);
+                }
+                else fprintf(rgsFile, "f %i 0 %s\n", GuiGetStyle(DEFAULT, TEXT_SIZE), fontFileName);
+            }
+
+            // Save DEFAULT properties that changed
+            for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+            {
+                if (defaultStyle[j] != GuiGetStyle(0, j))
+                {
+                    // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
+                    if (j < RAYGUI_MAX_PROPS_BASE) fprintf(rgsFile, "p 00 %02i 0x%08x    DEFAULT_%s \n", j, GuiGetStyle(0, j), guiPropsText[j]);
+                    else  fprintf(rgsFile, "p 00 %02i 0x%08x    %s \n", j, GuiGetStyle(0, j), guiPropsDefaultExtendedText[j - RAYGUI_MAX_PROPS_BASE]);
+                }
+            }
+
+            // Save other controls properties that changed in comparison to default style (by control and property order)
+            rgs_property changes[RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)] = { 0 };
+            int changesCount = GetStyleControlsChanges(defaultStyle, changes);
+
+            for (int k = 0; k < changesCount; k++)
+            {
+                int i = changes[k].control_id;
+                int j = changes[k].property_id;
+
+                // NOTE: Control properties are written as hexadecimal values, extended properties names not provided
+                fprintf(rgsFile, "p %02i %02i 0x%08x    %s_%s \n", i, j, changes[k].value, guiControlText[i], (j < RAYGUI_MAX_PROPS_BASE)? guiPropsText[j] : TextFormat("EXT%02i", (j - RAYGUI_MAX_PROPS_BASE)));
+            }
+
+            fclose(rgsFile);
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+// Export gui style as (ready-to-use) code file
+// NOTE: Code file already implements a function to load style, generated by rgs library
+static void ExportStyleAsCode(const char *fileName, const char *styleName)
+{
+    rgs_style style = { 0 };
+    GetStyleCoreData(&style, customFontLoaded);
+
+    int codeSize = 0;
+    char *code = rgs_export_as_code(&style, styleName, &codeSize);
+
+    if (code != NULL) SaveFileText(fileName, code);
+
+    rgs_free(code);
+    rgs_unload(&style);
+}
+
+// Draw controls table image
+static Image GenImageStyleControlsTable(const char *styleName)
+{
+    #define TABLE_LEFT_PADDING      12
+    #define TABLE_TOP_PADDING       20
+
+    #define TABLE_CELL_HEIGHT       40
+    #define TABLE_CELL_PADDING       8          // Control padding inside cell
+
+    #define TABLE_CONTROLS_COUNT    13
+
+    enum TableControlType {
+        TYPE_LABEL = 0,
+        TYPE_BUTTON,
+        TYPE_TOGGLE,
+        TYPE_CHECKBOX,
+        TYPE_SLIDER,
+        TYPE_SLIDERBAR,
+        TYPE_PROGRESSBAR,
+        TYPE_TOGGLESLIDER,
+        TYPE_COMBOBOX,
+        TYPE_DROPDOWNBOX,
+        TYPE_TEXTBOX,
+        TYPE_VALUEBOX,
+        TYPE_SPINNER
+    };
+
+    static const char *tableStateName[4] = { "NORMAL", "FOCUSED", "PRESSED", "DISABLED" };
+    static const char *tableControlsName[TABLE_CONTROLS_COUNT] = {
+        "LABEL",        // LABELBUTTON
+        "BUTTON",
+        "TOGGLE",       // TOGGLEGROUP
+        "CHECKBOX",
+        "SLIDER",
+        "SLIDERBAR",
+        "PROGRESSBAR",
+        "TOGGLESLIDER",
+        "COMBOBOX",
+        "DROPDOWNBOX",
+        "TEXTBOX",      // TEXTBOXMULTI
+        "VALUEBOX",
+        "SPINNER"       // VALUEBOX + BUTTON
+    };
+
+    // Controls grid width
+    int controlWidth[TABLE_CONTROLS_COUNT] = {
+        100,    // LABEL
+        100,    // BUTTON
+        100,    // TOGGLE
+        200,    // CHECKBOX
+        100,    // SLIDER
+        100,    // SLIDERBAR
+        100,    // PROGRESSBAR
+        200,    // TOGGLESLIDER
+        140,    // COMBOBOX,
+        160,    // DROPDOWNBOX
+        100,    // TEXTBOX
+        100,    // VALUEBOX
+        101,    // SPINNER
+    };
+
+    int tableStateNameWidth = 100;   // First column with state name width
+
+    int tableWidth = 0;
+    int tableHeight = 256;
+
+    tableWidth = TABLE_LEFT_PADDING*2 + tableStateNameWidth;
+    for (int i = 0; i < TABLE_CONTROLS_COUNT; i++) tableWidth += ((controlWidth[i] + TABLE_CELL_PADDING*2) - 1);
+
+    // Controls required variables
+    int dropdownActive = 0;
+    int value = 40;
+
+    Rectangle rec = { 0 };      // Current drawing rectangle space
+
+    RenderTexture2D target = LoadRenderTexture(tableWidth, tableHeight);
+
+    int sliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
+    GuiSetStyle(SLIDER, SLIDER_WIDTH, 10);
+
+    // Texture rendering
+    //--------------------------------------------------------------------------------------------
+    BeginTextureMode(target);
+
+        ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+
+        // Draw style title
+        GuiLabel((Rectangle){ TABLE_LEFT_PADDING, 15, 200, 20 }, TextFormat("raygui style: %s", styleName));
+
+        // Draw left column
+        //----------------------------------------------------------------------------------------
+        rec = (Rectangle){ TABLE_LEFT_PADDING, TABLE_TOP_PADDING + TABLE_CELL_HEIGHT/2 + 20, tableStateNameWidth, TABLE_CELL_HEIGHT };
+
+        for (int i = 0; i < 4; i++)
+        {
+            GuiGroupBox(rec, NULL);
+
+            // Draw style rectangle
+            GuiSetState(i); GuiLabelButton((Rectangle){ rec.x + 28, rec.y, rec.width, rec.height }, tableStateName[i]);
+            rec.y += TABLE_CELL_HEIGHT - 1;             // NOTE: We add/remove 1px to draw lines overlapped!
+        }
+        //----------------------------------------------------------------------------------------
+
+        GuiSetState(STATE_NORMAL);
+
+        int offsetWidth = TABLE_LEFT_PADDING + tableStateNameWidth;
+
+        // Draw basic controls
+        for (int i = 0; i < TABLE_CONTROLS_COUNT; i++)
+        {
+            rec = (Rectangle){ offsetWidth - i - 1, TABLE_TOP_PADDING + 20, (controlWidth[i] + TABLE_CELL_PADDING*2), TABLE_CELL_HEIGHT/2 + 1 };
+
+            // Draw grid lines: control name
+            GuiGroupBox(rec, NULL);
+            int labelTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
+            GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+            GuiLabel(rec, tableControlsName[i]);
+
+            rec.y += TABLE_CELL_HEIGHT/2;
+            rec.height = TABLE_CELL_HEIGHT;
+
+            float tempFloat = 40.0f;
+
+            // Draw control 4 states: DISABLED, NORMAL, FOCUSED, PRESSED
+            for (int j = 0; j < 4; j++)
+            {
+                // Draw grid lines: control state
+                GuiGroupBox(rec, NULL);
+
+                bool tempBool = false;
+                int tempInt = 0;
+
+                GuiSetState(j);
+                    // Draw control centered correctly in grid
+                    switch (i)
+                    {
+                        case TYPE_LABEL: GuiLabelButton((Rectangle){ rec.x, rec.y, controlWidth[i], 40 }, "#10#Label"); break;
+                        case TYPE_BUTTON: GuiButton((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#2#Button"); break;
+                        case TYPE_TOGGLE: GuiToggle((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#39#Toggle", &tempBool); break;
+                        case TYPE_CHECKBOX:
+                        {
+                            GuiCheckBox((Rectangle){ rec.x + 10, rec.y + rec.height/2 - 15/2, 15, 15 }, "NoCheck", &tempBool);
+                            DrawRectangle(rec.x + rec.width/2, rec.y, 1, TABLE_CELL_HEIGHT, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+                            tempBool = true;
+                            GuiCheckBox((Rectangle){ rec.x + rec.width/2 + 10, rec.y + rec.height/2 - 15/2, 15, 15 }, "Checked", &tempBool);
+                        } break;
+                        case TYPE_SLIDER: GuiSlider((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100); break;
+                        case TYPE_SLIDERBAR: GuiSliderBar((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100); break;
+                        case TYPE_PROGRESSBAR:
+                        {
+                            if (j < 3) GuiSetState(0);
+                            tempFloat = 60;
+                            GuiProgressBar((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100);
+                            GuiSetState(j);
+                        } break;
+                        case TYPE_TOGGLESLIDER:
+                        {
+                            GuiSetStyle(SLIDER, SLIDER_PADDING, 2);
+                            GuiToggleSlider((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i]/2 - TABLE_CELL_PADDING, 24 }, "#87#OFF;#83#ON", &tempInt);
+                            DrawRectangle(rec.x + rec.width/2, rec.y, 1, TABLE_CELL_HEIGHT, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
+                            tempInt = 1;
+                            GuiToggleSlider((Rectangle){ rec.x + rec.width/2 + TABLE_CELL_PADDING, rec.y + rec.height/2 - 24/2, controlWidth[i]/2 - TABLE_CELL_PADDING, 24 }, "#87#OFF;#83#ON", &tempInt);
+                            GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
+                        } break;
+                        case TYPE_COMBOBOX: GuiComboBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#40#ComboBox;ComboBox", 0); break;
+                        case TYPE_DROPDOWNBOX: GuiDropdownBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#41#DropdownBox;DropdownBox", &dropdownActive, false); break;
+                        case TYPE_TEXTBOX: GuiTextBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "text box", 32, false); break;
+                        case TYPE_VALUEBOX: GuiValueBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, NULL, &value, 0, 100, false); break;
+                        case TYPE_SPINNER: GuiSpinner((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, NULL, &value, 0, 100, false); break;
+                        default: break;
+                    }
+                GuiSetState(STATE_NORMAL);
+
+                rec.y += TABLE_CELL_HEIGHT - 1;
+            }
+
+            GuiSetStyle(LABEL, TEXT_ALIGNMENT, labelTextAlignment);
+
+            offsetWidth += (controlWidth[i] + TABLE_CELL_PADDING*2);
+        }
+
+        // Draw copyright and software info (bottom-right)
+        GuiLabel((Rectangle){ TABLE_LEFT_PADDING, tableHeight - 26, 400, 10 }, "raygui style table automatically generated with rGuiStyler");
+        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
+        GuiLabel((Rectangle){ tableWidth - 400 - TABLE_LEFT_PADDING, tableHeight - 26, 400, 10 }, "rGuiStyler created by raylib technologies (@raylibtech)");
+        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+
+    EndTextureMode();
+    //--------------------------------------------------------------------------------------------
+
+    GuiSetStyle(SLIDER, SLIDER_WIDTH, sliderWidth);
+
+    Image imStyleTable = LoadImageFromTexture(target.texture);
+    ImageFlipVertical(&imStyleTable);
+
+    UnloadRenderTexture(target);
+
+    return imStyleTable;
+}
+
+//--------------------------------------------------------------------------------------------
+// Style templates pack functions
+//--------------------------------------------------------------------------------------------
+
+// Style templates pack (.rgp) file structure
+//
+// Pack is a bundle of style binary files (.rgs), every entry stored compressed (DEFLATE),
+// pack could be a separate file or appended to executable, trailer is used to locate it
+//
+// Pack header (16 bytes)
+//   4 bytes: "rGP " signature
+//   2 bytes: version (100)
+//   2 bytes: reserved
+//   4 bytes: entries count (N)
+//   4 bytes: reserved
+//
+// Pack index (N*44 bytes)
+//   32 bytes: entry name (NULL terminated)
+//   4 bytes: entry data offset (from pack start)
+//   4 bytes: entry data compressed size
+//   4 bytes: entry data uncompressed size (style binary file size)
+//
+// Pack data: N entries compressed data
+//
+// Pack trailer (8 bytes), always at the end of pack
+//   4 bytes: pack size (header + index + data), trailer not included
+//   4 bytes: "rGP " signature
+
+// Load style templates pack index, returns entries count
+// NOTE: Entries data is not loaded, only read from file when selected,
+// index entries are checked to be contained in pack before any entry is read
+static int LoadStylePack(const char *fileName)
+{
+    UnloadStylePack();
+
+    FILE *packFile = fopen(fileName, "rb");
+
+    if (packFile != NULL)
+    {
+        char signature[4] = { 0 };
+        short version = 0;
+        short reserved = 0;
+        int count = 0;
+        int offset = 0;
+
+        fseek(packFile, 0, SEEK_END);
+        int fileSize = (int)ftell(packFile);
+        int packSize = fileSize;
+        fseek(packFile, 0, SEEK_SET);
+
+        fread(signature, 1, 4, packFile);
+
+        // Pack not found at file start, look for pack trailer (pack appended to executable)
+        // NOTE: Trailer pack size does not include trailer (8 bytes)
+        if (((signature[0] != 'r') || (signature[1] != 'G') || (signature[2] != 'P') || (signature[3] != ' ')) && (fileSize >= 24))
+        {
+            packSize = 0;
+            memset(signature, 0, 4);
+
+            fseek(packFile, fileSize - 8, SEEK_SET);
+            fread(&packSize, sizeof(int), 1, packFile);
+            fread(signature, 1, 4, packFile);
+
+            if ((signature[0] == 'r') && (signature[1] == 'G') && (signature[2] == 'P') && (signature[3] == ' ') &&
+                (packSize >= 16) && (packSize <= (fileSize - 8)))
+            {
+                offset = fileSize - 8 - packSize;
+                fseek(packFile, offset, SEEK_SET);
+                fread(signature, 1, 4, packFile);
+            }
+            else memset(signature, 0, 4);
+        }
+
+        if ((signature[0] == 'r') && (signature[1] == 'G') && (signature[2] == 'P') && (signature[3] == ' '))
+        {
+            fread(&version, sizeof(short), 1, packFile);
+            fread(&reserved, sizeof(short), 1, packFile);
+            fread(&count, sizeof(int), 1, packFile);
+            fseek(packFile, 4, SEEK_CUR);
+
+            // Check pack index fits in pack
+            if ((count > 0) && (count <= (packSize - 16)/44))
+            {
+                stylePackEntries = (GuiStylePackEntry *)RL_CALLOC(count, sizeof(GuiStylePackEntry));
+                bool validIndex = true;
+
+                for (int i = 0; i < count; i++)
+                {
+                    if (fread(stylePackEntries[i].name, 1, 32, packFile) != 32) validIndex = false;
+                    stylePackEntries[i].name[31] = '\0';
+                    fread(&stylePackEntries[i].offset, sizeof(int), 1, packFile);
+                    fread(&stylePackEntries[i].compSize, sizeof(int), 1, packFile);
+                    fread(&stylePackEntries[i].dataSize, sizeof(int), 1, packFile);
+
+                    // Check entry data is placed after pack index and contained in pack
+                    GuiStylePackEntry *entry = &stylePackEntries[i];
+                    if ((entry->offset < (16 + count*44)) || (entry->compSize <= 0) || (entry->dataSize <= 0) ||
+                        (entry->compSize > (packSize - entry->offset))) validIndex = false;
+                }
+
+                if (validIndex)
+                {
+                    strcpy(stylePackFileName, fileName);
+                    stylePackOffset = offset;
+                    stylePackCount = count;
+                }
+                else
+                {
+                    LOG("WARNING: Style templates pack index not valid: %s\n", fileName);
+                    RL_FREE(stylePackEntries);
+                    stylePackEntries = NULL;
+                }
+            }
+        }
+
+        fclose(packFile);
+    }
+
+    return stylePackCount;
+}
+
+// Unload style templates pack index
+static void UnloadStylePack(void)
+{
+    RL_FREE(stylePackEntries);
+    stylePackEntries = NULL;
+    stylePackCount = 0;
+    stylePackOffset = 0;
+    memset(stylePackFileName, 0, 512);
+}
+
+// Load style templates pack entry
+// NOTE: Entry data is read from pack file and decompressed, loaded over current style
+static bool LoadStylePackEntry(int index)
+{
+    bool result = false;
+
+    if ((index >= 0) && (index < stylePackCount))
+    {
+        FILE *packFile = fopen(stylePackFileName, "rb");
+
+        if (packFile != NULL)
+        {
+            unsigned char *compData = (unsigned char *)RL_MALLOC(stylePackEntries[index].compSize);
+
+            fseek(packFile, stylePackOffset + stylePackEntries[index].offset, SEEK_SET);
+            int compSize = (int)fread(compData, 1, stylePackEntries[index].compSize, packFile);
+
+            fclose(packFile);
+
+            if (compSize == stylePackEntries[index].compSize)
+            {
+                int dataSize = 0;
+                unsigned char *data = DecompressData(compData, compSize, &dataSize);
+
+                if ((data != NULL) && (dataSize == stylePackEntries[index].dataSize))
+                {
+                    GuiLoadStyleFromMemory(data, dataSize);
+                    result = true;
+                }
+                else LOG("WARNING: Style pack entry data could be corrupted: %s\n", stylePackEntries[index].name);
+
+                MemFree(data);
+            }
+
+            RL_FREE(compData);
+        }
+    }
+
+    return result;
+}
+
+#if defined(PLATFORM_DESKTOP)
+// Save style templates pack from directory style files (.rgs binary), returns entries count
+// NOTE: Entries sorted by file name, template name taken from file name ("style_" prefix removed)
+static int SaveStylePack(const char *fileName, const char *dirPath)
+{
+    int count = 0;
+    FilePathList files = LoadDirectoryFilesEx(dirPath, ".rgs", false);
+
+    // Sort files by name to get a predictable templates order
+    for (unsigned int i = 1; i < files.count; i++)
+    {
+        for (unsigned int j = i; (j > 0) && (strcmp(files.paths[j - 1], files.paths[j]) > 0); j--)
+        {
+            char *temp = files.paths[j];
+            files.paths[j] = files.paths[j - 1];
+            files.paths[j - 1] = temp;
+        }
+    }
+
+    GuiStylePackEntry *entries = (GuiStylePackEntry *)RL_CALLOC(files.count, sizeof(GuiStylePackEntry));
+    unsigned char **entriesData = (unsigned char **)RL_CALLOC(files.count, sizeof(unsigned char *));
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        int dataSize = GetFileLength(files.paths[i]);
+        BeginTraceFileSpan(files.paths[i], dataSize);
+
+        BeginTraceSpan("read");
+        unsigned char *data = LoadFileData(files.paths[i], &dataSize);
+        EndTraceSpan();
+
+        // NOTE: Only style binary files supported (text styles could require external files)
+        if ((data != NULL) && (dataSize > 12) && (data[0] == 'r') && (data[1] == 'G') && (data[2] == 'S') && (data[3] == ' '))
+        {
+            const char *name = GetFileNameWithoutExt(files.paths[i]);
+            if (strncmp(name, "style_", 6) == 0) name += 6;
+
+            strncpy(entries[count].name, name, 31);
+            if ((entries[count].name[0] >= 'a') && (entries[count].name[0] <= 'z')) entries[count].name[0] -= 32;
+
+            BeginTraceSpan("compress");
+            entriesData[count] = CompressData(data, dataSize, &entries[count].compSize);
+            EndTraceSpan();
+
+            entries[count].dataSize = dataSize;
+            traceBytesOut += entries[count].compSize;
+            count++;
+        }
+        else LOG("WARNING: Style file not supported (binary required): %s\n", files.paths[i]);
+
+        UnloadFileData(data);
+
+        EndTraceSpan();     // File span
+    }
+
+    // NOTE: Data offsets are computed once entries count is known
+    int dataOffset = 16 + count*44;
+    for (int i = 0; i < count; i++)
+    {
+        entries[i].offset = dataOffset;
+        dataOffset += entries[i].compSize;
+    }
+
+    FILE *packFile = (count > 0)? fopen(fileName, "wb") : NULL;
+
+    if (packFile != NULL)
+    {
+        char signature[5] = "rGP ";
+        short version = 100;
+        short reserved = 0;
+        int reservedInt = 0;
+
+        fwrite(signature, 1, 4, packFile);
+        fwrite(&version, sizeof(short), 1, packFile);
+        fwrite(&reserved, sizeof(short), 1, packFile);
+        fwrite(&count, sizeof(int), 1, packFile);
+        fwrite(&reservedInt, sizeof(int), 1, packFile);
+
+        for (int i = 0; i < count; i++)
+        {
+            fwrite(entries[i].name, 1, 32, packFile);
+            fwrite(&entries[i].offset, sizeof(int), 1, packFile);
+            fwrite(&entries[i].compSize, sizeof(int), 1, packFile);
+            fwrite(&entries[i].dataSize, sizeof(int), 1, packFile);
+        }
+
+        for (int i = 0; i < count; i++) fwrite(entriesData[i], 1, entries[i].compSize, packFile);
+
+        // Write trailer, required to locate pack when appended to executable
+        // NOTE: Pack size written (header + index + data), trailer not included
+        fwrite(&dataOffset, sizeof(int), 1, packFile);
+        fwrite(signature, 1, 4, packFile);
+
+        fclose(packFile);
+    }
+
+    for (int i = 0; i < count; i++) MemFree(entriesData[i]);
+    RL_FREE(entriesData);
+    RL_FREE(entries);
+    UnloadDirectoryFiles(files);
+
+    return count;
+}
+#endif
+
+// Get style templates count (Light style included)
+static int GetStyleTemplatesCount(void)
+{
+    return (stylePackCount > 0)? (stylePackCount + 1) : MAX_GUI_STYLES_AVAILABLE;
+}
+
+// Get style template name
+static const char *GetStyleTemplateName(int index)
+{
+    const char *name = styleNames[0];
+
+    if (stylePackCount > 0)
+    {
+        if ((index > 0) && (index <= stylePackCount)) name = stylePackEntries[index - 1].name;
+    }
+    else if ((index >= 0) && (index < MAX_GUI_STYLES_AVAILABLE)) name = styleNames[index];
+
+    return name;
+}
+
+#if defined(PLATFORM_DESKTOP)
+//--------------------------------------------------------------------------------------------
+// Autosave journal functions
+//--------------------------------------------------------------------------------------------
+// Journal File Structure (.rgj)
+// ------------------------------------------------------
+// Offset  | Size    | Type       | Description
+// ------------------------------------------------------
+// 0       | 4       | char       | Signature: "rGJ "
+// 4       | 2       | short      | Version: 100
+// 6       | 2       | short      | reserved
+// foreach (entry), appended on every journal update
+// {
+//   ...   | 1       | char       | Entry type: 'P' (property), 'F' (font reference)
+//   'P'   | 2       | short      | ControlId
+//   'P'   | 2       | short      | PropertyId
+//   'P'   | 4       | int        | PropertyValue
+//   'F'   | 4       | int        | Font generation size
+//   'F'   | 2       | short      | Font file name length (L)
+//   'F'   | L       | char       | Font file name (no '\0')
+// }
+// ------------------------------------------------------
+
+// Get journal file name for current style file
+// NOTE: Journal is placed next to the style file or in application directory for new styles
+static const char *GetJournalFileName(void)
+{
+    if (outputFileCreated) return TextFormat("%s.rgj", outFileName);
+    else if (inputFileLoaded) return TextFormat("%s.rgj", inFileName);
+
+    // NOTE: Untitled styles on additional tabs require their own journal
+    if (styleTabs[styleTabActive].journalId > 0) return TextFormat("%suntitled_%02i.rgj", GetApplicationDirectory(), styleTabs[styleTabActive].journalId);
+
+    return TextFormat("%suntitled.rgj", GetApplicationDirectory());
+}
+
+// Reset journal, removing file and taking current style as base
+static void ResetJournal(void)
+{
+    if (inputSessionMode != INPUT_SESSION_NONE) return;
+
+    if ((journalFileName[0] != '\0') && FileExists(journalFileName)) remove(journalFileName);
+
+    strcpy(journalFileName, GetJournalFileName());
+    memcpy(journalStyle, GuiGetStyleData(), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int));
+    strcpy(journalFontFileName, inFontFileName);
+    journalFontSize = 0;
+    journalUpdateTime = GetTime();
+}
+
+// Update journal, appending changes since last update
+// NOTE: Only changed properties are written, cost does not depend on font atlas size
+static void UpdateJournal(int fontSize)
+{
+    if (inputSessionMode != INPUT_SESSION_NONE) return;
+
+    // Style file changed (new, loaded or saved as), previous journal is not valid any more
+    if (strcmp(journalFileName, GetJournalFileName()) != 0) ResetJournal();
+
+    unsigned int *style = GuiGetStyleData();
+
+    bool fontChanged = (inFontFileName[0] != '\0') && ((strcmp(journalFontFileName, inFontFileName) != 0) || (journalFontSize != fontSize));
+    bool propsChanged = (memcmp(journalStyle, style, RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)*sizeof(int)) != 0);
+
+    if (fontChanged || propsChanged)
+    {
+        bool journalCreated = FileExists(journalFileName);
+        FILE *journalFile = fopen(journalFileName, "ab");
+
+        if (journalFile != NULL)
+        {
+            if (!journalCreated)
+            {
+                short version = 100;
+                short reserved = 0;
+
+                fwrite("rGJ ", 1, 4, journalFile);
+                fwrite(&version, sizeof(short), 1, journalFile);
+                fwrite(&reserved, sizeof(short), 1, journalFile);
+            }
+
+            // NOTE: Font reference is written first, properties could depend on it
+            if (fontChanged)
+            {
+                short nameLength = (short)strlen(inFontFileName);
+
+                fputc('F', journalFile);
+                fwrite(&fontSize, sizeof(int), 1, journalFile);
+                fwrite(&nameLength, sizeof(short), 1, journalFile);
+                fwrite(inFontFileName, 1, nameLength, journalFile);
+
+                strcpy(journalFontFileName, inFontFileName);
+                journalFontSize = fontSize;
+            }
+
+            for (int i = 0; i < RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++)
+            {
+                if (journalStyle[i] != style[i])
+                {
+                    short controlId = (short)(i/(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED));
+                    short propertyId = (short)(i%(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED));
+
+                    fputc('P', journalFile);
+                    fwrite(&controlId, sizeof(short), 1, journalFile);
+                    fwrite(&propertyId, sizeof(short), 1, journalFile);
+                    fwrite(&style[i], sizeof(int), 1, journalFile);
+
+                    journalStyle[i] = style[i];
+                }
+            }
+
+            fclose(journalFile);
+        }
+    }
+
+    journalUpdateTime = GetTime();
+}
+
+// Load journal changes over current style
+// NOTE: Last font reference (if any) is returned to be regenerated by font atlas window
+static bool LoadJournal(const char *fileName, char *fontFileName, int *fontSize)
+{
+    bool result = false;
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+    if ((fileData != NULL) && (dataSize >= 8) && (memcmp(fileData, "rGJ ", 4) == 0))
+    {
+        unsigned char *fileDataPtr = fileData + 8;
+
+        while (fileDataPtr < (fileData + dataSize))
+        {
+            char type = (char)fileDataPtr[0];
+            fileDataPtr += 1;
+
+            if ((type == 'P') && ((fileDataPtr + 8) <= (fileData + dataSize)))
+            {
+                short controlId = 0;
+                short propertyId = 0;
+                int propertyValue = 0;
+
+                memcpy(&controlId, fileDataPtr, sizeof(short));
+                memcpy(&propertyId, fileDataPtr + 2, sizeof(short));
+                memcpy(&propertyValue, fileDataPtr + 4, sizeof(int));
+                fileDataPtr += 8;
+
+                // NOTE: Every control property is journaled individually, no DEFAULT propagation required
+                // NOTE: Ids out of range (corrupted journal) are skipped, negative ids included
+                if ((controlId >= 0) && (controlId < RAYGUI_MAX_CONTROLS) && (propertyId >= 0) && (propertyId < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)))
+                {
+                    GuiGetStyleData()[controlId*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + propertyId] = propertyValue;
+                }
+            }
+            else if ((type == 'F') && ((fileDataPtr + 6) <= (fileData + dataSize)))
+            {
+                short nameLength = 0;
+
+                memcpy(fontSize, fileDataPtr, sizeof(int));
+                memcpy(&nameLength, fileDataPtr + 4, sizeof(short));
+                fileDataPtr += 6;
+
+                if ((nameLength < 0) || (nameLength >= 512) || ((fileDataPtr + nameLength) > (fileData + dataSize))) break;
+
+                memset(fontFileName, 0, 512);
+                memcpy(fontFileName, fileDataPtr, nameLength);
+                fileDataPtr += nameLength;
+            }
+            else break;     // Truncated or unknown entry (i.e. crash while writing)
+        }
+
+        // Style data modified directly, controls overrides rebuilt
+        GuiSetStyleData(GuiGetStyleData());
+
+        result = true;
+    }
+
+    UnloadFileData(fileData);
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------
+// Command-line trace functions
+//--------------------------------------------------------------------------------------------
+// NOTE: Trace is saved as Chrome trace format (JSON), it can be opened with chrome://tracing or ui.perfetto.dev,
+// every file processed is a span with nested spans for every processing step (read, parse, encode, write...)
+// WARNING: Command-line processing is single-threaded, all spans are placed on main thread lane
+
+// Init trace, spans recorded from now on
+static void InitTrace(void)
+{
+    if (traceEvents == NULL) traceEvents = (TraceEvent *)RL_CALLOC(MAX_TRACE_EVENTS, sizeof(TraceEvent));
+
+    traceEventsCount = 0;
+    traceDepth = 0;
+    traceSectionsCount = 0;
+    traceFilesCount = 0;
+    traceBytesIn = 0;
+    traceBytesOut = 0;
+    traceStartTime = GetTraceTime();
+}
+
+// Close trace, saving trace events (Chrome trace format) and showing summary
+// NOTE: Trace events are not saved if no file name provided, files summary only shown if files processed
+static void CloseTrace(const char *fileName)
+{
+    if (traceEvents == NULL) return;
+
+    double totalTime = (GetTraceTime() - traceStartTime)/1000000.0;     // Seconds
+
+    FILE *traceFile = (fileName != NULL)? fopen(fileName, "wt") : NULL;
+
+    if (traceFile != NULL)
+    {
+        fprintf(traceFile, "{\"traceEvents\":[\n");
+        fprintf(traceFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"%s v%s\"}},\n", toolName, toolVersion);
+        fprintf(traceFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}");
+
+        for (int i = 0; i < traceEventsCount; i++)
+        {
+            // NOTE: File spans are named as file, name and path escaped (Windows paths use backslashes)
+            fprintf(traceFile, ",\n{\"name\":");
+            WriteTraceString(traceFile, traceEvents[i].name);
+            fprintf(traceFile, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f",
+                (traceEvents[i].fileName != NULL)? "file" : "step", traceEvents[i].start, traceEvents[i].duration);
+
+            if (traceEvents[i].fileName != NULL)
+            {
+                fprintf(traceFile, ",\"args\":{\"file\":");
+                WriteTraceString(traceFile, traceEvents[i].fileName);
+                fprintf(traceFile, "}}");
+            }
+            else fprintf(traceFile, "}");
+        }
+
+        fprintf(traceFile, "\n],\"displayTimeUnit\":\"ms\"}\n");
+        fclose(traceFile);
+    }
+    else if (fileName != NULL) printf("WARNING: Trace file could not be created: %s\n", fileName);
+
+    if (traceEventsCount >= MAX_TRACE_EVENTS) printf("WARNING: Trace events limit reached, trace file is incomplete\n");
+
+    // Show throughput summary
+    if (fileName != NULL) printf("\nTrace file:       %s\n", fileName);
+    if (traceFilesCount > 0) printf("Files processed:  %i (%.3f s)\n", traceFilesCount, totalTime);
+    if ((traceFilesCount > 0) && (totalTime > 0.0))
+    {
+        printf("Throughput:       %.2f files/s\n", (double)traceFilesCount/totalTime);
+        printf("                  %.2f MB/s read, %.2f MB/s written\n", (double)traceBytesIn/(1024.0*1024.0)/totalTime, (double)traceBytesOut/(1024.0*1024.0)/totalTime);
+    }
+
+    for (int i = 0; i < traceEventsCount; i++) RL_FREE(traceEvents[i].fileName);
+    RL_FREE(traceEvents);
+    traceEvents = NULL;
+    traceEventsCount = 0;
+}
+
+// Begin trace span (nested spans supported)
+static void BeginTraceSpan(const char *name)
+{
+    if (traceEvents == NULL) return;
+
+    // NOTE: Spans over the limits are not recorded but they still must be closed,
+    // spans over events limit are still accounted on sections totals
+    if (traceDepth < MAX_TRACE_DEPTH)
+    {
+        double start = GetTraceTime() - traceStartTime;
+
+        traceStack[traceDepth] = -1;
+        traceStackNames[traceDepth] = name;
+        traceStackStarts[traceDepth] = start;
+
+        if (traceEventsCount < MAX_TRACE_EVENTS)
+        {
+            traceEvents[traceEventsCount].name = name;
+            traceEvents[traceEventsCount].fileName = NULL;
+            traceEvents[traceEventsCount].start = start;
+            traceStack[traceDepth] = traceEventsCount;
+            traceEventsCount++;
+        }
+    }
+
+    traceDepth++;
+}
+
+// Begin trace file span, file processed accounted for summary
+static void BeginTraceFileSpan(const char *fileName, int fileSize)
+{
+    if (traceEvents == NULL) return;
+
+    BeginTraceSpan("file");
+
+    int index = ((traceDepth > 0) && (traceDepth <= MAX_TRACE_DEPTH))? traceStack[traceDepth - 1] : -1;
+
+    if (index >= 0)
+    {
+        // Span named as file, file path copied (it could be released before saving trace)
+        traceEvents[index].fileName = (char *)RL_CALLOC(strlen(fileName) + 1, 1);
+        strcpy(traceEvents[index].fileName, fileName);
+        traceEvents[index].name = GetFileName(traceEvents[index].fileName);
+    }
+
+    traceFilesCount++;
+    traceBytesIn += fileSize;
+}
+
+// End last trace span
+static void EndTraceSpan(void)
+{
+    if ((traceEvents == NULL) || (traceDepth <= 0)) return;
+
+    traceDepth--;
+
+    if (traceDepth < MAX_TRACE_DEPTH)
+    {
+        double duration = (GetTraceTime() - traceStartTime) - traceStackStarts[traceDepth];
+        int index = traceStack[traceDepth];
+        if (index >= 0) traceEvents[index].duration = duration;
+
+        // Accumulate section totals, sections over the limit are not accounted
+        int k = 0;
+        for (; k < traceSectionsCount; k++) if (strcmp(traceSections[k].name, traceStackNames[traceDepth]) == 0) break;
+
+        if ((k == traceSectionsCount) && (traceSectionsCount < MAX_TRACE_SECTIONS))
+        {
+            traceSections[k] = (TraceSection){ traceStackNames[traceDepth], 0, 0.0, 0.0 };
+            traceSectionsCount++;
+        }
+
+        if (k < traceSectionsCount)
+        {
+            traceSections[k].count++;
+            traceSections[k].total += duration;
+            if (duration > traceSections[k].max) traceSections[k].max = duration;
+        }
+    }
+}
+
+// Write JSON string to trace file (quoted and escaped)
+// NOTE: Quotes and backslashes escaped, control characters written as \u00XX, UTF-8 bytes written as is
+static void WriteTraceString(FILE *traceFile, const char *text)
+{
+    fputc('"', traceFile);
+
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+    {
+        if ((*c == '\\') || (*c == '"')) fprintf(traceFile, "\\%c", *c);
+        else if (*c < 0x20) fprintf(traceFile, "\\u%04x", *c);
+        else fputc(*c, traceFile);
+    }
+
+    fputc('"', traceFile);
+}
+
+// Get trace time (microseconds)
+// NOTE: Command-line mode does not init window, so raylib GetTime() is not available
+static double GetTraceTime(void)
+{
+    struct timespec time = { 0 };
+#if defined(_MSC_VER)
+    timespec_get(&time, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &time);  // NOTE: Requires _DEFAULT_SOURCE with -std=c99
+#endif
+
+    return (double)time.tv_sec*1000000.0 + (double)time.tv_nsec/1000.0;
+}
+
+//--------------------------------------------------------------------------------------------
+// Command-line compare functions
+//--------------------------------------------------------------------------------------------
+
+// Load image to compare: .png image or .rgs style (controls table image generated)
+// NOTE: Image is converted to RGBA 32bit, expected by CompareImages()
+static Image LoadCompareImage(const char *fileName)
+{
+    Image image = { 0 };
+
+    if (IsFileExtension(fileName, ".rgs"))
+    {
+        GuiLoadStyleDefault();
+        GuiLoadStyle(fileName);
+        image = GenImageStyleControlsTable(GetFileNameWithoutExt(fileName));
+    }
+    else image = LoadImage(fileName);
+
+    if (image.data != NULL) ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    return image;
+}
+
+// Compare images (tiled, perceptual difference), heatmap generated if provided
+// NOTE: Images are compared by tiles, identical tiles (most of them on style tables) are detected
+// comparing tile rows pixels (SIMD if available) and skipped, only changed pixels compute CIE76 Delta E
+// (Lab color space), pixels outside any of the images are considered fully changed
+static CompareResult CompareImages(Image imageA, Image imageB, Image *heatmap)
+{
+    CompareResult result = { 0 };
+
+    int width = (imageA.width > imageB.width)? imageA.width : imageB.width;
+    int height = (imageA.height > imageB.height)? imageA.height : imageB.height;
+    int commonWidth = (imageA.width < imageB.width)? imageA.width : imageB.width;
+    int commonHeight = (imageA.height < imageB.height)? imageA.height : imageB.height;
+
+    const unsigned char *pixelsA = (const unsigned char *)imageA.data;
+    const unsigned char *pixelsB = (const unsigned char *)imageB.data;
+    unsigned char *pixelsHeatmap = NULL;
+
+    if (heatmap != NULL)
+    {
+        *heatmap = GenImageColor(width, height, BLACK);
+        pixelsHeatmap = (unsigned char *)heatmap->data;
+    }
+
+    // sRGB to linear conversion table, avoids pow() per pixel
+    static float srgbToLinear[256] = { 0 };
+    if (srgbToLinear[255] == 0.0f)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            float c = (float)i/255.0f;
+            srgbToLinear[i] = (c <= 0.04045f)? c/12.92f : powf((c + 0.055f)/1.055f, 2.4f);
+        }
+    }
+
+    double deltaSum = 0.0;
+
+    result.pixelsCount = width*height;
+    result.tilesCount = ((width + COMPARE_TILE_SIZE - 1)/COMPARE_TILE_SIZE)*((height + COMPARE_TILE_SIZE - 1)/COMPARE_TILE_SIZE);
+
+    for (int ty = 0; ty < height; ty += COMPARE_TILE_SIZE)
+    {
+        for (int tx = 0; tx < width; tx += COMPARE_TILE_SIZE)
+        {
+            int tileWidth = ((tx + COMPARE_TILE_SIZE) > width)? (width - tx) : COMPARE_TILE_SIZE;
+            int tileHeight = ((ty + COMPARE_TILE_SIZE) > height)? (height - ty) : COMPARE_TILE_SIZE;
+
+            // Check tile rows pixels equality first, identical tiles (and pixels) require no color conversion
+            // NOTE: Only pixels inside both images are checked, rows masks used on per-pixel comparison
+            unsigned int rowMasks[COMPARE_TILE_SIZE] = { 0 };
+            unsigned int fullMask = (tileWidth < 32)? ((1u << tileWidth) - 1) : 0xffffffff;
+            int commonCount = ((tx + tileWidth) > commonWidth)? (commonWidth - tx) : tileWidth;
+            bool tileChanged = (((tx + tileWidth) > commonWidth) || ((ty + tileHeight) > commonHeight));
+
+            for (int y = ty; (y < (ty + tileHeight)) && (y < commonHeight) && (commonCount > 0); y++)
+            {
+                rowMasks[y - ty] = GetComparePixelsMask(pixelsA + (y*imageA.width + tx)*4, pixelsB + (y*imageB.width + tx)*4, commonCount);
+                if (rowMasks[y - ty] != fullMask) tileChanged = true;
+            }
+
+            if (tileChanged) result.tilesChanged++;
+
+            for (int y = ty; y < (ty + tileHeight); y++)
+            {
+                for (int x = tx; x < (tx + tileWidth); x++)
+                {
+                    float delta = 0.0f;
+                    const unsigned char *pixelA = ((x < imageA.width) && (y < imageA.height))? (pixelsA + (y*imageA.width + x)*4) : NULL;
+
+                    if (tileChanged)
+                    {
+                        const unsigned char *pixelB = ((x < imageB.width) && (y < imageB.height))? (pixelsB + (y*imageB.width + x)*4) : NULL;
+
+                        if ((pixelA == NULL) || (pixelB == NULL)) delta = 100.0f;
+                        else if (!(rowMasks[y - ty] & (1u << (x - tx))))
+                        {
+                            // Convert both pixels to Lab (D65), alpha blended over black
+                            float lab[2][3] = { 0 };
+                            const unsigned char *pixels[2] = { pixelA, pixelB };
+
+                            for (int k = 0; k < 2; k++)
+                            {
+                                float alpha = (float)pixels[k][3]/255.0f;
+                                float r = srgbToLinear[pixels[k][0]]*alpha;
+                                float g = srgbToLinear[pixels[k][1]]*alpha;
+                                float b = srgbToLinear[pixels[k][2]]*alpha;
+
+                                float xyz[3] = {
+                                    (0.4124f*r + 0.3576f*g + 0.1805f*b)/0.95047f,
+                                    (0.2126f*r + 0.7152f*g + 0.0722f*b),
+                                    (0.0193f*r + 0.1192f*g + 0.9505f*b)/1.08883f
+                                };
+
+                                for (int c = 0; c < 3; c++) xyz[c] = (xyz[c] > 0.008856f)? cbrtf(xyz[c]) : (7.787f*xyz[c] + 16.0f/116.0f);
+
+                                lab[k][0] = 116.0f*xyz[1] - 16.0f;
+                                lab[k][1] = 500.0f*(xyz[0] - xyz[1]);
+                                lab[k][2] = 200.0f*(xyz[1] - xyz[2]);
+                            }
+
+                            float dl = lab[0][0] - lab[1][0];
+                            float da = lab[0][1] - lab[1][1];
+                            float db = lab[0][2] - lab[1][2];
+                            delta = sqrtf(dl*dl + da*da + db*db);
+                        }
+
+                        if (delta > COMPARE_DELTA_E_THRESHOLD) result.pixelsChanged++;
+                        if (delta > result.maxDelta) result.maxDelta = delta;
+                        deltaSum += delta;
+                    }
+
+                    if (pixelsHeatmap != NULL)
+                    {
+                        // Heatmap: reference image dimmed (grayscale), changed pixels in red by difference
+                        unsigned char *pixel = pixelsHeatmap + (y*width + x)*4;
+                        unsigned char gray = (pixelA != NULL)? (unsigned char)((pixelA[0]*77 + pixelA[1]*150 + pixelA[2]*29)/(256*3)) : 0;
+                        float heat = (delta > COMPARE_DELTA_E_THRESHOLD)? ((delta > 50.0f)? 1.0f : (0.25f + 0.75f*delta/50.0f)) : 0.0f;
+
+                        pixel[0] = (unsigned char)(gray + (255 - gray)*heat);
+                        pixel[1] = (unsigned char)(gray*(1.0f - heat));
+                        pixel[2] = (unsigned char)(gray*(1.0f - heat));
+                        pixel[3] = 255;
+                    }
+                }
+            }
+        }
+    }
+
+    if (result.pixelsCount > 0)
+    {
+        result.meanDelta = (float)(deltaSum/result.pixelsCount);
+        result.score = 100.0f*(float)(result.pixelsCount - result.pixelsChanged)/(float)result.pixelsCount;
+    }
+
+    return result;
+}
+
+// Get RGBA pixels equality mask (bit per pixel, up to 32 pixels)
+// NOTE: SSE2 compares 4 pixels per instruction if available (same check as rgs library), scalar fallback otherwise
+static unsigned int GetComparePixelsMask(const unsigned char *pixelsA, const unsigned char *pixelsB, int count)
+{
+    unsigned int mask = 0;
+    int i = 0;
+
+#if defined(RGS_SIMD_SSE2)
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(pixelsA + i*4));
+        __m128i b = _mm_loadu_si128((const __m128i *)(pixelsB + i*4));
+        mask |= ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))) << i);
+    }
+#endif
+    for (; i < count; i++) if (memcmp(pixelsA + i*4, pixelsB + i*4, 4) == 0) mask |= (1u << i);
+
+    return mask;
+}
+
+//--------------------------------------------------------------------------------------------
+// Command-line styles index functions
+//--------------------------------------------------------------------------------------------
+
+// Update styles index file (.rgsi) with directory style files (.rgs/.png), returns styles loaded count
+// NOTE: Previous index file is reused if available, only new or changed style files are loaded,
+// styles are indexed with style core library (rgs.h), no GUI style loading required
+static int UpdateStyleIndex(const char *fileName, const char *dirPath)
+{
+    rgs_index index = { 0 };
+
+    // NOTE: Index is rebuilt from scratch if index file is not available or not valid
+    if (FileExists(fileName)) rgs_index_load(&index, fileName);
+
+    FilePathList files = LoadDirectoryFilesEx(dirPath, ".rgs;.png", true);
+
+    BeginTraceSpan("index update");
+    int loadedCount = rgs_index_update(&index, (const char **)files.paths, (int)files.count);
+    EndTraceSpan();
+
+    BeginTraceSpan("write");
+    int result = rgs_index_save(&index, fileName);
+    EndTraceSpan();
+
+    if (result == RGS_OK)
+    {
+        int stylesCount = 0;
+        for (int i = 0; i < index.entry_count; i++) if (index.entries[i].result == RGS_OK) stylesCount++;
+
+        printf("\nIndex file:       %s\n", fileName);
+        printf("Styles indexed:   %i/%i files (%i loaded)\n", stylesCount, index.entry_count, loadedCount);
+    }
+    else printf("WARNING: Index file could not be saved: %s\n", rgs_result_text(result));
+
+    rgs_index_unload(&index);
+    UnloadDirectoryFiles(files);
+
+    return loadedCount;
+}
+
+// Query styles index file (.rgsi) showing matching styles, returns matches count
+// NOTE: Only index file is loaded, query syntax defined by rgs_index_query()
+static int QueryStyleIndex(const char *fileName, const char *query)
+{
+    rgs_index index = { 0 };
+    double startTime = GetTraceTime();
+    int count = rgs_index_load(&index, fileName);
+
+    if (count == RGS_OK)
+    {
+        int *matches = (int *)RL_CALLOC(index.entry_count + 1, sizeof(int));
+        count = rgs_index_query(&index, query, matches, index.entry_count);
+        double queryTime = (GetTraceTime() - startTime)/1000.0;     // Milliseconds, index loading included
+
+        for (int i = 0; i < count; i++)
+        {
+            const rgs_index_entry *entry = &index.entries[matches[i]];
+
+            if (entry->glyph_count > 0) printf("%s [font: %08x, size: %i, glyphs: %i]\n", entry->file_name, entry->font_hash, entry->font_base_size, entry->glyph_count);
+            else printf("%s\n", entry->file_name);
+        }
+
+        if (count >= 0) printf("\nStyles matching:  %i/%i (%.2f ms)\n", count, index.entry_count, queryTime);
+        else printf("WARNING: Index query not valid: %s\n", query);
+
+        RL_FREE(matches);
+    }
+    else printf("WARNING: Index file could not be loaded: %s\n", rgs_result_text(count));
+
+    rgs_index_unload(&index);
+
+    return (count > 0)? count : 0;
+}
+
+// Find styles index near-duplicate styles, showing clusters, returns clusters count
+// NOTE: Cluster representative is the closest style to cluster mean style, listed first
+static int FindStyleDuplicates(const char *fileName, float threshold)
+{
+    rgs_index index = { 0 };
+    int result = rgs_index_load(&index, fileName);
+    int clusterCount = 0;
+
+    if (result == RGS_OK)
+    {
+        BeginTraceSpan("clusters");
+        double startTime = GetTraceTime();
+        rgs_index_cluster *clusters = rgs_index_find_clusters(&index, threshold, &clusterCount);
+        double clustersTime = (GetTraceTime() - startTime)/1000.0;     // Milliseconds
+        EndTraceSpan();
+
+        int stylesCount = 0;
+
+        for (int c = 0; c < clusterCount; c++)
+        {
+            printf("\nCluster %i: %i styles, max distance %.3f\n", c + 1, clusters[c].entry_count, clusters[c].distance_max);
+            for (int e = 0; e < clusters[c].entry_count; e++) printf("  %s %s\n", (e == 0)? "*" : " ", index.entries[clusters[c].entries[e]].file_name);
+
+            stylesCount += clusters[c].entry_count;
+        }
+
+        printf("\nClusters found:   %i (%i/%i styles, threshold %.2f, %.2f ms)\n", clusterCount, stylesCount, index.entry_count, threshold, clustersTime);
+
+        rgs_index_unload_clusters(clusters, clusterCount);
+    }
+    else printf("WARNING: Index file could not be loaded: %s\n", rgs_result_text(result));
+
+    rgs_index_unload(&index);
+
+    return clusterCount;
+}
+
+// Find styles index nearest styles to style file (.rgs/.png), returns styles count
+static int FindNearestStyles(const char *fileName, const char *styleFileName)
+{
+    rgs_index index = { 0 };
+    rgs_style *style = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    int count = 0;
+
+    int dataSize = 0;
+    unsigned char *data = LoadFileData(styleFileName, &dataSize);
+    int result = RGS_ERROR_FILE;
+
+    if (data != NULL)
+    {
+        if (IsFileExtension(styleFileName, ".png")) result = rgs_load_from_png_memory(style, data, dataSize);
+        else result = rgs_load_from_memory(style, data, dataSize);
+
+        UnloadFileData(data);
+    }
+
+    if (result == RGS_OK) result = rgs_index_load(&index, fileName);
+
+    if (result == RGS_OK)
+    {
+        int results[STYLE_NEAREST_COUNT] = { 0 };
+        float distances[STYLE_NEAREST_COUNT] = { 0 };
+
+        count = rgs_index_find_nearest(&index, style, results, distances, STYLE_NEAREST_COUNT);
+
+        printf("\nNearest styles:   %s\n", styleFileName);
+        for (int i = 0; i < count; i++) printf("  %8.3f %s\n", distances[i], index.entries[results[i]].file_name);
+    }
+    else printf("WARNING: Style or index file could not be loaded: %s\n", rgs_result_text(result));
+
+    rgs_index_unload(&index);
+    rgs_unload(style);
+    RL_FREE(style);
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------
+// Command-line batch script functions
+//--------------------------------------------------------------------------------------------
+// NOTE: Batch scripts use the same style properties and font loading code paths as the gui editor,
+// styles are processed one after another, raygui style and font are global state
+
+// Load batch script commands, returns NULL if any line is not valid
+// NOTE: One command per line, lines starting with '#' are comments, font files relative to script directory
+static BatchCommand *LoadBatchScript(const char *fileName, int *count)
+{
+    *count = 0;
+
+    char *text = LoadFileText(fileName);
+    if (text == NULL) return NULL;
+
+    int lineCount = 1;
+    for (int i = 0; text[i] != '\0'; i++) if (text[i] == '\n') lineCount++;
+
+    BatchCommand *commands = (BatchCommand *)RL_CALLOC(lineCount, sizeof(BatchCommand));
+    const char *linePtr = text;
+    bool valid = true;
+
+    for (int line = 1; (linePtr != NULL) && valid; line++)
+    {
+        char lineText[512] = { 0 };
+        const char *lineEnd = strchr(linePtr, '\n');
+        int length = (lineEnd != NULL)? (int)(lineEnd - linePtr) : (int)strlen(linePtr);
+        if (length > 511) length = 511;
+
+        memcpy(lineText, linePtr, length);
+        linePtr = (lineEnd != NULL)? (lineEnd + 1) : NULL;
+
+        char command[32] = { 0 };
+        char arg1[256] = { 0 };
+        char arg2[64] = { 0 };
+        int argCount = sscanf(lineText, "%31s %255s %63s", command, arg1, arg2);
+
+        if ((argCount <= 0) || (command[0] == '#')) continue;   // Empty or comment line
+
+        BatchCommand *cmd = &commands[*count];
+        char *end = NULL;
+
+        if ((strcmp(command, "set") == 0) && (argCount == 3))
+        {
+            cmd->type = BATCH_SET;
+            valid = ParseBatchProperty(arg1, &cmd->controlId, &cmd->propertyId) && ParseBatchValue(arg2, &cmd->value);
+        }
+        else if ((strcmp(command, "hue-rotate") == 0) && (argCount == 2))
+        {
+            cmd->type = BATCH_HUE_ROTATE;
+            cmd->amount = strtof(arg1, &end);
+            valid = (*end == '\0');
+        }
+        else if ((strcmp(command, "swap-light-dark") == 0) && (argCount == 1)) cmd->type = BATCH_SWAP_LIGHT_DARK;
+        else if ((strcmp(command, "load-font") == 0) && (argCount == 3))
+        {
+            cmd->type = BATCH_LOAD_FONT;
+            const char *fontFileName = FileExists(arg1)? arg1 : TextFormat("%s/%s", GetDirectoryPath(fileName), arg1);
+            cmd->value = (int)strtol(arg2, &end, 10);
+            valid = (*end == '\0') && (cmd->value > 0) && (strlen(fontFileName) < sizeof(cmd->fileName));   // Path too long rejected
+
+            if (valid)
+            {
+                strcpy(cmd->fileName, fontFileName);
+                valid = FileExists(cmd->fileName);
+            }
+        }
+        else valid = false;
+
+        if (valid) (*count)++;
+        else printf("WARNING: Batch script line %i not valid: %s\n", line, lineText);
+    }
+
+    UnloadFileText(text);
+
+    if (!valid)
+    {
+        RL_FREE(commands);
+        commands = NULL;
+        *count = 0;
+    }
+
+    return commands;
+}
+
+// Apply batch script commands to current style, returns false if any command failed
+// NOTE: Properties are set same as gui editor, DEFAULT base properties propagated to all controls
+static bool ApplyBatchScript(const BatchCommand *commands, int count)
+{
+    bool result = true;
+
+    for (int i = 0; (i < count) && result; i++)
+    {
+        const BatchCommand *cmd = &commands[i];
+
+        switch (cmd->type)
+        {
+            case BATCH_SET: GuiSetStyle(cmd->controlId, cmd->propertyId, cmd->value); break;
+            case BATCH_HUE_ROTATE: TransformStyleColors(cmd->amount, false); break;
+            case BATCH_SWAP_LIGHT_DARK: TransformStyleColors(0.0f, true); break;
+            case BATCH_LOAD_FONT:
+            {
+                // Load font same as font atlas window (main face, current charset)
+                Font font = { 0 };
+                int size = cmd->value;
+
+                // NOTE: Font atlas texture required for font embedding, graphics device must be available
+                if ((LoadFontFaces(cmd->fileName, &size, 1, codepointList, codepointListCount, &font) == 1) && (font.texture.id > 0))
+                {
+                    // NOTE: No style tabs font cache on command-line, previous font can be unloaded
+                    UnloadFontFaces();
+                    if (GuiGetFont().texture.id != GetFontDefault().texture.id) UnloadFont(GuiGetFont());
+
+                    customFont = font;
+                    GuiSetFont(customFont);
+                    SetShapesTexture((Texture2D){ 0 }, (Rectangle){ 0 });
+
+                    strcpy(inFontFileName, cmd->fileName);
+                    customFontLoaded = true;
+                    customFontCached = false;
+
+                    GuiSetStyle(DEFAULT, TEXT_SIZE, size);
+                }
+                else
+                {
+                    if (font.glyphCount > 0) UnloadFont(font);
+                    printf("WARNING: Batch script font could not be loaded: %s\n", cmd->fileName);
+                    result = false;
+                }
+            } break;
+            default: break;
+        }
+    }
+
+    return result;
+}
+
+// Parse batch property: CONTROL.PROPERTY (names or ids)
+// NOTE: Property names are base properties names, DEFAULT extended properties names (TEXT_SIZE...) and
+// EXTnn for controls extended properties (same as text style files), ids valid for all properties
+static bool ParseBatchProperty(const char *text, int *controlId, int *propertyId)
+{
+    const char *dot = strchr(text, '.');
+    if ((dot == NULL) || ((dot - text) >= 64)) return false;
+
+    char controlText[64] = { 0 };
+    memcpy(controlText, text, dot - text);
+    const char *propertyText = dot + 1;
+
+    *controlId = -1;
+    *propertyId = -1;
+
+    for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++) if (strcmp(controlText, guiControlText[i]) == 0) *controlId = i;
+    for (int i = 0; i < RAYGUI_MAX_PROPS_BASE; i++) if (strcmp(propertyText, guiPropsText[i]) == 0) *propertyId = i;
+    for (int i = 0; (*controlId == DEFAULT) && (i < RAYGUI_MAX_PROPS_EXTENDED); i++) if (strcmp(propertyText, guiPropsDefaultExtendedText[i]) == 0) *propertyId = RAYGUI_MAX_PROPS_BASE + i;
+    for (int i = 0; i < RAYGUI_MAX_PROPS_EXTENDED; i++) if (strcmp(propertyText, TextFormat("EXT%02i", i)) == 0) *propertyId = RAYGUI_MAX_PROPS_BASE + i;
+
+    if ((*controlId < 0) && (controlText[0] >= '0') && (controlText[0] <= '9')) *controlId = TextToInteger(controlText);
+    if ((*propertyId < 0) && (propertyText[0] >= '0') && (propertyText[0] <= '9')) *propertyId = TextToInteger(propertyText);
+
+    return ((*controlId >= 0) && (*controlId < RAYGUI_MAX_CONTROLS) && (*propertyId >= 0) && (*propertyId < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED)));
+}
+
+// Parse batch value: decimal, hexadecimal (0x) or color (#rrggbb[aa])
+static bool ParseBatchValue(const char *text, int *value)
+{
+    char *end = NULL;
+
+    if (text[0] == '#')
+    {
+        int length = (int)strlen(text + 1);
+        unsigned int color = (unsigned int)strtoul(text + 1, &end, 16);
+
+        if ((*end != '\0') || ((length != 6) && (length != 8))) return false;
+        if (length == 6) color = (color << 8) | 0xff;     // Opaque color if no alpha provided
+
+        *value = (int)color;
+    }
+    else if ((text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X')))
+    {
+        if (text[2] == '\0') return false;
+        *value = (int)strtoul(text + 2, &end, 16);
+    }
+    else *value = (int)strtol(text, &end, 10);
+
+    return (*end == '\0');
+}
+
+// Transform current style colors (hue rotation, lightness inversion)
+// NOTE: DEFAULT colors are set first (propagated), then controls overriding them, alpha is kept
+static void TransformStyleColors(float hueRotation, bool swapLightDark)
+{
+    int colorProps[TEXT_COLOR_DISABLED + 3] = { 0 };
+    for (int i = 0; i <= TEXT_COLOR_DISABLED; i++) colorProps[i] = i;
+    colorProps[TEXT_COLOR_DISABLED + 1] = LINE_COLOR;
+    colorProps[TEXT_COLOR_DISABLED + 2] = BACKGROUND_COLOR;
+
+    for (int p = 0; p < (TEXT_COLOR_DISABLED + 3); p++)
+    {
+        int property = colorProps[p];
+        unsigned int overrides = GuiGetStyleOverrides(property);
+        int controlCount = (property < RAYGUI_MAX_PROPS_BASE)? RAYGUI_MAX_CONTROLS : 1;    // Extended colors: DEFAULT only
+        int values[RAYGUI_MAX_CONTROLS] = { 0 };
+
+        for (int i = 0; i < controlCount; i++) values[i] = GuiGetStyle(i, property);
+
+        for (int i = 0; i < controlCount; i++)
+        {
+            if ((i > 0) && !(overrides & (1u << i))) continue;
+
+            Color color = GetColor(values[i]);
+            Vector3 hsv = ColorToHSV(color);
+
+            hsv.x = fmodf(hsv.x + hueRotation, 360.0f);
+            if (hsv.x < 0.0f) hsv.x += 360.0f;
+            if (swapLightDark) hsv.z = 1.0f - hsv.z;
+
+            Color result = ColorFromHSV(hsv.x, hsv.y, hsv.z);
+            result.a = color.a;
+
+            GuiSetStyle(i, property, ColorToInt(result));
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------
+// Style layers functions
+//--------------------------------------------------------------------------------------------
+
+// Push style file as top layer (current style if no file provided), returns result code
+// NOTE: Current style changes over previous layers are kept over the new layer
+static int PushStyleLayer(const char *fileName)
+{
+    rgs_style *changes = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    rgs_layers_get_delta(styleLayers, styleLayers->layer_count, GuiGetStyleData(), changes);
+
+    int result = RGS_OK;
+
+    if (fileName == NULL)
+    {
+        // Current style changes become the new layer, no changes left to apply over it
+        result = rgs_layers_push(styleLayers, changes);
+        changes->property_count = 0;
+    }
+    else
+    {
+        rgs_style *style = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+
+        result = rgs_load(style, fileName);
+        if (result == RGS_OK) result = rgs_layers_push(styleLayers, style);
+
+        rgs_unload(style);
+        RL_FREE(style);
+    }
+
+    if (result >= 0)
+    {
+        UpdateStyleLayers(changes);
+        result = RGS_OK;
+    }
+    else LOG("WARNING: Style layer could not be pushed: %s\n", rgs_result_text(result));
+
+    RL_FREE(changes);
+
+    return result;
+}
+
+// Replace style layer with style file, returns result code
+// NOTE: Only properties touched by previous and new layer are resolved again, current style changes are kept
+static int ReplaceStyleLayer(int layer, const char *fileName)
+{
+    rgs_style *changes = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    rgs_style *style = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    rgs_layers_get_delta(styleLayers, styleLayers->layer_count, GuiGetStyleData(), changes);
+
+    int result = rgs_load(style, fileName);
+    if (result == RGS_OK) result = rgs_layers_set_layer(styleLayers, layer, style);
+
+    if (result == RGS_OK) UpdateStyleLayers(changes);
+    else LOG("WARNING: Style layer could not be replaced: %s\n", rgs_result_text(result));
+
+    rgs_unload(style);
+    RL_FREE(style);
+    RL_FREE(changes);
+
+    return result;
+}
+
+// Pop style layers top layer, current style changes are kept
+static void PopStyleLayer(void)
+{
+    if (styleLayers->layer_count == 0) return;
+
+    rgs_style *changes = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    rgs_layers_get_delta(styleLayers, styleLayers->layer_count, GuiGetStyleData(), changes);
+
+    rgs_layers_pop(styleLayers);
+    UpdateStyleLayers(changes);
+
+    RL_FREE(changes);
+}
+
+// Save current style changes over style layers as layer style file (.rgs), returns result code
+// NOTE: Layer style file only contains properties, font and icons are kept by full style files
+static int SaveStyleLayer(const char *fileName)
+{
+    rgs_style *changes = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+    rgs_layers_get_delta(styleLayers, styleLayers->layer_count, GuiGetStyleData(), changes);
+
+    int result = rgs_save(changes, fileName, propsCompactChecked? RGS_SAVE_PROPS_COMPACT : 0);
+    if (result != RGS_OK) LOG("WARNING: Style layer could not be saved: %s\n", rgs_result_text(result));
+
+    RL_FREE(changes);
+
+    return result;
+}
+
+// Update current style with style layers resolved changes, current style changes applied over
+// NOTE: Only resolved values changed are set, they already consider DEFAULT properties propagation
+static void UpdateStyleLayers(const rgs_style *changes)
+{
+    unsigned int *style = GuiGetStyleData();
+    rgs_property *resolved = (rgs_property *)RL_MALLOC(RGS_MAX_PROPERTIES*sizeof(rgs_property));
+    int resolvedCount = rgs_layers_resolve(styleLayers, resolved, RGS_MAX_PROPERTIES);
+
+    for (int i = 0; i < resolvedCount; i++) style[resolved[i].control_id*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + resolved[i].property_id] = resolved[i].value;
+    GuiSetStyleData(style);     // Style data modified directly, controls overrides rebuilt
+
+    // Current style changes applied same as style loading, DEFAULT properties first (propagated)
+    for (int i = 0; i < changes->property_count; i++) GuiSetStyle(changes->properties[i].control_id, changes->properties[i].property_id, (int)changes->properties[i].value);
+
+    RL_FREE(resolved);
+}
+
+//--------------------------------------------------------------------------------------------
+// Style parameters functions
+//--------------------------------------------------------------------------------------------
+// Apply style parameters to current style, compiled into DEFAULT style properties
+// NOTE: DEFAULT base properties are propagated to all controls, controls specific changes are overriden
+static void ApplyStyleParams(const rgs_params *params)
+{
+    rgs_style *style = (rgs_style *)RL_CALLOC(1, sizeof(rgs_style));
+
+    int count = rgs_params_compile(params, style, NULL);
+    for (int i = 0; i < count; i++) GuiSetStyle(style->properties[i].control_id, style->properties[i].property_id, (int)style->properties[i].value);
+
+    RL_FREE(style);
+}
+
+// Generate random style parameters (harmony rule and base colors)
+static void GenStyleParamsRandom(rgs_params *params)
+{
+    rgs_params_default(params);
+
+    params->hue = (float)GetRandomValue(0, 360);
+    params->base_value = GetRandomValue(0, 100)/100.0f;
+    params->base_saturation = GetRandomValue(4, 7)/10.0f;
+    params->saturation = 0.8f;
+    params->disabled_saturation = 0.25f;
+    params->state_shift = GetRandomValue(5, 15)/100.0f;
+
+    // Focused/pressed colors: complementary or split complementary hues
+    params->harmony = GetRandomValue(RGS_HARMONY_MONOCHROME, RGS_HARMONY_SPLIT);
+    params->harmony_angle = (params->harmony == RGS_HARMONY_SPLIT)? (float)GetRandomValue(60, 160) : 180.0f;
+}
+
+//--------------------------------------------------------------------------------------------
+// Input session functions (record/replay)
+//--------------------------------------------------------------------------------------------
+// NOTE: Input session file is a raylib automation events file (.rae, text), keys, mouse and window
+// events are recorded per frame and played at same frame on replay, dropped files (d <frame> <path>)
+// and session frames count (s <frames>) are appended as additional lines, ignored by raylib
+// WARNING: Native file dialogs are not recorded, files should be dropped for sessions to be replayable
+
+// Parse input session command-line options, returns true if session requested
+static bool ParseInputSession(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-r") == 0) || (strcmp(argv[i], "--record") == 0) ||
+            (strcmp(argv[i], "-y") == 0) || (strcmp(argv[i], "--replay") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-') && (strlen(argv[i + 1]) < 512))
+            {
+                if ((strcmp(argv[i], "-r") == 0) || (strcmp(argv[i], "--record") == 0)) inputSessionMode = INPUT_SESSION_RECORD;
+                else inputSessionMode = INPUT_SESSION_REPLAY;
+
+                strcpy(inputSessionFileName, argv[i + 1]);
+                i++;
+            }
+            else LOG("WARNING: No input session file provided\n");
+        }
+        else if ((strcmp(argv[i], "-t") == 0) || (strcmp(argv[i], "--trace") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-') && (strlen(argv[i + 1]) < 512))
+            {
+                strcpy(inputSessionTraceFileName, argv[i + 1]);
+                i++;
+            }
+        }
+        else if ((strcmp(argv[i], "-m") == 0) || (strcmp(argv[i], "--max-frame-time") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                inputSessionMaxFrameTime = (float)atof(argv[i + 1]);
+                i++;
+            }
+        }
+    }
+
+    return (inputSessionMode != INPUT_SESSION_NONE);
+}
+
+// Init input session (window required), returns false if session could not be loaded
+static bool InitInputSession(void)
+{
+    inputSessionFrame = 0;
+    inputEventsPlayed = 0;
+    inputDropsCount = 0;
+
+    if (inputSessionMode == INPUT_SESSION_RECORD)
+    {
+        inputEvents = LoadAutomationEventList(NULL);    // Empty events list (MAX_AUTOMATION_EVENTS capacity)
+        SetAutomationEventList(&inputEvents);
+        SetAutomationEventBaseFrame(0);
+        StartAutomationEventRecording();
+    }
+    else if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        char *text = LoadFileText(inputSessionFileName);
+
+        if (text == NULL)
+        {
+            printf("WARNING: Input session file could not be loaded: %s\n", inputSessionFileName);
+            return false;
+        }
+
+        inputEvents = LoadAutomationEventList(inputSessionFileName);
+
+        // Load dropped files and session frames, one entry per line
+        int linesCount = 1;
+        for (char *c = text; *c != '\0'; c++) if (*c == '\n') linesCount++;
+        inputDrops = (InputSessionDrop *)RL_CALLOC(linesCount, sizeof(InputSessionDrop));
+
+        for (char *line = text; (line != NULL) && (*line != '\0'); )
+        {
+            char *next = strchr(line, '\n');
+            if (next != NULL) *next = '\0';
+
+            int length = (int)strlen(line);
+            if ((length > 0) && (line[length - 1] == '\r')) line[length - 1] = '\0';
+
+            if ((line[0] == 's') && (line[1] == ' ')) inputSessionFramesCount = atoi(line + 2);
+            else if ((line[0] == 'd') && (line[1] == ' '))
+            {
+                char *path = strchr(line + 2, ' ');
+
+                if (path != NULL)
+                {
+                    inputDrops[inputDropsCount].frame = atoi(line + 2);
+                    inputDrops[inputDropsCount].filePath = (char *)RL_CALLOC(strlen(path + 1) + 1, 1);
+                    strcpy(inputDrops[inputDropsCount].filePath, path + 1);
+                    inputDropsCount++;
+                }
+            }
+
+            line = (next != NULL)? (next + 1) : NULL;
+        }
+
+        UnloadFileText(text);
+
+        // Plain automation events files (no session frames) replayed until last event
+        if ((inputSessionFramesCount == 0) && (inputEvents.count > 0)) inputSessionFramesCount = inputEvents.events[inputEvents.count - 1].frame + 1;
+        if (inputSessionFramesCount <= 0)
+        {
+            printf("WARNING: Input session file does not contain any frame: %s\n", inputSessionFileName);
+            return false;
+        }
+
+        inputFrameTimes = (float *)RL_CALLOC(inputSessionFramesCount, sizeof(float));
+
+        InitTrace();    // Frame sections always traced, required for replay summary
+    }
+
+    return true;
+}
+
+// Close input session, saving recorded session or showing replay summary, returns exit code
+// NOTE: Exit code is 1 if replay frame time limit is exceeded (95th percentile)
+static int CloseInputSession(void)
+{
+    int exitCode = 0;
+
+    if (inputSessionMode == INPUT_SESSION_RECORD)
+    {
+        StopAutomationEventRecording();
+
+        if (ExportAutomationEventList(inputEvents, inputSessionFileName))
+        {
+            FILE *sessionFile = fopen(inputSessionFileName, "at");
+
+            if (sessionFile != NULL)
+            {
+                fprintf(sessionFile, "# %s v%s input session: dropped files and session frames\n", toolName, toolVersion);
+                fprintf(sessionFile, "#    d <frame> <path>\n#    s <frames>\n");
+                for (int i = 0; i < inputDropsCount; i++) fprintf(sessionFile, "d %i %s\n", inputDrops[i].frame, inputDrops[i].filePath);
+                fprintf(sessionFile, "s %i\n", inputSessionFrame);
+                fclose(sessionFile);
+            }
+
+            printf("\nInput session:    %s\n", inputSessionFileName);
+            printf("Frames recorded:  %i (%i events, %i files dropped)\n", inputSessionFrame, inputEvents.count, inputDropsCount);
+            if (inputEvents.count >= inputEvents.capacity) printf("WARNING: Input events limit reached, session is incomplete\n");
+        }
+        else printf("WARNING: Input session file could not be saved: %s\n", inputSessionFileName);
+    }
+    else if ((inputSessionMode == INPUT_SESSION_REPLAY) && (inputFrameTimes == NULL)) exitCode = 1;   // Session could not be loaded
+    else if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        printf("\nInput session:    %s\n", inputSessionFileName);
+        printf("Frames replayed:  %i/%i\n", inputSessionFrame, inputSessionFramesCount);
+
+        if (inputSessionFrame > 0)
+        {
+            float totalTime = 0.0f;
+            for (int i = 0; i < inputSessionFrame; i++) totalTime += inputFrameTimes[i];
+
+            qsort(inputFrameTimes, inputSessionFrame, sizeof(float), CompareFrameTimes);
+
+            float p95FrameTime = inputFrameTimes[(int)(0.95f*(inputSessionFrame - 1))];
+
+            printf("Frame time (ms):  avg %.3f | p50 %.3f | p95 %.3f | p99 %.3f | max %.3f\n", totalTime/inputSessionFrame,
+                inputFrameTimes[(int)(0.5f*(inputSessionFrame - 1))], p95FrameTime, inputFrameTimes[(int)(0.99f*(inputSessionFrame - 1))], inputFrameTimes[inputSessionFrame - 1]);
+
+            // Show sections summary, spans grouped by name (accounted on span end, complete for the whole session)
+            printf("\nSection           Count     Total (ms)   Avg (ms)   Max (ms)\n");
+            for (int k = 0; k < traceSectionsCount; k++)
+            {
+                printf("%-16s %6i %14.3f %10.3f %10.3f\n", traceSections[k].name, traceSections[k].count, traceSections[k].total/1000.0,
+                    traceSections[k].total/1000.0/traceSections[k].count, traceSections[k].max/1000.0);
+            }
+
+            if ((inputSessionMaxFrameTime > 0.0f) && (p95FrameTime > inputSessionMaxFrameTime))
+            {
+                printf("\nFAILED: Frame time p95 %.3f ms exceeds limit %.3f ms\n", p95FrameTime, inputSessionMaxFrameTime);
+                exitCode = 1;
+            }
+        }
+
+        CloseTrace((inputSessionTraceFileName[0] != '\0')? inputSessionTraceFileName : NULL);
+    }
+
+    UnloadAutomationEventList(&inputEvents);
+    for (int i = 0; i < inputDropsCount; i++) RL_FREE(inputDrops[i].filePath);
+    RL_FREE(inputDrops);
+    RL_FREE(inputFrameTimes);
+    inputDrops = NULL;
+    inputDropsCount = 0;
+    inputFrameTimes = NULL;
+
+    return exitCode;
+}
+
+// Begin input session frame, replaying frame events, returns false when replay is finished
+// NOTE: Multiple events could be played in a single frame
+static bool BeginInputSessionFrame(void)
+{
+    if (inputSessionMode != INPUT_SESSION_REPLAY) return true;
+    if (inputSessionFrame >= inputSessionFramesCount) return false;
+
+    inputFrameStartTime = GetTraceTime();
+    BeginTraceSpan("frame");
+
+    while ((inputEventsPlayed < (int)inputEvents.count) && ((int)inputEvents.events[inputEventsPlayed].frame <= inputSessionFrame))
+    {
+        PlayAutomationEvent(inputEvents.events[inputEventsPlayed]);
+        inputEventsPlayed++;
+    }
+
+    return true;
+}
+
+// End input session frame, frame time registered
+static void EndInputSessionFrame(void)
+{
+    if (inputSessionMode == INPUT_SESSION_NONE) return;
+
+    if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        EndTraceSpan();
+        inputFrameTimes[inputSessionFrame] = (float)((GetTraceTime() - inputFrameStartTime)/1000.0);
+    }
+
+    inputSessionFrame++;
+}
+
+// Compare frame times (qsort)
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------
+// Dropped files functions
+//--------------------------------------------------------------------------------------------
+
+// Check if a file has been dropped (or replayed) this frame
+static bool IsInputFileDropped(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        for (int i = 0; i < inputDropsCount; i++) if (inputDrops[i].frame == inputSessionFrame) return true;
+
+        return false;
+    }
+#endif
+    return IsFileDropped();
+}
+
+// Load dropped files paths, recorded on input session recording
+static FilePathList LoadInputDroppedFiles(void)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        // NOTE: Only paths array is allocated, paths are kept by input session
+        FilePathList files = { 0 };
+        files.paths = (char **)RL_CALLOC(inputDropsCount, sizeof(char *));
+
+        for (int i = 0; i < inputDropsCount; i++)
+        {
+            if (inputDrops[i].frame == inputSessionFrame) files.paths[files.count++] = inputDrops[i].filePath;
+        }
+
+        files.capacity = files.count;
+
+        return files;
+    }
+#endif
+    FilePathList files = LoadDroppedFiles();
+
+#if defined(PLATFORM_DESKTOP)
+    if (inputSessionMode == INPUT_SESSION_RECORD)
+    {
+        inputDrops = (InputSessionDrop *)RL_REALLOC(inputDrops, (inputDropsCount + files.count)*sizeof(InputSessionDrop));
+
+        for (unsigned int i = 0; i < files.count; i++)
+        {
+            inputDrops[inputDropsCount].frame = inputSessionFrame;
+            inputDrops[inputDropsCount].filePath = (char *)RL_CALLOC(strlen(files.paths[i]) + 1, 1);
+            strcpy(inputDrops[inputDropsCount].filePath, files.paths[i]);
+            inputDropsCount++;
+        }
+    }
+#endif
+    return files;
+}
+
+// Unload dropped files paths
+static void UnloadInputDroppedFiles(FilePathList files)
+{
+#if defined(PLATFORM_DESKTOP)
+    if (inputSessionMode == INPUT_SESSION_REPLAY)
+    {
+        RL_FREE(files.paths);
+        return;
+    }
+#endif
+    UnloadDroppedFiles(files);
+}
+
+//--------------------------------------------------------------------------------------------
+// Style tabs functions
+//--------------------------------------------------------------------------------------------
+
+// Store active editing data into style tab
+// NOTE: Style properties are already in tab (raygui style data), current font is moved to font cache
+static void StoreStyleTab(GuiStyleTab *tab)
+{
+    strcpy(tab->name, currentStyleName);
+    strcpy(tab->inFileName, inFileName);
+    strcpy(tab->outFileName, outFileName);
+    strcpy(tab->fontFileName, inFontFileName);
+    tab->inputFileLoaded = inputFileLoaded;
+    tab->outputFileCreated = outputFileCreated;
+    tab->fontLoaded = customFontLoaded;
+
+    // Shapes rectangle is only kept if shapes are drawn from font atlas
+    tab->shapesRec = (texShapes.id == GuiGetFont().texture.id)? texShapesRec : (Rectangle){ 0 };
+
+    // Move current font to font cache, previous tab font is released if not used any more
+    int fontId = CacheStyleFont();
+
+    if (fontId != tab->fontId)
+    {
+        if (fontId >= 0) styleFonts[fontId].refCount++;
+        ReleaseStyleFont(tab->fontId);
+        tab->fontId = fontId;
+    }
+
+    DetachStyleFont();
+}
+
+// Load style tab as active editing data
+// NOTE: Tab style data and icons are set as raygui data and cached font is just set, no data copied or reloaded
+static void LoadStyleTab(GuiStyleTab *tab)
+{
+    strcpy(currentStyleName, tab->name);
+    strcpy(inFileName, tab->inFileName);
+    strcpy(outFileName, tab->outFileName);
+    strcpy(inFontFileName, tab->fontFileName);
+    inputFileLoaded = tab->inputFileLoaded;
+    outputFileCreated = tab->outputFileCreated;
+    customFontLoaded = tab->fontLoaded;
+
+    if (tab->fontId >= 0)
+    {
+        customFont = styleFonts[tab->fontId].faces[0];
+        GuiSetFont(customFont);
+        for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++) GuiSetFontFace(i, styleFonts[tab->fontId].faces[i]);
+        customFontCached = true;
+    }
+    else
+    {
+        customFont = GetFontDefault();
+        GuiSetFont(customFont);
+        customFontCached = false;
+    }
+
+    // NOTE: Style data must be set after font faces, current face is selected from style
+    GuiSetStyleData(tab->style);
+    GuiSetIcons(tab->icons);
+    currentStyle = tab->refStyle;
+#if defined(PLATFORM_DESKTOP)
+    styleLayers = &tab->layers;
+#endif
+
+    if ((tab->shapesRec.width > 0) && (tab->shapesRec.height > 0)) SetShapesTexture(customFont.texture, tab->shapesRec);
+    else SetShapesTexture((Texture2D){ 0 }, (Rectangle){ 0 });
+}
+
+// Cache current gui font, fonts are shared by tabs using the same font (atlas texture)
+// NOTE: Current font faces are just moved into the cache entry, no font data is read back or copied
+// NOTE: If cache is full, an entry not referenced by any tab is evicted
+static int CacheStyleFont(void)
+{
+    int fontId = -1;
+    Font font = GuiGetFont();
+
+    // NOTE: raylib default font is never cached
+    if ((font.texture.id == 0) || (font.texture.id == GetFontDefault().texture.id)) return -1;
+
+    // Check if font is already cached (same atlas texture)
+    for (int i = 0; i < (MAX_STYLE_TABS + 1); i++)
+    {
+        if (styleFonts[i].faces[0].texture.id == font.texture.id) { fontId = i; break; }
+    }
+
+    if (fontId < 0)
+    {
+        // Evict one font not referenced by any tab if cache is full
+        // NOTE: Tabs reference one font each, so one entry is always available after eviction
+        bool cacheFull = true;
+        for (int i = 0; i < (MAX_STYLE_TABS + 1); i++) if (styleFonts[i].faces[0].texture.id == 0) { cacheFull = false; break; }
+
+        for (int i = 0; cacheFull && (i < (MAX_STYLE_TABS + 1)); i++)
+        {
+            if (styleFonts[i].refCount == 0)
+            {
+                UnloadStyleFont(i);
+                cacheFull = false;
+            }
+        }
+
+        // Add new font to cache
+        for (int i = 0; (fontId < 0) && (i < (MAX_STYLE_TABS + 1)); i++)
+        {
+            if (styleFonts[i].faces[0].texture.id == 0)
+            {
+                for (int f = 0; f < RAYGUI_MAX_FONT_FACES; f++) styleFonts[i].faces[f] = GuiGetFontFace(f);
+                styleFonts[i].refCount = 0;
+                fontId = i;
+            }
+        }
+
+        if (fontId < 0) LOG("WARNING: Style font could not be cached, cache is full\n");
+    }
+
+    if (fontId >= 0) customFontCached = true;
+
+    return fontId;
+}
+
+// Release font cache reference, font unloaded when not referenced by any tab
+static void ReleaseStyleFont(int fontId)
+{
+    if ((fontId >= 0) && (styleFonts[fontId].refCount > 0))
+    {
+        styleFonts[fontId].refCount--;
+
+        if (styleFonts[fontId].refCount == 0) UnloadStyleFont(fontId);
+    }
+}
 
-        fclose(txtFile);
+// Unload font cache entry, entry is cleared
+static void UnloadStyleFont(int fontId)
+{
+    // NOTE: Faces share main font atlas texture, only recs/glyphs are owned
+    for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++)
+    {
+        RL_FREE(styleFonts[fontId].faces[i].recs);
+        RL_FREE(styleFonts[fontId].faces[i].glyphs);
     }
+
+    UnloadFont(styleFonts[fontId].faces[0]);
+    memset(&styleFonts[fontId], 0, sizeof(GuiStyleFont));
 }
 
-// Draw controls table image
-static Image GenImageStyleControlsTable(const char *styleName)
+// Detach cached font from raygui, raylib default font is set
+// NOTE: Required before GuiLoadStyleDefault(), it unloads current gui font
+static void DetachStyleFont(void)
 {
-    #define TABLE_LEFT_PADDING      12
-    #define TABLE_TOP_PADDING       20
-
-    #define TABLE_CELL_HEIGHT       40
-    #define TABLE_CELL_PADDING       8          // Control padding inside cell
+    if (customFontCached)
+    {
+        for (int i = 1; i < RAYGUI_MAX_FONT_FACES; i++) GuiSetFontFace(i, (Font){ 0 });
+        GuiSetFont(GetFontDefault());
 
-    #define TABLE_CONTROLS_COUNT    13
+        // NOTE: Default raylib font character 95 is a white square
+        Rectangle whiteChar = GetFontDefault().recs[95];
+        SetShapesTexture(GetFontDefault().texture, (Rectangle){ whiteChar.x + 1, whiteChar.y + 1, whiteChar.width - 2, whiteChar.height - 2 });
 
-    enum TableControlType {
-        TYPE_LABEL = 0,
-        TYPE_BUTTON,
-        TYPE_TOGGLE,
-        TYPE_CHECKBOX,
-        TYPE_SLIDER,
-        TYPE_SLIDERBAR,
-        TYPE_PROGRESSBAR,
-        TYPE_TOGGLESLIDER,
-        TYPE_COMBOBOX,
-        TYPE_DROPDOWNBOX,
-        TYPE_TEXTBOX,
-        TYPE_VALUEBOX,
-        TYPE_SPINNER
-    };
+        customFontCached = false;
+    }
+}
 
-    static const char *tableStateName[4] = { "NORMAL", "FOCUSED", "PRESSED", "DISABLED" };
-    static const char *tableControlsName[TABLE_CONTROLS_COUNT] = {
-        "LABEL",        // LABELBUTTON
-        "BUTTON",
-        "TOGGLE",       // TOGGLEGROUP
-        "CHECKBOX",
-        "SLIDER",
-        "SLIDERBAR",
-        "PROGRESSBAR",
-        "TOGGLESLIDER",
-        "COMBOBOX",
-        "DROPDOWNBOX",
-        "TEXTBOX",      // TEXTBOXMULTI
-        "VALUEBOX",
-        "SPINNER"       // VALUEBOX + BUTTON
-    };
+//--------------------------------------------------------------------------------------------
+// Controls properties edition functions
+//--------------------------------------------------------------------------------------------
 
-    // Controls grid width
-    int controlWidth[TABLE_CONTROLS_COUNT] = {
-        100,    // LABEL
-        100,    // BUTTON
-        100,    // TOGGLE
-        200,    // CHECKBOX
-        100,    // SLIDER
-        100,    // SLIDERBAR
-        100,    // PROGRESSBAR
-        200,    // TOGGLESLIDER
-        140,    // COMBOBOX,
-        160,    // DROPDOWNBOX
-        100,    // TEXTBOX
-        100,    // VALUEBOX
-        101,    // SPINNER
-    };
+// Set controls properties value (bulk edit), previous values recorded as one change
+// NOTE: Only base properties of controls (not DEFAULT), written at once by raygui
+static void SetStyleBulk(unsigned int controls, unsigned int properties, int value, bool record)
+{
+    if (record) RecordStyleChange(controls & ~1u, properties, 0);
 
-    int tableStateNameWidth = 100;   // First column with state name width
+    GuiSetStyleBulk(controls, properties, value);
+}
 
-    int tableWidth = 0;
-    int tableHeight = 256;
+// Set DEFAULT property value, previous values recorded as one change
+// NOTE: DEFAULT base properties are propagated to all controls (overrides discarded), so all controls are recorded
+static void SetStyleDefault(int property, int value, bool record)
+{
+    if (record)
+    {
+        if (property < RAYGUI_MAX_PROPS_BASE) RecordStyleChange((1u << RAYGUI_MAX_CONTROLS) - 1, (1u << property), 0);
+        else RecordStyleChange(0, 0, (1u << (property - RAYGUI_MAX_PROPS_BASE)));
+    }
 
-    tableWidth = TABLE_LEFT_PADDING*2 + tableStateNameWidth;
-    for (int i = 0; i < TABLE_CONTROLS_COUNT; i++) tableWidth += ((controlWidth[i] + TABLE_CELL_PADDING*2) - 1);
+    GuiSetStyle(DEFAULT, property, value);
+}
 
-    // Controls required variables
-    int dropdownActive = 0;
-    int value = 40;
+// Record controls properties previous values and overrides as one change
+// NOTE: Oldest change discarded if changes list is full
+static void RecordStyleChange(unsigned int controls, unsigned int properties, unsigned int extended)
+{
+    if (styleChangesCount == MAX_UNDO_CHANGES)
+    {
+        memmove(styleChanges, styleChanges + 1, (MAX_UNDO_CHANGES - 1)*sizeof(GuiStyleChange));
+        styleChangesCount--;
+    }
 
-    Rectangle rec = { 0 };      // Current drawing rectangle space
+    GuiStyleChange *change = &styleChanges[styleChangesCount];
+    change->controls = controls;
+    change->properties = properties;
+    change->extended = extended;
 
-    RenderTexture2D target = LoadRenderTexture(tableWidth, tableHeight);
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        if (!(properties & (1u << j))) continue;
 
-    int sliderWidth = GuiGetStyle(SLIDER, SLIDER_WIDTH);
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, 10);
+        change->overrides[j] = GuiGetStyleOverrides(j);
 
-    // Texture rendering
-    //--------------------------------------------------------------------------------------------
-    BeginTextureMode(target);
+        for (int i = 0; i < RAYGUI_MAX_CONTROLS; i++)
+        {
+            if (controls & (1u << i)) change->values[i*RAYGUI_MAX_PROPS_BASE + j] = (unsigned int)GuiGetStyle(i, j);
+        }
+    }
 
-        ClearBackground(GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR)));
+    for (int j = 0; j < RAYGUI_MAX_PROPS_EXTENDED; j++)
+    {
+        if (extended & (1u << j)) change->extendedValues[j] = (unsigned int)GuiGetStyle(DEFAULT, RAYGUI_MAX_PROPS_BASE + j);
+    }
 
-        // Draw style title
-        GuiLabel((Rectangle){ TABLE_LEFT_PADDING, 15, 200, 20 }, TextFormat("raygui style: %s", styleName));
+    styleChangesCount++;
+}
 
-        // Draw left column
-        //----------------------------------------------------------------------------------------
-        rec = (Rectangle){ TABLE_LEFT_PADDING, TABLE_TOP_PADDING + TABLE_CELL_HEIGHT/2 + 20, tableStateNameWidth, TABLE_CELL_HEIGHT };
+// Undo last controls properties change, returns true if undone
+// NOTE: Controls overrides are restored as recorded, not overriding controls get DEFAULT value again
+static bool UndoStyleChange(void)
+{
+    if (styleChangesCount <= 0) return false;
 
-        for (int i = 0; i < 4; i++)
-        {
-            GuiGroupBox(rec, NULL);
+    styleChangesCount--;
+    GuiStyleChange *change = &styleChanges[styleChangesCount];
 
-            // Draw style rectangle
-            GuiSetState(i); GuiLabelButton((Rectangle){ rec.x + 28, rec.y, rec.width, rec.height }, tableStateName[i]);
-            rec.y += TABLE_CELL_HEIGHT - 1;             // NOTE: We add/remove 1px to draw lines overlapped!
-        }
-        //----------------------------------------------------------------------------------------
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        if (!(change->properties & (1u << j))) continue;
 
-        GuiSetState(STATE_NORMAL);
+        // NOTE: Overrides of controls not changed are kept, DEFAULT value set discards them
+        unsigned int overrides = (GuiGetStyleOverrides(j) & ~change->controls) | (change->overrides[j] & change->controls);
 
-        int offsetWidth = TABLE_LEFT_PADDING + tableStateNameWidth;
+        if (change->controls & 1u) GuiSetStyle(DEFAULT, j, (int)change->values[j]);
 
-        // Draw basic controls
-        for (int i = 0; i < TABLE_CONTROLS_COUNT; i++)
+        for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
         {
-            rec = (Rectangle){ offsetWidth - i - 1, TABLE_TOP_PADDING + 20, (controlWidth[i] + TABLE_CELL_PADDING*2), TABLE_CELL_HEIGHT/2 + 1 };
-
-            // Draw grid lines: control name
-            GuiGroupBox(rec, NULL);
-            int labelTextAlignment = GuiGetStyle(LABEL, TEXT_ALIGNMENT);
-            GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
-            GuiLabel(rec, tableControlsName[i]);
-
-            rec.y += TABLE_CELL_HEIGHT/2;
-            rec.height = TABLE_CELL_HEIGHT;
-
-            float tempFloat = 40.0f;
+            if ((change->controls & overrides) & (1u << i)) GuiSetStyle(i, j, (int)change->values[i*RAYGUI_MAX_PROPS_BASE + j]);
+        }
 
-            // Draw control 4 states: DISABLED, NORMAL, FOCUSED, PRESSED
-            for (int j = 0; j < 4; j++)
-            {
-                // Draw grid lines: control state
-                GuiGroupBox(rec, NULL);
+        GuiSetStyleOverrides(j, overrides);
+    }
 
-                bool tempBool = false;
-                int tempInt = 0;
+    for (int j = 0; j < RAYGUI_MAX_PROPS_EXTENDED; j++)
+    {
+        if (change->extended & (1u << j)) GuiSetStyle(DEFAULT, RAYGUI_MAX_PROPS_BASE + j, (int)change->extendedValues[j]);
+    }
 
-                GuiSetState(j);
-                    // Draw control centered correctly in grid
-                    switch (i)
-                    {
-                        case TYPE_LABEL: GuiLabelButton((Rectangle){ rec.x, rec.y, controlWidth[i], 40 }, "#10#Label"); break;
-                        case TYPE_BUTTON: GuiButton((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#2#Button"); break;
-                        case TYPE_TOGGLE: GuiToggle((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#39#Toggle", &tempBool); break;
-                        case TYPE_CHECKBOX:
-                        {
-                            GuiCheckBox((Rectangle){ rec.x + 10, rec.y + rec.height/2 - 15/2, 15, 15 }, "NoCheck", &tempBool);
-                            DrawRectangle(rec.x + rec.width/2, rec.y, 1, TABLE_CELL_HEIGHT, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
-                            tempBool = true;
-                            GuiCheckBox((Rectangle){ rec.x + rec.width/2 + 10, rec.y + rec.height/2 - 15/2, 15, 15 }, "Checked", &tempBool);
-                        } break;
-                        case TYPE_SLIDER: GuiSlider((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100); break;
-                        case TYPE_SLIDERBAR: GuiSliderBar((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100); break;
-                        case TYPE_PROGRESSBAR:
-                        {
-                            if (j < 3) GuiSetState(0);
-                            tempFloat = 60;
-                            GuiProgressBar((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 10/2, controlWidth[i], 10 }, NULL, NULL, &tempFloat, 0, 100);
-                            GuiSetState(j);
-                        } break;
-                        case TYPE_TOGGLESLIDER:
-                        {
-                            GuiSetStyle(SLIDER, SLIDER_PADDING, 2);
-                            GuiToggleSlider((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i]/2 - TABLE_CELL_PADDING, 24 }, "#87#OFF;#83#ON", &tempInt);
-                            DrawRectangle(rec.x + rec.width/2, rec.y, 1, TABLE_CELL_HEIGHT, GetColor(GuiGetStyle(DEFAULT, LINE_COLOR)));
-                            tempInt = 1;
-                            GuiToggleSlider((Rectangle){ rec.x + rec.width/2 + TABLE_CELL_PADDING, rec.y + rec.height/2 - 24/2, controlWidth[i]/2 - TABLE_CELL_PADDING, 24 }, "#87#OFF;#83#ON", &tempInt);
-                            GuiSetStyle(SLIDER, SLIDER_PADDING, 1);
-                        } break;
-                        case TYPE_COMBOBOX: GuiComboBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#40#ComboBox;ComboBox", 0); break;
-                        case TYPE_DROPDOWNBOX: GuiDropdownBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "#41#DropdownBox;DropdownBox", &dropdownActive, false); break;
-                        case TYPE_TEXTBOX: GuiTextBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, "text box", 32, false); break;
-                        case TYPE_VALUEBOX: GuiValueBox((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, NULL, &value, 0, 100, false); break;
-                        case TYPE_SPINNER: GuiSpinner((Rectangle){ rec.x + rec.width/2 - controlWidth[i]/2, rec.y + rec.height/2 - 24/2, controlWidth[i], 24 }, NULL, &value, 0, 100, false); break;
-                        default: break;
-                    }
-                GuiSetState(STATE_NORMAL);
+    return true;
+}
 
-                rec.y += TABLE_CELL_HEIGHT - 1;
-            }
+// Get properties of same kind (colors, sizes, alignment) as bit mask
+// NOTE: Same value can only be applied to properties of same kind
+static unsigned int GetPropertyKindMask(int property)
+{
+    unsigned int mask = 0;
 
-            GuiSetStyle(LABEL, TEXT_ALIGNMENT, labelTextAlignment);
+    if ((property >= 0) && (property <= TEXT_COLOR_DISABLED)) mask = (1u << (TEXT_COLOR_DISABLED + 1)) - 1;
+    else if ((property == BORDER_WIDTH) || (property == TEXT_PADDING)) mask = (1u << BORDER_WIDTH) | (1u << TEXT_PADDING);
+    else if (property == TEXT_ALIGNMENT) mask = (1u << TEXT_ALIGNMENT);
 
-            offsetWidth += (controlWidth[i] + TABLE_CELL_PADDING*2);
-        }
+    return mask;
+}
 
-        // Draw copyright and software info (bottom-right)
-        GuiLabel((Rectangle){ TABLE_LEFT_PADDING, tableHeight - 26, 400, 10 }, "raygui style table automatically generated with rGuiStyler");
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_RIGHT);
-        GuiLabel((Rectangle){ tableWidth - 400 - TABLE_LEFT_PADDING, tableHeight - 26, 400, 10 }, "rGuiStyler created by raylib technologies (@raylibtech)");
-        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+// Update list view multiple selection with clicked item, returns active item
+// NOTE: List view unselects active item when clicked again, in that case previous item was clicked,
+// removing an item makes first selected item active, last selected item can not be removed
+static int UpdateListSelection(unsigned int *selection, int previous, int current)
+{
+    int clicked = (current >= 0)? current : previous;
 
-    EndTextureMode();
-    //--------------------------------------------------------------------------------------------
+    if (*selection == 0) *selection = (1u << previous);
 
-    GuiSetStyle(SLIDER, SLIDER_WIDTH, sliderWidth);
+    if ((*selection & (1u << clicked)) && (*selection != (1u << clicked)))
+    {
+        *selection &= ~(1u << clicked);
 
-    Image imStyleTable = LoadImageFromTexture(target.texture);
-    ImageFlipVertical(&imStyleTable);
+        for (int i = 0; i < 32; i++) if (*selection & (1u << i)) return i;
+    }
 
-    UnloadRenderTexture(target);
+    *selection |= (1u << clicked);
 
-    return imStyleTable;
+    return clicked;
 }
 
 //--------------------------------------------------------------------------------------------
 // Auxiliar GUI functions
 //--------------------------------------------------------------------------------------------
 
-// Count changed properties in current style (raygui internal guiStyle) vs refStyle
+// Count changed properties in current style (raygui active style data) vs refStyle
 // WARNING: refStyle must be a valid raygui style data array (expected size)
 static int StyleChangesCounter(unsigned int *refStyle)
 {
@@ -2584,11 +6162,80 @@ static int StyleChangesCounter(unsigned int *refStyle)
     for (int i = 0; i < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); i++) if (refStyle[i] != GuiGetStyle(0, i)) changes++;
 
     // Add to count all properties that have changed in comparison to default style
+    changes += GetStyleControlsChanges(refStyle, NULL);
+
+    return changes;
+}
+
+// Get controls properties changed from ref style and not inherited from DEFAULT, returns changes count
+// NOTE: Base properties only checked for controls overriding DEFAULT (set bits of raygui overrides),
+// changes filled if provided (by control and property order), RAYGUI_MAX_CONTROLS*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) max
+static int GetStyleControlsChanges(const unsigned int *refStyle, rgs_property *changes)
+{
+    const int propsCount = RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED;
+    const unsigned int *style = GuiGetStyleData();      // Resolved style data, values read directly
+    unsigned int controlOverrides[RAYGUI_MAX_CONTROLS] = { 0 };     // Base properties overridden per control (bit per property)
+    int count = 0;
+
+    // Transpose overrides (controls per property) into base properties per control
+    for (int j = 0; j < RAYGUI_MAX_PROPS_BASE; j++)
+    {
+        for (unsigned int bits = GuiGetStyleOverrides(j) & ~1u; bits != 0; bits &= (bits - 1)) controlOverrides[GetLowestBitIndex(bits)] |= (1u << j);
+    }
+
     for (int i = 1; i < RAYGUI_MAX_CONTROLS; i++)
     {
-        for (int j = 0; j < (RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED); j++)
+        // NOTE: Extended properties are not inherited, all of them checked (after base properties)
+        unsigned int bits = controlOverrides[i];
+        int j = (bits != 0)? GetLowestBitIndex(bits) : RAYGUI_MAX_PROPS_BASE;
+
+        while (j < propsCount)
+        {
+            unsigned int value = style[i*propsCount + j];
+
+            if ((refStyle[i*propsCount + j] != value) && (value != style[j]))
+            {
+                if (changes != NULL) changes[count] = (rgs_property){ (unsigned short)i, (unsigned short)j, value };
+                count++;
+            }
+
+            if (j < RAYGUI_MAX_PROPS_BASE)
+            {
+                bits &= (bits - 1);
+                j = (bits != 0)? GetLowestBitIndex(bits) : RAYGUI_MAX_PROPS_BASE;
+            }
+            else j++;
+        }
+    }
+
+    return count;
+}
+
+// Get lowest set bit index (bits must not be 0)
+static int GetLowestBitIndex(unsigned int bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(bits);
+#else
+    int index = 0;
+    while (!(bits & 1u)) { bits >>= 1; index++; }
+    return index;
+#endif
+}
+
+// Count changed icons in current icons set vs default icons
+// NOTE: Changed icons id map filled if provided, one bit per icon id
+static int StyleIconsChangesCounter(unsigned char *iconsMap)
+{
+    int changes = 0;
+    unsigned int *icons = GuiGetIcons();
+
+    for (int i = 0; i < RAYGUI_ICON_MAX_ICONS; i++)
+    {
+        if (memcmp(icons + i*RAYGUI_ICON_DATA_ELEMENTS, defaultIcons + i*RAYGUI_ICON_DATA_ELEMENTS, RAYGUI_ICON_DATA_ELEMENTS*sizeof(unsigned int)) != 0)
         {
-            if ((refStyle[i*(RAYGUI_MAX_PROPS_BASE + RAYGUI_MAX_PROPS_EXTENDED) + j] != GuiGetStyle(i, j)) && (GuiGetStyle(i, j) !=  GuiGetStyle(0, j))) changes++;
+            if (iconsMap != NULL) iconsMap[i/8] |= (1 << (i%8));
+            changes++;
         }
     }
 
@@ -2599,10 +6246,9 @@ static int StyleChangesCounter(unsigned int *refStyle)
 // NOTE: It requires colorPicker pointer for updating in case of selection
 static Color GuiColorBox(Rectangle bounds, Color *colorPicker, Color color)
 {
-    Vector2 mousePoint = GetMousePosition();
-
     // Update color box
-    if (CheckCollisionPointRec(mousePoint, bounds))
+    // NOTE: Bounds registered for partial redraw, as any raygui control
+    if (GuiCheckMouseHover(bounds))
     {
         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) *colorPicker = (Color){ color.r, color.g, color.b, color.a };
         else if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON)) color = *colorPicker;
@@ -2614,3 +6260,62 @@ static Color GuiColorBox(Rectangle bounds, Color *colorPicker, Color color)
 
     return color;
 }
+
+// Load text codepoints without duplicates, sorted by frequency (first occurrence order kept on same frequency)
+// NOTE: Codepoints order defines glyphs priority on font atlas budget mode, a charset file keeps its own order
+// (every codepoint once) while a text corpus gets its most used codepoints first, list freed with RL_FREE()
+static int *LoadCodepointsByFrequency(const char *text, int *count)
+{
+    int codepointsCount = 0;
+    int *codepoints = LoadCodepoints(text, &codepointsCount);
+
+    // Codepoints entries: value, first occurrence, frequency
+    int *entries = (int *)RL_CALLOC(codepointsCount*3, sizeof(int));
+    for (int i = 0; i < codepointsCount; i++) { entries[i*3] = codepoints[i]; entries[i*3 + 1] = i; }
+    UnloadCodepoints(codepoints);
+
+    // Group same codepoints together and merge them into first occurrence entry
+    qsort(entries, codepointsCount, 3*sizeof(int), CompareCodepointsValue);
+
+    int uniqueCount = 0;
+    for (int i = 0; i < codepointsCount; i++)
+    {
+        if ((uniqueCount > 0) && (entries[(uniqueCount - 1)*3] == entries[i*3])) entries[(uniqueCount - 1)*3 + 2]++;
+        else
+        {
+            entries[uniqueCount*3] = entries[i*3];
+            entries[uniqueCount*3 + 1] = entries[i*3 + 1];
+            entries[uniqueCount*3 + 2] = 1;
+            uniqueCount++;
+        }
+    }
+
+    qsort(entries, uniqueCount, 3*sizeof(int), CompareCodepointsFrequency);
+
+    int *result = (int *)RL_CALLOC((uniqueCount > 0)? uniqueCount : 1, sizeof(int));
+    for (int i = 0; i < uniqueCount; i++) result[i] = entries[i*3];
+    RL_FREE(entries);
+
+    *count = uniqueCount;
+    return result;
+}
+
+// Compare codepoints entries by value, first occurrence order on same value
+static int CompareCodepointsValue(const void *a, const void *b)
+{
+    const int *entryA = (const int *)a;
+    const int *entryB = (const int *)b;
+
+    if (entryA[0] != entryB[0]) return (entryA[0] < entryB[0])? -1 : 1;
+    return (entryA[1] < entryB[1])? -1 : (entryA[1] > entryB[1]);
+}
+
+// Compare codepoints entries by frequency (descending), first occurrence order on same frequency
+static int CompareCodepointsFrequency(const void *a, const void *b)
+{
+    const int *entryA = (const int *)a;
+    const int *entryB = (const int *)b;
+
+    if (entryA[2] != entryB[2]) return (entryA[2] > entryB[2])? -1 : 1;
+    return (entryA[1] < entryB[1])? -1 : (entryA[1] > entryB[1]);
+}
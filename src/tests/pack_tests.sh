@@ -0,0 +1,44 @@
+#!/bin/sh
+#**************************************************************************************************
+#
+#   rGuiStyler style templates pack tests: pack file and pack appended to executable round-trip
+#
+#   USAGE: sh tests/pack_tests.sh <rguistyler_executable> <styles_directory>
+#
+#**************************************************************************************************
+
+TOOL="$1"
+STYLES_DIR="${2:-../styles}"
+TEMP_DIR="$(mktemp -d)"
+FAILED=0
+
+trap 'rm -rf "$TEMP_DIR"' EXIT
+
+check()
+{
+    if [ "$2" = "$3" ]; then echo "PASS: $1"
+    else echo "FAIL: $1 (expected: $3, got: $2)"; FAILED=1
+    fi
+}
+
+EXPECTED_COUNT=$(ls "$STYLES_DIR"/*.rgs | wc -l | tr -d ' ')
+
+# Pack file
+"$TOOL" --pack "$STYLES_DIR" --output "$TEMP_DIR/styles.rgp" > /dev/null
+PACK_INFO=$("$TOOL" --pack-info "$TEMP_DIR/styles.rgp")
+check "pack file entries" "$(echo "$PACK_INFO" | sed -n 's/^Pack entries: //p')" "$EXPECTED_COUNT"
+check "pack file offset" "$(echo "$PACK_INFO" | sed -n 's/^Pack offset: //p')" "0"
+
+# Pack appended to executable
+cat "$TOOL" "$TEMP_DIR/styles.rgp" > "$TEMP_DIR/appended"
+APPENDED_INFO=$("$TOOL" --pack-info "$TEMP_DIR/appended")
+check "appended pack entries" "$(echo "$APPENDED_INFO" | sed -n 's/^Pack entries: //p')" "$EXPECTED_COUNT"
+check "appended pack offset" "$(echo "$APPENDED_INFO" | sed -n 's/^Pack offset: //p')" "$(wc -c < "$TOOL" | tr -d ' ')"
+check "appended pack index" "$(echo "$APPENDED_INFO" | grep -v '^Pack offset')" "$(echo "$PACK_INFO" | grep -v '^Pack offset')"
+
+# Truncated pack, entries data out of pack must be rejected
+head -c 200 "$TEMP_DIR/styles.rgp" > "$TEMP_DIR/truncated.rgp"
+"$TOOL" --pack-info "$TEMP_DIR/truncated.rgp" > /dev/null 2>&1
+check "truncated pack rejected" "$?" "1"
+
+exit $FAILED
@@ -0,0 +1,263 @@
+/**********************************************************************************************
+*
+*   rgs library tests: font atlas block compression (BC4/EAC encode -> decode error bounds),
+*   corrupted style data loading (properties compact encoding truncation, corrupted DEFLATE streams)
+*
+*   USAGE: make tests (or: cc -o rgs_tests tests/rgs_tests.c -I. -Iexternal -lm && ./rgs_tests)
+*
+**********************************************************************************************/
+
+#define RGS_IMPLEMENTATION
+#include "rgs.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: abs(), rand(), srand()
+#include <math.h>               // Required for: sqrtf()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Max RMS error allowed per block: BC4 8-values mode palette step is range/7 (error <= 255/14 + rounding),
+// encoder only picks 6-values mode when its squared error is lower; EAC tables are denser around base
+#define BC4_MAX_ERROR_RMS           19.0f
+#define EAC_MAX_ERROR_RMS           16.0f
+
+// Max absolute error allowed per pixel (worst case, modes/tables selected by squared error)
+#define BC4_MAX_ERROR               32
+#define EAC_MAX_ERROR               40
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static int testsFailed = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+static void Check(const char *name, int condition)
+{
+    if (condition) printf("PASS: %s\n", name);
+    else { printf("FAIL: %s\n", name); testsFailed++; }
+}
+
+// Encode and decode block, returns max absolute error and RMS error
+static int BlockRoundTripError(const unsigned char *alpha, int format, float *rmsError)
+{
+    unsigned char block[8] = { 0 };
+    unsigned char decoded[16] = { 0 };
+    int maxError = 0;
+    int sumSquared = 0;
+
+    if (format == RGS_PIXELFORMAT_DXT5_RGBA) { rgs_encode_block_bc4(alpha, block); rgs_decode_block_bc4(block, decoded); }
+    else { rgs_encode_block_eac(alpha, block); rgs_decode_block_eac(block, decoded); }
+
+    for (int i = 0; i < 16; i++)
+    {
+        int error = abs(alpha[i] - decoded[i]);
+
+        if (error > maxError) maxError = error;
+        sumSquared += error*error;
+    }
+
+    if (rmsError != NULL) *rmsError = sqrtf(sumSquared/16.0f);
+
+    return maxError;
+}
+
+// Font-like alpha values: mostly 0/255 with an antialiased edge ramp
+static void GenFontLikeBlock(unsigned char *alpha)
+{
+    int edge = rand()%8;
+    int slope = 32 + rand()%96;
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            int value = (x + y - edge)*slope + 128;
+            alpha[y*4 + x] = (unsigned char)((value < 0)? 0 : ((value > 255)? 255 : value));
+        }
+    }
+}
+
+int main(void)
+{
+    const int formats[2] = { RGS_PIXELFORMAT_DXT5_RGBA, RGS_PIXELFORMAT_ETC2_EAC_RGBA };
+    const char *formatNames[2] = { "BC4", "EAC" };
+    const float maxErrorRms[2] = { BC4_MAX_ERROR_RMS, EAC_MAX_ERROR_RMS };
+    const int maxErrorPixel[2] = { BC4_MAX_ERROR, EAC_MAX_ERROR };
+    char name[128] = { 0 };
+
+    srand(1234);
+
+    for (int f = 0; f < 2; f++)
+    {
+        unsigned char alpha[16] = { 0 };
+        int maxError = 0;
+        float maxRms = 0.0f, rms = 0.0f;
+
+        // Uniform blocks are encoded exactly
+        for (int value = 0; value < 256; value++)
+        {
+            for (int i = 0; i < 16; i++) alpha[i] = (unsigned char)value;
+
+            int error = BlockRoundTripError(alpha, formats[f], NULL);
+            if (error > maxError) maxError = error;
+        }
+
+        sprintf(name, "%s uniform blocks exact (max error: %i)", formatNames[f], maxError);
+        Check(name, maxError == 0);
+
+        // Transparent/opaque blocks (glyph interior and background) are encoded exactly
+        maxError = 0;
+
+        for (int n = 0; n < 1000; n++)
+        {
+            for (int i = 0; i < 16; i++) alpha[i] = (rand()%2)? 255 : 0;
+
+            int error = BlockRoundTripError(alpha, formats[f], NULL);
+            if (error > maxError) maxError = error;
+        }
+
+        sprintf(name, "%s binary blocks exact (max error: %i)", formatNames[f], maxError);
+        Check(name, maxError == 0);
+
+        // Font-like blocks (antialiased edges) and random blocks (worst case)
+        for (int type = 0; type < 2; type++)
+        {
+            maxError = 0;
+            maxRms = 0.0f;
+
+            for (int n = 0; n < 10000; n++)
+            {
+                if (type == 0) GenFontLikeBlock(alpha);
+                else for (int i = 0; i < 16; i++) alpha[i] = (unsigned char)(rand()%256);
+
+                int error = BlockRoundTripError(alpha, formats[f], &rms);
+                if (error > maxError) maxError = error;
+                if (rms > maxRms) maxRms = rms;
+            }
+
+            sprintf(name, "%s %s blocks error bound (rms: %.2f <= %.2f, max: %i <= %i)", formatNames[f], (type == 0)? "font-like" : "random",
+                maxRms, maxErrorRms[f], maxError, maxErrorPixel[f]);
+            Check(name, (maxRms <= maxErrorRms[f]) && (maxError <= maxErrorPixel[f]));
+        }
+
+        // Font atlas encode/decode: GRAY+ALPHA output, gray always white, alpha within block error
+        int width = 64, height = 32;
+        unsigned char *atlas = (unsigned char *)RGS_MALLOC(width*height);
+
+        for (int by = 0; by < height/4; by++)
+        {
+            for (int bx = 0; bx < width/4; bx++)
+            {
+                GenFontLikeBlock(alpha);
+                for (int i = 0; i < 16; i++) atlas[(by*4 + i/4)*width + bx*4 + i%4] = alpha[i];
+            }
+        }
+
+        unsigned char *blocks = rgs_font_atlas_encode(atlas, width, height, formats[f]);
+        unsigned char *decoded = rgs_font_atlas_decode(blocks, width, height, formats[f]);
+        bool grayWhite = true;
+        maxError = 0;
+
+        for (int i = 0; (decoded != NULL) && (i < width*height); i++)
+        {
+            if (decoded[i*2] != 255) grayWhite = false;
+            if (abs(decoded[i*2 + 1] - atlas[i]) > maxError) maxError = abs(decoded[i*2 + 1] - atlas[i]);
+        }
+
+        sprintf(name, "%s font atlas round trip (max error: %i <= %i)", formatNames[f], maxError, maxErrorPixel[f]);
+        Check(name, (blocks != NULL) && (decoded != NULL) && grayWhite && (maxError <= maxErrorPixel[f]));
+
+        RGS_FREE(decoded);
+        RGS_FREE(blocks);
+        RGS_FREE(atlas);
+
+        // Invalid parameters
+        unsigned char pixels[6*6] = { 0 };
+        sprintf(name, "%s font atlas size not multiple of 4 rejected", formatNames[f]);
+        Check(name, rgs_font_atlas_encode(pixels, 6, 6, formats[f]) == NULL);
+    }
+
+    unsigned char pixels[16] = { 0 };
+    Check("font atlas unsupported format rejected", (rgs_font_atlas_encode(pixels, 4, 4, RGS_PIXELFORMAT_GRAY_ALPHA) == NULL) &&
+                                                     (rgs_font_atlas_decode(pixels, 4, 4, RGS_PIXELFORMAT_GRAY_ALPHA) == NULL));
+
+    // Properties compact encoding: truncated data and colors dictionary out of data size rejected
+    rgs_style *style = (rgs_style *)RGS_CALLOC(1, sizeof(rgs_style));
+    for (int i = 0; i < 16; i++) rgs_set_property(style, i, 0, 0x11223300 + i%4);
+    rgs_set_property(style, 0, 16, 24);
+
+    int dataSize = 0;
+    unsigned char *data = rgs_save_to_memory(style, RGS_SAVE_PROPS_COMPACT, &dataSize);
+    bool truncatedRejected = (data != NULL) && (rgs_validate(data, dataSize) == RGS_OK);
+
+    // NOTE: Font data size field follows properties, last 4 bytes
+    for (int size = 0; (data != NULL) && (size < (dataSize - 4)); size++) if (rgs_validate(data, size) == RGS_OK) truncatedRejected = false;
+
+    Check("compact properties truncated data rejected", truncatedRejected);
+
+    unsigned char colorsOverflow[16] = { 'r', 'G', 'S', ' ', 0x9a, 0x01, 0x01, 0x00, 1, 0, 0, 0, 0x80, 0x02, 0, 0 };
+    Check("compact properties colors dictionary out of data rejected", rgs_validate(colorsOverflow, 16) == RGS_ERROR_PROPERTIES);
+
+    RGS_FREE(data);
+    RGS_FREE(style);
+
+    // Compressed font atlas: round trip and corrupted DEFLATE stream rejected
+    style = (rgs_style *)RGS_CALLOC(1, sizeof(rgs_style));
+    style->font.atlas_width = 32;
+    style->font.atlas_height = 32;
+    style->font.atlas_format = RGS_PIXELFORMAT_GRAY_ALPHA;
+    style->font.atlas_size = 32*32*2;
+    style->font.atlas_data = (unsigned char *)RGS_MALLOC(style->font.atlas_size);
+    for (int i = 0; i < style->font.atlas_size; i++) style->font.atlas_data[i] = (i%2)? (unsigned char)(i%37*7) : 255;
+    style->font.faces[0].base_size = 10;
+    style->font.faces[0].glyph_count = 4;
+    style->font.faces[0].recs = (rgs_rectangle *)RGS_CALLOC(4, sizeof(rgs_rectangle));
+    style->font.faces[0].glyphs = (rgs_glyph *)RGS_CALLOC(4, sizeof(rgs_glyph));
+
+    data = rgs_save_to_memory(style, RGS_SAVE_FONT_ATLAS_COMPRESSED | RGS_SAVE_FONT_DATA_COMPRESSED, &dataSize);
+
+    // NOTE: No properties saved, font atlas compressed size at offset 48 and compressed data at offset 64
+    int atlasCompSize = 0;
+    memcpy(&atlasCompSize, data + 48, sizeof(int));
+
+    rgs_style *loaded = (rgs_style *)RGS_CALLOC(1, sizeof(rgs_style));
+    Check("compressed font atlas round trip", (rgs_load_from_memory(loaded, data, dataSize) == RGS_OK) && (loaded->font.atlas_data != NULL) &&
+                                               (memcmp(loaded->font.atlas_data, style->font.atlas_data, style->font.atlas_size) == 0));
+    rgs_unload(loaded);
+
+    unsigned char *corrupted = (unsigned char *)RGS_MALLOC(dataSize);
+    memcpy(corrupted, data, dataSize);
+    corrupted[64] |= 0x06;      // Reserved block type
+    Check("compressed font atlas reserved block type rejected", rgs_validate(corrupted, dataSize) == RGS_ERROR_INVALID_DATA);
+
+    // Fuzz compressed stream: every result must be a valid result code and some corruptions detected as invalid data
+    int invalidCount = 0;
+    bool resultsValid = true;
+
+    for (int n = 0; n < 2000; n++)
+    {
+        memcpy(corrupted, data, dataSize);
+        for (int k = 0; k < 1 + n%4; k++) corrupted[64 + rand()%atlasCompSize] ^= (unsigned char)(1 + rand()%255);
+
+        int result = rgs_validate(corrupted, dataSize);
+
+        if (result == RGS_ERROR_INVALID_DATA) invalidCount++;
+        else if ((result != RGS_OK) && (result != RGS_ERROR_DECOMPRESS)) resultsValid = false;
+    }
+
+    sprintf(name, "compressed font atlas fuzzing (invalid data: %i/2000)", invalidCount);
+    Check(name, resultsValid && (invalidCount > 0));
+
+    RGS_FREE(corrupted);
+    RGS_FREE(data);
+    rgs_unload(style);
+    RGS_FREE(style);
+    RGS_FREE(loaded);
+
+    if (testsFailed > 0) printf("%i tests failed\n", testsFailed);
+
+    return (testsFailed > 0)? 1 : 0;
+}